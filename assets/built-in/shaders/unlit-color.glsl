@@ -9,15 +9,11 @@ struct VertexData
 
 in VertexData vertex;
 
-struct AppData {
-    mat4 mvp;
-};
-
-uniform AppData app;
+uniform mat4 u_mvp;
 
 void main()
 {
-    gl_Position = app.mvp * vec4(vertex.pos, 1);
+    gl_Position = u_mvp * vec4(vertex.pos, 1);
 }
 
 #endif
@@ -29,13 +25,13 @@ struct MaterialData
     vec4 color;
 };
 
-uniform MaterialData material;
+uniform MaterialData u_mat;
 
 out vec4 outColor;
 
 void main()
 {
-    outColor = material.color;
+    outColor = u_mat.color;
 }
 
 #endif
\ No newline at end of file
@@ -18,11 +18,19 @@ in VertexData vertex;
 
 uniform mat4 u_mvp;
 
+#ifdef PLUTO_INSTANCING
+in mat4 i_model;
+#endif
+
 out V2F v2f;
 
 void main()
 {
+#ifdef PLUTO_INSTANCING
+    gl_Position = u_mvp * i_model * vec4(vertex.pos, 1);
+#else
     gl_Position = u_mvp * vec4(vertex.pos, 1);
+#endif
     v2f.texCoord = vertex.uv;
 }
 
@@ -18,7 +18,7 @@ private:
     bool isGameOver;
 
     int points;
-    pluto::Guid onSceneLoadedListenerId;
+    pluto::RuntimeId onSceneLoadedListenerId;
 
     pluto::EventManager* eventManager;
     pluto::SceneManager* sceneManager;
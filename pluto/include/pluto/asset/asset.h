@@ -33,7 +33,9 @@ namespace pluto
             Shader = 4,
             Texture = 5,
             Material = 6,
-            Font = 7
+            Font = 7,
+            Prefab = 8,
+            Scene = 9
         };
 
         virtual ~Asset() = 0;
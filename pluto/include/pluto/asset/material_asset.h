@@ -3,6 +3,7 @@
 #include "asset.h"
 #include "pluto/service/base_factory.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -40,6 +41,8 @@ namespace pluto
     class PLUTO_API MaterialAsset final : public Asset
     {
     public:
+        static constexpr size_t NO_SLOT = SIZE_MAX;
+
         class PLUTO_API Factory final : public Asset::Factory
         {
         public:
@@ -71,6 +74,20 @@ namespace pluto
         Resource<ShaderAsset> GetShader() const;
         void SetShader(const Resource<ShaderAsset>& value);
 
+        /*
+         * Properties are kept in slots laid out like the uniforms of the shader, the slot of a property is the index
+         * of its uniform in ShaderAsset::GetUniforms. Renderers read them by slot, without hashing names. While the
+         * shader is not loaded, setting a property by name adds a slot for it.
+         */
+        size_t FindSlot(const std::string& propertyName) const;
+
+        /*
+         * Every change bumps the revision of the material and stamps it on the changed slot. After uploading the
+         * material at a revision, only the slots with a newer one have to be uploaded again.
+         */
+        uint32_t GetRevision() const;
+        uint32_t GetSlotRevision(size_t slot) const;
+
         bool GetBool(const std::string& propertyName) const;
         void SetBool(const std::string& propertyName, bool value);
 
@@ -79,6 +96,8 @@ namespace pluto
 
         float GetFloat(const std::string& propertyName) const;
         void SetFloat(const std::string& propertyName, float value);
+        float GetFloat(size_t slot) const;
+        void SetFloat(size_t slot, float value);
 
         Vector2I GetVector2I(const std::string& propertyName) const;
         void SetVector2I(const std::string& propertyName, const Vector2I& value);
@@ -97,11 +116,17 @@ namespace pluto
 
         const Vector4F& GetVector4F(const std::string& propertyName) const;
         void SetVector4F(const std::string& propertyName, const Vector4F& value);
+        const Vector4F& GetVector4F(size_t slot) const;
+        void SetVector4F(size_t slot, const Vector4F& value);
 
         const Matrix4X4& GetMatrix4X4(const std::string& propertyName) const;
         void SetMatrix4X4(const std::string& propertyName, const Matrix4X4& value);
+        const Matrix4X4& GetMatrix4X4(size_t slot) const;
+        void SetMatrix4X4(size_t slot, const Matrix4X4& value);
 
         Resource<TextureAsset> GetTexture(const std::string& propertyName) const;
         void SetTexture(const std::string& propertyName, const Resource<TextureAsset>& textureAsset);
+        Resource<TextureAsset> GetTexture(size_t slot) const;
+        void SetTexture(size_t slot, const Resource<TextureAsset>& textureAsset);
     };
 }
@@ -62,15 +62,20 @@ namespace pluto
         const Guid& GetId() const override;
         const std::string& GetName() const override;
         void SetName(const std::string& value) override;
+        size_t GetCpuPayloadSize() const override;
+        size_t GetGpuPayloadSize() const override;
 
         void Dump(FileStreamWriter& fileWriter) const override;
 
         const std::vector<Vector3F>& GetPositions() const;
         void SetPositions(std::vector<Vector3F> value);
+        void SetPositions(const Vector3F* data, size_t count);
         const std::vector<Vector2F>& GetUVs() const;
         void SetUVs(std::vector<Vector2F> value);
+        void SetUVs(const Vector2F* data, size_t count);
         const std::vector<Vector3I>& GetTriangles() const;
         void SetTriangles(std::vector<Vector3I> value);
+        void SetTriangles(const Vector3I* data, size_t count);
 
         MeshBuffer& GetMeshBuffer();
     };
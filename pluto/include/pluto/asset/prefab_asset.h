@@ -0,0 +1,103 @@
+#pragma once
+
+#include "asset.h"
+#include "pluto/service/base_factory.h"
+#include "pluto/math/vector3f.h"
+#include "pluto/math/quaternion.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pluto
+{
+    /*
+     * File layout in disk. (Version 1)
+     * +--------------+------+------------------------------+
+     * | Type         | Size | Description                  |
+     * +--------------+------+------------------------------+
+     * | GUID         | 16   | File signature.              |
+     * | uint8_t      | 1    | Serializer version.          |
+     * | uint8_t      | 1    | Asset type.                  |
+     * | GUID         | 16   | Asset unique identifier.     |
+     * | uint8_t      | 1    | Asset name length.           |
+     * | string       | *    | Asset name.                  |
+     * +--------------+------+------------------------------+
+     * | uint32_t     | 4    | Nodes count.                 |
+     * +--------------+------+------------------------------+
+     * | uint8_t      | 1    | Node name length.            |
+     * | string       | *    | Node name.                   |
+     * | uint32_t     | 4    | Parent node index.           |
+     * | uint8_t      | 1    | Is active.                   |
+     * | uint32_t     | 4    | Tags.                        |
+     * | uint8_t      | 1    | Layer.                       |
+     * | Vector3F     | 12   | Local position.              |
+     * | Quaternion   | 16   | Local rotation.              |
+     * | Vector3F     | 12   | Local scale.                 |
+     * | uint8_t      | 1    | Components count.            |
+     * +--------------+------+------------------------------+
+     * | uint8_t      | 1    | Component type name length.  |
+     * | string       | *    | Component type name.         |
+     * +--------------+------+------------------------------+
+     */
+    class PLUTO_API PrefabAsset final : public Asset
+    {
+    public:
+        static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+        /*
+         * A game object of the prefab. The first node is the root, every other node comes after its parent.
+         */
+        class Node
+        {
+        public:
+            std::string name;
+            uint32_t parent;
+            bool isActive;
+            uint32_t tags;
+            uint8_t layer;
+            Vector3F localPosition;
+            Quaternion localRotation;
+            Vector3F localScale;
+
+            // Names the component types were registered with.
+            std::vector<std::string> components;
+        };
+
+        class PLUTO_API Factory final : public Asset::Factory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection);
+            std::unique_ptr<PrefabAsset> Create() const;
+            std::unique_ptr<PrefabAsset> Create(const PrefabAsset& original) const;
+            std::unique_ptr<Asset> Create(StreamReader& reader) const override;
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~PrefabAsset() override;
+        explicit PrefabAsset(std::unique_ptr<Impl> impl);
+
+        PrefabAsset(const PrefabAsset& other) = delete;
+        PrefabAsset(PrefabAsset&& other) noexcept;
+        PrefabAsset& operator=(const PrefabAsset& rhs) = delete;
+        PrefabAsset& operator=(PrefabAsset&& rhs) noexcept;
+
+        const Guid& GetId() const override;
+        const std::string& GetName() const override;
+        void SetName(const std::string& value) override;
+
+        void Dump(FileStreamWriter& fileWriter) const override;
+
+        const std::vector<Node>& GetNodes() const;
+
+        /*
+         * Returns the index of the node, throws if its parent was not added before it.
+         */
+        uint32_t AddNode(const Node& node);
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "asset.h"
+#include "prefab_asset.h"
+#include "pluto/service/base_factory.h"
+#include "pluto/math/vector3f.h"
+#include "pluto/math/quaternion.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pluto
+{
+    /*
+     * File layout in disk. (Version 1)
+     * Game object fields are stored as arrays, so each one is read in a single copy. N is the game objects count and
+     * C the components count.
+     * +--------------+------+------------------------------+
+     * | Type         | Size | Description                  |
+     * +--------------+------+------------------------------+
+     * | GUID         | 16   | File signature.              |
+     * | uint8_t      | 1    | Serializer version.          |
+     * | uint8_t      | 1    | Asset type.                  |
+     * | GUID         | 16   | Asset unique identifier.     |
+     * | uint8_t      | 1    | Asset name length.           |
+     * | string       | *    | Asset name.                  |
+     * +--------------+------+------------------------------+
+     * | uint16_t     | 2    | Component types count.       |
+     * +--------------+------+------------------------------+
+     * | uint8_t      | 1    | Component type name length.  |
+     * | string       | *    | Component type name.         |
+     * +--------------+------+------------------------------+
+     * | uint32_t     | 4    | Game objects count.          |
+     * | uint32_t     | 4N   | Parent game object indices.  |
+     * | Vector3F     | 12N  | Local positions.             |
+     * | Quaternion   | 16N  | Local rotations.             |
+     * | Vector3F     | 12N  | Local scales.                |
+     * | uint8_t      | N    | Active states.               |
+     * | uint32_t     | 4N   | Tags.                        |
+     * | uint8_t      | N    | Layers.                      |
+     * +--------------+------+------------------------------+
+     * | uint8_t      | 1    | Game object name length.     |
+     * | string       | *    | Game object name.            |
+     * +--------------+------+------------------------------+
+     * | uint32_t     | 4    | Components count.            |
+     * | uint32_t     | 4C   | Component game object index. |
+     * | uint16_t     | 2C   | Component type index.        |
+     * +--------------+------+------------------------------+
+     */
+    class PLUTO_API SceneAsset final : public Asset
+    {
+    public:
+        static constexpr uint32_t NO_PARENT = PrefabAsset::NO_PARENT;
+
+        class PLUTO_API Factory final : public Asset::Factory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection);
+            std::unique_ptr<SceneAsset> Create() const;
+            std::unique_ptr<Asset> Create(StreamReader& reader) const override;
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~SceneAsset() override;
+        explicit SceneAsset(std::unique_ptr<Impl> impl);
+
+        SceneAsset(const SceneAsset& other) = delete;
+        SceneAsset(SceneAsset&& other) noexcept;
+        SceneAsset& operator=(const SceneAsset& rhs) = delete;
+        SceneAsset& operator=(SceneAsset&& rhs) noexcept;
+
+        const Guid& GetId() const override;
+        const std::string& GetName() const override;
+        void SetName(const std::string& value) override;
+
+        void Dump(FileStreamWriter& fileWriter) const override;
+
+        size_t GetGameObjectCount() const;
+
+        const std::vector<std::string>& GetNames() const;
+        const std::vector<uint32_t>& GetParents() const;
+        const std::vector<Vector3F>& GetLocalPositions() const;
+        const std::vector<Quaternion>& GetLocalRotations() const;
+        const std::vector<Vector3F>& GetLocalScales() const;
+        const std::vector<uint8_t>& GetActiveStates() const;
+        const std::vector<uint32_t>& GetTags() const;
+        const std::vector<uint8_t>& GetLayers() const;
+
+        /*
+         * Names the component types were registered with, indexed by GetComponentTypes.
+         */
+        const std::vector<std::string>& GetComponentTypeNames() const;
+
+        /*
+         * Components are sorted by the index of their game object.
+         */
+        const std::vector<uint32_t>& GetComponentGameObjects() const;
+        const std::vector<uint16_t>& GetComponentTypes() const;
+
+        /*
+         * Appends a game object described like a prefab node, its parent index refers to the game objects of the scene.
+         * Returns the index of the game object, throws if its parent was not added before it.
+         */
+        uint32_t AddGameObject(const PrefabAsset::Node& node);
+    };
+}
@@ -13,7 +13,7 @@ namespace pluto
     class ShaderProgram;
 
     /*
-     * File layout in disk. (Version 1)
+     * File layout in disk. (Version 2)
      * +--------------+------+------------------------------+
      * | Type         | Size | Description                  |
      * +--------------+------+------------------------------+
@@ -32,6 +32,8 @@ namespace pluto
      * | uint32_t     | 4    | Program binary format.       |
      * | uint32_t     | 4    | Program binary size.         |
      * | uint8_t[]    | *    | Program binary bytes.        |
+     * | uint32_t     | 4    | Instanced binary size.       |
+     * | uint8_t[]    | *    | Instanced binary bytes.      |
      * +--------------+------+------------------------------+
      */
     class PLUTO_API ShaderAsset final : public Asset
@@ -130,7 +132,8 @@ namespace pluto
                                                 DepthTest depthTest, CullFace cullFace,
                                                 const std::vector<Property>& attributes,
                                                 const std::vector<Property>& uniforms, uint32_t binaryFormat,
-                                                const std::vector<uint8_t>& binaryData) const;
+                                                const std::vector<uint8_t>& binaryData,
+                                                const std::vector<uint8_t>& instancedBinaryData) const;
 
             std::unique_ptr<Asset> Create(StreamReader& reader) const override;
         };
@@ -178,6 +181,12 @@ namespace pluto
 
         const std::vector<uint8_t>& GetBinaryData() const;
 
+        /*
+         * Program compiled with PLUTO_INSTANCING defined, empty when the shader has no instanced variant. It takes the
+         * model matrix per instance and u_mvp as the view projection.
+         */
+        const std::vector<uint8_t>& GetInstancedBinaryData() const;
+
         ShaderProgram& GetShaderProgram();
     };
 }
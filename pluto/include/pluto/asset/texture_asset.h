@@ -95,6 +95,8 @@ namespace pluto
         const Guid& GetId() const override;
         const std::string& GetName() const override;
         void SetName(const std::string& value) override;
+        size_t GetCpuPayloadSize() const override;
+        size_t GetGpuPayloadSize() const override;
 
         void Dump(FileStreamWriter& fileWriter) const override;
 
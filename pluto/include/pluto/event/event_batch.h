@@ -0,0 +1,45 @@
+#pragma once
+
+#include "base_event.h"
+
+#include <cstddef>
+
+namespace pluto
+{
+    /*
+     * Dispatched when the queued events of type T are flushed, before each of them is dispatched on its own.
+     */
+    template <typename T>
+    class EventBatch final : public BaseEvent
+    {
+        const T* events;
+        size_t count;
+
+    public:
+        EventBatch(const T* events, const size_t count)
+            : events(events),
+              count(count)
+        {
+        }
+
+        const T* begin() const
+        {
+            return events;
+        }
+
+        const T* end() const
+        {
+            return events + count;
+        }
+
+        size_t GetCount() const
+        {
+            return count;
+        }
+
+        const T& operator[](const size_t index) const
+        {
+            return events[index];
+        }
+    };
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "base_event.h"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace pluto
+{
+    template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>  = false>
+    using EventListener = std::function<void(const T&)>;
+
+    template <typename T1, typename T2, std::enable_if_t<std::is_base_of_v<BaseEvent, T2>, bool>  = false>
+    using EventMemberListener = void(T1::*)(const T2&);
+
+    /*
+     * Type erased event callback. Member listeners are stored inline, so subscribing them does not allocate and
+     * invoking them costs a single indirect call.
+     */
+    class EventDelegate final
+    {
+        using Invoker = void(*)(const EventDelegate& delegate, const BaseEvent& event);
+        using Deleter = void(*)(void* target);
+
+        // Large enough for member function pointers of any inheritance model.
+        static constexpr size_t METHOD_SIZE = sizeof(void*) * 4;
+
+        void* target;
+        Invoker invoker;
+        Deleter deleter;
+        alignas(std::max_align_t) unsigned char method[METHOD_SIZE];
+
+        EventDelegate(void* target, Invoker invoker, Deleter deleter);
+
+    public:
+        ~EventDelegate();
+
+        EventDelegate(const EventDelegate& other) = delete;
+        EventDelegate(EventDelegate&& other) noexcept;
+        EventDelegate& operator=(const EventDelegate& rhs) = delete;
+        EventDelegate& operator=(EventDelegate&& rhs) noexcept;
+
+        void operator()(const BaseEvent& event) const;
+
+        template <typename T1, typename T2, std::enable_if_t<std::is_base_of_v<BaseEvent, T2>, bool>  = false>
+        static EventDelegate Create(T1& obj, EventMemberListener<T1, T2> listener);
+
+        template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>  = false>
+        static EventDelegate Create(const EventListener<T>& listener);
+    };
+}
+
+#include "event_delegate.inl"
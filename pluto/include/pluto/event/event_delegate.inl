@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstring>
+#include <new>
+
+namespace pluto
+{
+    inline EventDelegate::EventDelegate(void* target, const Invoker invoker, const Deleter deleter)
+        : target(target),
+          invoker(invoker),
+          deleter(deleter),
+          method()
+    {
+    }
+
+    inline EventDelegate::~EventDelegate()
+    {
+        if (deleter != nullptr)
+        {
+            deleter(target);
+        }
+    }
+
+    inline EventDelegate::EventDelegate(EventDelegate&& other) noexcept
+        : target(other.target),
+          invoker(other.invoker),
+          deleter(other.deleter),
+          method()
+    {
+        std::memcpy(method, other.method, METHOD_SIZE);
+        other.target = nullptr;
+        other.deleter = nullptr;
+    }
+
+    inline EventDelegate& EventDelegate::operator=(EventDelegate&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            if (deleter != nullptr)
+            {
+                deleter(target);
+            }
+
+            target = rhs.target;
+            invoker = rhs.invoker;
+            deleter = rhs.deleter;
+            std::memcpy(method, rhs.method, METHOD_SIZE);
+            rhs.target = nullptr;
+            rhs.deleter = nullptr;
+        }
+        return *this;
+    }
+
+    inline void EventDelegate::operator()(const BaseEvent& event) const
+    {
+        invoker(*this, event);
+    }
+
+    template <typename T1, typename T2, std::enable_if_t<std::is_base_of_v<BaseEvent, T2>, bool>>
+    EventDelegate EventDelegate::Create(T1& obj, EventMemberListener<T1, T2> listener)
+    {
+        using Method = EventMemberListener<T1, T2>;
+        static_assert(sizeof(Method) <= METHOD_SIZE, "Member function pointer does not fit in the delegate.");
+        static_assert(std::is_trivially_copyable_v<Method>);
+
+        const auto invoker = [](const EventDelegate& delegate, const BaseEvent& event)
+        {
+            Method method;
+            std::memcpy(&method, delegate.method, sizeof(Method));
+            (static_cast<T1*>(delegate.target)->*method)(static_cast<const T2&>(event));
+        };
+
+        EventDelegate delegate(&obj, invoker, nullptr);
+        std::memcpy(delegate.method, &listener, sizeof(Method));
+        return delegate;
+    }
+
+    template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>>
+    EventDelegate EventDelegate::Create(const EventListener<T>& listener)
+    {
+        const auto invoker = [](const EventDelegate& delegate, const BaseEvent& event)
+        {
+            (*static_cast<const EventListener<T>*>(delegate.target))(static_cast<const T&>(event));
+        };
+
+        const auto deleter = [](void* target)
+        {
+            delete static_cast<EventListener<T>*>(target);
+        };
+
+        return EventDelegate(new EventListener<T>(listener), invoker, deleter);
+    }
+}
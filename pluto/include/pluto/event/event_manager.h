@@ -3,20 +3,17 @@
 #include "pluto/service/base_service.h"
 #include "pluto/service/base_factory.h"
 #include "base_event.h"
+#include "event_delegate.h"
 
-#include <functional>
 #include <memory>
 #include <type_traits>
+#include <typeinfo>
 
 namespace pluto
 {
-    class Guid;
-
-    template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>  = false>
-    using EventListener = std::function<void(const T&)>;
-
-    template <typename T1, typename T2, std::enable_if_t<std::is_base_of_v<BaseEvent, T2>, bool>  = false>
-    using EventMemberListener = void(T1::*)(const T2&);
+    class RuntimeId;
+    class BaseEventQueue;
+    class BasePostedEvent;
 
     class PLUTO_API EventManager final : public BaseService
     {
@@ -42,13 +39,13 @@ namespace pluto
         EventManager& operator=(EventManager&& other) noexcept;
 
         template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>  = false>
-        Guid Subscribe(const EventListener<T>& listener);
+        RuntimeId Subscribe(const EventListener<T>& listener);
 
         template <typename T1, typename T2, std::enable_if_t<std::is_base_of_v<BaseEvent, T2>, bool>  = false>
-        Guid Subscribe(T1& obj, EventMemberListener<T1, T2>&& listener);
+        RuntimeId Subscribe(T1& obj, EventMemberListener<T1, T2>&& listener);
 
         template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>  = false>
-        void Unsubscribe(const Guid& guid);
+        void Unsubscribe(RuntimeId listenerId);
 
         template <typename T,
                   typename ... Args,
@@ -56,11 +53,61 @@ namespace pluto
                                    && std::is_constructible_v<T, Args...>, bool>  = false>
         void Dispatch(Args&&... args) const;
 
-        Guid Subscribe(const std::type_info& eventType, const EventListener<BaseEvent>& listener);
+        /*
+         * Queues the event to be dispatched on the next flush, listeners of EventBatch<T> receive all of them at once.
+         */
+        template <typename T,
+                  typename ... Args,
+                  std::enable_if_t<std::is_base_of_v<BaseEvent, T>
+                                   && std::is_constructible_v<T, Args...>, bool>  = false>
+        void Enqueue(Args&&... args);
+
+        /*
+         * Same as Enqueue, but replaces the event queued with the same key since the last flush if there is one.
+         */
+        template <typename T,
+                  typename ... Args,
+                  std::enable_if_t<std::is_base_of_v<BaseEvent, T>
+                                   && std::is_constructible_v<T, Args...>, bool>  = false>
+        void EnqueueCoalesced(RuntimeId key, Args&&... args);
 
-        void Unsubscribe(const std::type_info& eventType, const Guid& guid);
+        void FlushEventQueues();
+
+        /*
+         * Thread safe and lock free, the event is dispatched on the main thread by the next DispatchPostedEvents call.
+         * Events posted by the same thread are dispatched in the order they were posted.
+         */
+        template <typename T,
+                  typename ... Args,
+                  std::enable_if_t<std::is_base_of_v<BaseEvent, T>
+                                   && std::is_constructible_v<T, Args...>, bool>  = false>
+        void Post(Args&&... args);
+
+        void Post(std::unique_ptr<BasePostedEvent> postedEvent);
+
+        void DispatchPostedEvents();
+
+        RuntimeId Subscribe(const std::type_info& eventType, const EventListener<BaseEvent>& listener);
+
+        void Unsubscribe(const std::type_info& eventType, RuntimeId listenerId);
 
         void Dispatch(const BaseEvent& event) const;
+
+        RuntimeId Subscribe(size_t eventTypeId, EventDelegate&& delegate);
+
+        void Unsubscribe(size_t eventTypeId, RuntimeId listenerId);
+
+        void Dispatch(size_t eventTypeId, const BaseEvent& event) const;
+
+        /*
+         * Event type ids are dense and shared by every module, they are assigned the first time a type is seen.
+         */
+        static size_t GetEventTypeId(const std::type_info& eventType);
+
+        BaseEventQueue& GetEventQueue(size_t eventTypeId, std::unique_ptr<BaseEventQueue> (*factory)());
+
+        template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>  = false>
+        static size_t GetEventTypeId();
     };
 }
 
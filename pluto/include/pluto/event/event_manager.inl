@@ -1,29 +1,28 @@
 #pragma once
 
-#include "pluto/guid.h"
+#include "event_queue.h"
+#include "posted_event.h"
+#include "pluto/runtime_id.h"
+#include "pluto/type_registry.h"
 
 namespace pluto
 {
     template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>>
-    Guid EventManager::Subscribe(const EventListener<T>& listener)
+    RuntimeId EventManager::Subscribe(const EventListener<T>& listener)
     {
-        const auto callback = [listener](const BaseEvent& x)
-        {
-            listener(dynamic_cast<const T&>(x));
-        };
-        return Subscribe(typeid(T), callback);
+        return Subscribe(GetEventTypeId<T>(), EventDelegate::Create<T>(listener));
     }
 
     template <typename T1, typename T2, std::enable_if_t<std::is_base_of_v<BaseEvent, T2>, bool>>
-    Guid EventManager::Subscribe(T1& obj, EventMemberListener<T1, T2>&& listener)
+    RuntimeId EventManager::Subscribe(T1& obj, EventMemberListener<T1, T2>&& listener)
     {
-        return Subscribe<T2>(std::bind(listener, &obj, std::placeholders::_1));
+        return Subscribe(GetEventTypeId<T2>(), EventDelegate::Create<T1, T2>(obj, listener));
     }
 
     template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>>
-    void EventManager::Unsubscribe(const Guid& guid)
+    void EventManager::Unsubscribe(const RuntimeId listenerId)
     {
-        Unsubscribe(typeid(T), guid);
+        Unsubscribe(GetEventTypeId<T>(), listenerId);
     }
 
     template <typename T,
@@ -32,6 +31,42 @@ namespace pluto
                                && std::is_constructible_v<T, Args...>, bool>>
     void EventManager::Dispatch(Args&& ... args) const
     {
-        Dispatch(T(std::forward<Args>(args)...));
+        const T event(std::forward<Args>(args)...);
+        Dispatch(GetEventTypeId<T>(), event);
+    }
+
+    template <typename T,
+              typename ... Args,
+              std::enable_if_t<std::is_base_of_v<BaseEvent, T>
+                               && std::is_constructible_v<T, Args...>, bool>>
+    void EventManager::Enqueue(Args&& ... args)
+    {
+        auto& queue = static_cast<EventQueue<T>&>(GetEventQueue(GetEventTypeId<T>(), &EventQueue<T>::Create));
+        queue.Push(T(std::forward<Args>(args)...));
+    }
+
+    template <typename T,
+              typename ... Args,
+              std::enable_if_t<std::is_base_of_v<BaseEvent, T>
+                               && std::is_constructible_v<T, Args...>, bool>>
+    void EventManager::EnqueueCoalesced(const RuntimeId key, Args&& ... args)
+    {
+        auto& queue = static_cast<EventQueue<T>&>(GetEventQueue(GetEventTypeId<T>(), &EventQueue<T>::Create));
+        queue.Push(key, T(std::forward<Args>(args)...));
+    }
+
+    template <typename T,
+              typename ... Args,
+              std::enable_if_t<std::is_base_of_v<BaseEvent, T>
+                               && std::is_constructible_v<T, Args...>, bool>>
+    void EventManager::Post(Args&& ... args)
+    {
+        Post(std::make_unique<PostedEvent<T>>(std::forward<Args>(args)...));
+    }
+
+    template <typename T, std::enable_if_t<std::is_base_of_v<BaseEvent, T>, bool>>
+    size_t EventManager::GetEventTypeId()
+    {
+        return TypeRegistry::GetId<BaseEvent, T>();
     }
 }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "base_event.h"
+#include "pluto/runtime_id.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace pluto
+{
+    class EventManager;
+
+    class BaseEventQueue
+    {
+        bool pending;
+
+    public:
+        BaseEventQueue();
+        virtual ~BaseEventQueue() = default;
+
+        BaseEventQueue(const BaseEventQueue& other) = delete;
+        BaseEventQueue(BaseEventQueue&& other) noexcept = delete;
+        BaseEventQueue& operator=(const BaseEventQueue& rhs) = delete;
+        BaseEventQueue& operator=(BaseEventQueue&& rhs) noexcept = delete;
+
+        bool IsPending() const;
+        void SetPending(bool value);
+
+        virtual void Flush(EventManager& eventManager) = 0;
+    };
+
+    /*
+     * Contiguous buffer of the events of type T enqueued since the last flush.
+     */
+    template <typename T>
+    class EventQueue final : public BaseEventQueue
+    {
+        std::vector<T> events;
+        std::vector<T> flushing;
+        std::unordered_map<RuntimeId, size_t> coalescedEvents;
+
+    public:
+        void Push(T&& event);
+        void Push(RuntimeId key, T&& event);
+        void Flush(EventManager& eventManager) override;
+
+        static std::unique_ptr<BaseEventQueue> Create();
+    };
+}
+
+#include "event_queue.inl"
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "event_batch.h"
+#include "event_manager.h"
+
+namespace pluto
+{
+    inline BaseEventQueue::BaseEventQueue()
+        : pending(false)
+    {
+    }
+
+    inline bool BaseEventQueue::IsPending() const
+    {
+        return pending;
+    }
+
+    inline void BaseEventQueue::SetPending(const bool value)
+    {
+        pending = value;
+    }
+
+    template <typename T>
+    void EventQueue<T>::Push(T&& event)
+    {
+        events.push_back(std::move(event));
+    }
+
+    template <typename T>
+    void EventQueue<T>::Push(const RuntimeId key, T&& event)
+    {
+        const auto it = coalescedEvents.find(key);
+        if (it != coalescedEvents.end())
+        {
+            events[it->second] = std::move(event);
+            return;
+        }
+
+        coalescedEvents.emplace(key, events.size());
+        events.push_back(std::move(event));
+    }
+
+    template <typename T>
+    void EventQueue<T>::Flush(EventManager& eventManager)
+    {
+        // Events enqueued by the listeners below wait for the next flush.
+        std::swap(events, flushing);
+        coalescedEvents.clear();
+
+        const EventBatch<T> batch(flushing.data(), flushing.size());
+        eventManager.Dispatch(EventManager::GetEventTypeId<EventBatch<T>>(), batch);
+
+        const size_t eventTypeId = EventManager::GetEventTypeId<T>();
+        for (const T& event : flushing)
+        {
+            eventManager.Dispatch(eventTypeId, event);
+        }
+
+        flushing.clear();
+    }
+
+    template <typename T>
+    std::unique_ptr<BaseEventQueue> EventQueue<T>::Create()
+    {
+        return std::make_unique<EventQueue<T>>();
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace pluto
+{
+    class EventManager;
+
+    /*
+     * Node of the event inbox, allocated by the posting thread and released by the main thread once dispatched.
+     */
+    class BasePostedEvent
+    {
+        friend class EventInbox;
+        std::atomic<BasePostedEvent*> next;
+
+    public:
+        BasePostedEvent();
+        virtual ~BasePostedEvent() = default;
+
+        BasePostedEvent(const BasePostedEvent& other) = delete;
+        BasePostedEvent(BasePostedEvent&& other) noexcept = delete;
+        BasePostedEvent& operator=(const BasePostedEvent& rhs) = delete;
+        BasePostedEvent& operator=(BasePostedEvent&& rhs) noexcept = delete;
+
+        virtual void Dispatch(EventManager& eventManager) const = 0;
+    };
+
+    template <typename T>
+    class PostedEvent final : public BasePostedEvent
+    {
+        T event;
+
+    public:
+        template <typename ... Args>
+        explicit PostedEvent(Args&&... args);
+
+        void Dispatch(EventManager& eventManager) const override;
+    };
+}
+
+#include "posted_event.inl"
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "event_manager.h"
+
+namespace pluto
+{
+    inline BasePostedEvent::BasePostedEvent()
+        : next(nullptr)
+    {
+    }
+
+    template <typename T>
+    template <typename ... Args>
+    PostedEvent<T>::PostedEvent(Args&&... args)
+        : event(std::forward<Args>(args)...)
+    {
+    }
+
+    template <typename T>
+    void PostedEvent<T>::Dispatch(EventManager& eventManager) const
+    {
+        eventManager.Dispatch(EventManager::GetEventTypeId<T>(), event);
+    }
+}
@@ -23,6 +23,9 @@ namespace pluto
         friend PLUTO_API std::ostream& operator<<(std::ostream& os, const Guid& guid);
         std::string Str() const;
 
+        /*
+         * Creates a random uuid, use it for anything that is persisted (e.g. assets).
+         */
         static Guid New();
     };
 }
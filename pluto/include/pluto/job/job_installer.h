@@ -0,0 +1,15 @@
+#pragma once
+
+#include "pluto/api.h"
+
+namespace pluto
+{
+    class ServiceCollection;
+
+    class PLUTO_API JobInstaller
+    {
+    public:
+        static void Install(ServiceCollection& serviceCollection);
+        static void Uninstall(ServiceCollection& serviceCollection);
+    };
+}
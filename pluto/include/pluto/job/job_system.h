@@ -0,0 +1,47 @@
+#pragma once
+
+#include "pluto/service/base_service.h"
+#include "pluto/service/base_factory.h"
+
+#include <functional>
+#include <memory>
+
+namespace pluto
+{
+    /*
+     * Pool of worker threads, one less than the hardware threads unless configured with jobWorkerCount. Each thread
+     * has its own queue of jobs and steals from the others when it runs out.
+     */
+    class PLUTO_API JobSystem final : public BaseService
+    {
+    public:
+        class PLUTO_API Factory final : public BaseFactory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection);
+            std::unique_ptr<JobSystem> Create() const;
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~JobSystem();
+        explicit JobSystem(std::unique_ptr<Impl> impl);
+
+        JobSystem(const JobSystem& other) = delete;
+        JobSystem(JobSystem&& other) noexcept;
+        JobSystem& operator=(const JobSystem& rhs) = delete;
+        JobSystem& operator=(JobSystem&& rhs) noexcept;
+
+        size_t GetWorkerCount() const;
+
+        /*
+         * Calls function with consecutive ranges of [0, count) of at most chunkSize elements, spread across the
+         * workers. The calling thread runs jobs too and only returns once every range is done, rethrowing the first
+         * exception thrown by a job. Can be called from inside a job.
+         */
+        void ParallelFor(size_t count, size_t chunkSize, const std::function<void(size_t begin, size_t end)>& function);
+    };
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "pluto/service/base_service.h"
+#include "pluto/service/base_factory.h"
+
+#include <memory>
+#include <vector>
+
+namespace pluto
+{
+    /*
+     * Bump allocator reset at the end of every main loop. It is not synchronized and belongs to the main thread, jobs
+     * must not allocate from it. Debug builds assert that every call is made from the thread that created it.
+     */
+    class PLUTO_API FrameAllocator final : public BaseService
+    {
+    public:
+        class PLUTO_API Factory final : public BaseFactory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection);
+            std::unique_ptr<FrameAllocator> Create() const;
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~FrameAllocator();
+        explicit FrameAllocator(std::unique_ptr<Impl> impl);
+
+        FrameAllocator(const FrameAllocator& other) = delete;
+        FrameAllocator(FrameAllocator&& other) noexcept;
+        FrameAllocator& operator=(const FrameAllocator& rhs) = delete;
+        FrameAllocator& operator=(FrameAllocator&& rhs) noexcept;
+
+        void* Allocate(size_t size, size_t alignment);
+        void Deallocate(void* ptr, size_t size);
+
+        void Reset();
+
+        size_t GetUsedBytes() const;
+        size_t GetCapacity() const;
+        size_t GetHighWaterMark() const;
+    };
+
+    /*
+     * STL allocator that takes its memory from the FrameAllocator.
+     * Containers using it must not outlive the frame in which they were created, nor be grown outside the main thread.
+     */
+    template <typename T>
+    class FrameAllocatorAdapter
+    {
+        template <typename T2>
+        friend class FrameAllocatorAdapter;
+
+        FrameAllocator* frameAllocator;
+
+    public:
+        using value_type = T;
+
+        FrameAllocatorAdapter(FrameAllocator& frameAllocator) noexcept;
+        template <typename T2>
+        FrameAllocatorAdapter(const FrameAllocatorAdapter<T2>& other) noexcept;
+
+        T* allocate(size_t n);
+        void deallocate(T* ptr, size_t n) noexcept;
+
+        template <typename T2>
+        bool operator==(const FrameAllocatorAdapter<T2>& rhs) const noexcept;
+        template <typename T2>
+        bool operator!=(const FrameAllocatorAdapter<T2>& rhs) const noexcept;
+    };
+
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocatorAdapter<T>>;
+}
+
+#include "frame_allocator.inl"
@@ -0,0 +1,43 @@
+#pragma once
+
+namespace pluto
+{
+    template <typename T>
+    FrameAllocatorAdapter<T>::FrameAllocatorAdapter(FrameAllocator& frameAllocator) noexcept
+        : frameAllocator(&frameAllocator)
+    {
+    }
+
+    template <typename T>
+    template <typename T2>
+    FrameAllocatorAdapter<T>::FrameAllocatorAdapter(const FrameAllocatorAdapter<T2>& other) noexcept
+        : frameAllocator(other.frameAllocator)
+    {
+    }
+
+    template <typename T>
+    T* FrameAllocatorAdapter<T>::allocate(const size_t n)
+    {
+        return static_cast<T*>(frameAllocator->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    template <typename T>
+    void FrameAllocatorAdapter<T>::deallocate(T* ptr, const size_t n) noexcept
+    {
+        frameAllocator->Deallocate(ptr, n * sizeof(T));
+    }
+
+    template <typename T>
+    template <typename T2>
+    bool FrameAllocatorAdapter<T>::operator==(const FrameAllocatorAdapter<T2>& rhs) const noexcept
+    {
+        return frameAllocator == rhs.frameAllocator;
+    }
+
+    template <typename T>
+    template <typename T2>
+    bool FrameAllocatorAdapter<T>::operator!=(const FrameAllocatorAdapter<T2>& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+}
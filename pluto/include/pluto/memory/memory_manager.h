@@ -4,8 +4,11 @@
 #include "pluto/service/base_service.h"
 #include "pluto/service/base_factory.h"
 #include "pluto/memory/resource.h"
+#include "pluto/memory/object_handle.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace pluto
 {
@@ -22,6 +25,21 @@ namespace pluto
             std::unique_ptr<MemoryManager> Create() const;
         };
 
+        struct TypeStats
+        {
+            std::string typeName;
+            size_t liveCount;
+            size_t liveBytes;
+            size_t highWaterCount;
+            size_t highWaterBytes;
+            size_t cpuPayloadBytes;
+            size_t gpuPayloadBytes;
+
+            // Reads through resources whose object of this type was removed, a growing count means dead objects are
+            // still referenced.
+            size_t staleReadCount;
+        };
+
     private:
         class Impl;
         std::unique_ptr<Impl> impl;
@@ -36,8 +54,32 @@ namespace pluto
         MemoryManager& operator=(MemoryManager&& rhs) noexcept;
 
         Resource<Object> Add(std::unique_ptr<Object> object);
+
+        /*
+         * Adds every object in one go, the storage is sized for all of them before the first one is added.
+         */
+        std::vector<Resource<Object>> AddRange(std::vector<std::unique_ptr<Object>> objects);
+
+        /*
+         * Makes room for count more objects, so adding them does not grow the storage one step at a time.
+         */
+        void Reserve(size_t count);
         Resource<Object> Get(const Guid& objectId) const;
+        Resource<Object> Get(ObjectHandle handle) const;
         void Remove(const Object& object);
-        std::shared_ptr<Object> GetPtr(const Guid& objectId) const;
+        void Remove(ObjectHandle handle);
+
+        /*
+         * Resource to the object with the persisted id, which may not be added yet. It sees the object once it is.
+         */
+        Resource<Object> GetReference(const Guid& objectId);
+
+        Object* GetPtr(const Guid& objectId) const;
+        Object* GetPtr(ObjectHandle handle) const;
+        ObjectHandle GetHandle(const Guid& objectId) const;
+        ResourceControl* GetControl(ObjectHandle handle) const;
+        bool IsValid(ObjectHandle handle) const;
+        size_t GetObjectCount() const;
+        std::vector<TypeStats> GetTypeStats() const;
     };
 }
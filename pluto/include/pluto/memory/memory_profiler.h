@@ -0,0 +1,48 @@
+#pragma once
+
+#include "pluto/service/base_service.h"
+#include "pluto/service/base_factory.h"
+
+#include <memory>
+
+namespace pluto
+{
+    class StreamWriter;
+
+    /*
+     * Writes MemoryManager type stats snapshots.
+     * Periodic snapshots are enabled by the "memoryProfilerInterval" config (in frames), and written to
+     * "memoryProfilerFile" using "memoryProfilerFormat" ("csv" or "json", one object per line).
+     */
+    class PLUTO_API MemoryProfiler final : public BaseService
+    {
+    public:
+        class PLUTO_API Factory final : public BaseFactory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection);
+            std::unique_ptr<MemoryProfiler> Create() const;
+        };
+
+        enum class Format
+        {
+            Csv,
+            Json
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~MemoryProfiler();
+        explicit MemoryProfiler(std::unique_ptr<Impl> impl);
+
+        MemoryProfiler(const MemoryProfiler& other) = delete;
+        MemoryProfiler(MemoryProfiler&& other) noexcept;
+        MemoryProfiler& operator=(const MemoryProfiler& rhs) = delete;
+        MemoryProfiler& operator=(MemoryProfiler&& rhs) noexcept;
+
+        void Dump(StreamWriter& writer, Format format) const;
+    };
+}
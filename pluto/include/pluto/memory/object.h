@@ -1,17 +1,28 @@
 #pragma once
 
 #include "pluto/api.h"
+#include "pluto/memory/pool_object.h"
+#include "pluto/memory/object_handle.h"
+#include "pluto/runtime_id.h"
+
 #include <string>
 
 namespace pluto
 {
     class Guid;
+    class MemoryManager;
 
-    class PLUTO_API Object
+    class PLUTO_API Object : public PoolObject
     {
+        friend class MemoryManager;
+
+        RuntimeId runtimeId;
+        ObjectHandle handle;
+
     public:
         virtual ~Object() = 0;
         Object();
+        explicit Object(RuntimeId runtimeId);
 
         Object(const Object& other) = delete;
         Object(Object&& other) noexcept;
@@ -21,8 +32,26 @@ namespace pluto
         bool operator==(const Object& rhs) const;
         bool operator!=(const Object& rhs) const;
 
-        virtual const Guid& GetId() const = 0;
+        RuntimeId GetRuntimeId() const;
+
+        /*
+         * Slot of the object in the memory manager, null while the object is not added to it.
+         */
+        ObjectHandle GetHandle() const;
+
+        /*
+         * Persisted id of the object, empty for objects that only live at runtime.
+         */
+        virtual const Guid& GetId() const;
         virtual const std::string& GetName() const = 0;
         virtual void SetName(const std::string& value) = 0;
+
+        virtual size_t GetCpuPayloadSize() const;
+        virtual size_t GetGpuPayloadSize() const;
+
+        /*
+         * Bytes of the implementation when it is pooled apart from the object, counted in the live bytes of the type.
+         */
+        virtual size_t GetImplAllocationSize() const;
     };
 }
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace pluto
+{
+    /*
+     * Compact reference to an object slot in the MemoryManager.
+     * +------------+------+--------------------------------------+
+     * | Bits       | Size | Description                          |
+     * +------------+------+--------------------------------------+
+     * | 0 - 31     | 32   | Slot index.                          |
+     * | 32 - 63    | 32   | Slot generation, never zero if valid.|
+     * +------------+------+--------------------------------------+
+     */
+    class ObjectHandle
+    {
+    public:
+        static constexpr uint32_t MAX_INDEX = UINT32_MAX - 1;
+
+    private:
+        uint32_t index;
+        uint32_t generation;
+
+    public:
+        constexpr ObjectHandle()
+            : index(0),
+              generation(0)
+        {
+        }
+
+        constexpr ObjectHandle(const uint32_t index, const uint32_t generation)
+            : index(index),
+              generation(generation)
+        {
+        }
+
+        constexpr uint32_t GetIndex() const
+        {
+            return index;
+        }
+
+        constexpr uint32_t GetGeneration() const
+        {
+            return generation;
+        }
+
+        constexpr uint64_t GetValue() const
+        {
+            return static_cast<uint64_t>(generation) << 32 | index;
+        }
+
+        constexpr bool IsNull() const
+        {
+            return generation == 0;
+        }
+
+        constexpr bool operator==(const ObjectHandle& rhs) const
+        {
+            return index == rhs.index && generation == rhs.generation;
+        }
+
+        constexpr bool operator!=(const ObjectHandle& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        static constexpr uint32_t NextGeneration(const uint32_t generation)
+        {
+            const uint32_t next = generation + 1;
+            return next == 0 ? 1 : next;
+        }
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<pluto::ObjectHandle>
+    {
+        size_t operator()(const pluto::ObjectHandle& handle) const noexcept
+        {
+            return hash<uint64_t>()(handle.GetValue());
+        }
+    };
+}
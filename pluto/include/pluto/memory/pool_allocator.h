@@ -0,0 +1,65 @@
+#pragma once
+
+#include "pluto/service/base_service.h"
+#include "pluto/service/base_factory.h"
+#include "pluto/memory/pool_object.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <typeinfo>
+#include <type_traits>
+
+namespace pluto
+{
+    class PLUTO_API PoolAllocator final : public BaseService
+    {
+    public:
+        class PLUTO_API Factory final : public BaseFactory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection);
+            std::unique_ptr<PoolAllocator> Create() const;
+        };
+
+        struct Stats
+        {
+            std::string typeName;
+            size_t blockSize;
+            size_t capacity;
+            size_t liveCount;
+            size_t highWaterMark;
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~PoolAllocator();
+        explicit PoolAllocator(std::unique_ptr<Impl> impl);
+
+        PoolAllocator(const PoolAllocator& other) = delete;
+        PoolAllocator(PoolAllocator&& other) noexcept;
+        PoolAllocator& operator=(const PoolAllocator& rhs) = delete;
+        PoolAllocator& operator=(PoolAllocator&& rhs) noexcept;
+
+        template <typename T,
+                  typename ... Args,
+                  std::enable_if_t<std::is_base_of_v<PoolObject, T>
+                                   && std::is_constructible_v<T, Args...>, bool>  = false>
+        std::unique_ptr<T> New(Args&&... args);
+
+        void* Allocate(const std::type_info& type, size_t size);
+
+        std::vector<Stats> GetStats() const;
+
+        static void* AllocateUnpooled(size_t size);
+
+        static size_t GetAllocationSize(const void* ptr);
+
+        static void Release(void* ptr) noexcept;
+    };
+}
+
+#include "pool_allocator.inl"
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace pluto
+{
+    template <typename T,
+              typename ... Args,
+              std::enable_if_t<std::is_base_of_v<PoolObject, T>
+                               && std::is_constructible_v<T, Args...>, bool>>
+    std::unique_ptr<T> PoolAllocator::New(Args&&... args)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over aligned types can not be pooled.");
+        void* memory = Allocate(typeid(T), sizeof(T));
+        return std::unique_ptr<T>(new(memory) T(std::forward<Args>(args)...));
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "pluto/api.h"
+
+#include <cstddef>
+
+namespace pluto
+{
+    /*
+     * Base for types that can be placed in a PoolAllocator pool.
+     * Every instance is preceded by a small header that tells from which pool it came, so instances created with a
+     * plain new expression and the ones created by PoolAllocator::New are released the same way.
+     */
+    class PLUTO_API PoolObject
+    {
+    public:
+        static void* operator new(size_t size);
+        static void* operator new(size_t size, void* where) noexcept;
+        static void operator delete(void* ptr) noexcept;
+        static void operator delete(void* ptr, void* where) noexcept;
+    };
+}
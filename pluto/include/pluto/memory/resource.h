@@ -2,6 +2,7 @@
 
 #include "pluto/api.h"
 #include "pluto/memory/resource_control.h"
+#include "pluto/guid.h"
 
 #include <memory>
 
@@ -10,34 +11,40 @@ namespace pluto
     template <typename T, typename Enable = void>
     class Resource;
 
-    class Guid;
-
+    /*
+     * Trivially copyable reference to an object owned by the MemoryManager.
+     * Dereferencing validates the handle against the slot and only writes, atomically, to count reads of removed
+     * objects, so resources are safe to read from many threads. Only operator-> counts them, null checks and Get do
+     * not. Objects with a persisted id keep their slot, a resource
+     * to one that was removed, or was not added yet, sees the object with that id once it is added.
+     */
     template <typename T>
     class Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>
     {
+        template <typename T2, typename Enable>
+        friend class Resource;
         friend class ResourceUtils;
 
-        std::shared_ptr<ResourceControl> control;
+        ResourceControl* control;
+        ObjectHandle handle;
+        Guid objectId;
+
     public:
         Resource();
         Resource(nullptr_t);
-        explicit Resource(std::unique_ptr<ResourceControl> control);
+        Resource(ResourceControl& control, ObjectHandle handle, const Guid& objectId);
         template <typename T2, std::enable_if_t<std::is_base_of_v<T, T2>, bool>  = false>
         Resource(const Resource<T2>& other);
         template <typename T2, std::enable_if_t<std::is_base_of_v<T, T2>, bool>  = false>
-        Resource(Resource<T2>&& other) noexcept;
-        template <typename T2, std::enable_if_t<std::is_base_of_v<T, T2>, bool>  = false>
         Resource& operator=(const Resource<T2>& rhs);
-        template <typename T2, std::enable_if_t<std::is_base_of_v<T, T2>, bool>  = false>
-        Resource& operator=(Resource<T2>&& rhs);
 
         bool operator==(nullptr_t) const;
         bool operator!=(nullptr_t) const;
         bool operator==(const Resource& rhs) const;
         bool operator!=(const Resource& rhs) const;
 
-        Guid GetObjectId() const;
-        Guid GetObjectId();
+        const Guid& GetObjectId() const;
+        ObjectHandle GetHandle() const;
 
         const T* Get() const;
         T* Get();
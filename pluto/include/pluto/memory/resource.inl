@@ -1,34 +1,35 @@
 #pragma once
 
-#include "pluto/guid.h"
-
 namespace pluto
 {
     template <typename T>
-    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource(std::unique_ptr<ResourceControl> control)
-        : control(control.release())
+    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource()
+        : control(nullptr)
     {
     }
 
-    template <typename T>
-    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource() = default;
-
     template <typename T>
     Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource(nullptr_t)
+        : control(nullptr)
     {
     }
 
     template <typename T>
-    template <typename T2, std::enable_if_t<std::is_base_of_v<T, T2>, bool>>
-    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource(const Resource<T2>& other)
-        : control(other.control)
+    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource(ResourceControl& control,
+                                                                          const ObjectHandle handle,
+                                                                          const Guid& objectId)
+        : control(&control),
+          handle(handle),
+          objectId(objectId)
     {
     }
 
     template <typename T>
     template <typename T2, std::enable_if_t<std::is_base_of_v<T, T2>, bool>>
-    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource(Resource<T2>&& other) noexcept
-        : control(std::move(other.control))
+    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::Resource(const Resource<T2>& other)
+        : control(other.control),
+          handle(other.handle),
+          objectId(other.objectId)
     {
     }
 
@@ -38,22 +39,15 @@ namespace pluto
         T, std::enable_if_t<std::is_base_of_v<Object, T>>>::operator=(const Resource<T2>& rhs)
     {
         control = rhs.control;
-        return *this;
-    }
-
-    template <typename T>
-    template <typename T2, std::enable_if_t<std::is_base_of_v<T, T2>, bool>>
-    Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>& Resource<
-        T, std::enable_if_t<std::is_base_of_v<Object, T>>>::operator=(Resource<T2>&& rhs)
-    {
-        control = std::move(rhs.control);
+        handle = rhs.handle;
+        objectId = rhs.objectId;
         return *this;
     }
 
     template <typename T>
     bool Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::operator==(nullptr_t) const
     {
-        return !control || control->Get() == nullptr;
+        return Get() == nullptr;
     }
 
     template <typename T>
@@ -65,8 +59,8 @@ namespace pluto
     template <typename T>
     bool Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::operator==(const Resource& rhs) const
     {
-        return control == rhs.control ||
-            (!control && !rhs.control && control->GetObjectId() == rhs.control->GetObjectId());
+        // Runtime objects have no persisted id, they are told apart by their slot.
+        return control == rhs.control && handle == rhs.handle && objectId == rhs.objectId;
     }
 
     template <typename T>
@@ -76,23 +70,15 @@ namespace pluto
     }
 
     template <typename T>
-    Guid Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::GetObjectId() const
+    const Guid& Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::GetObjectId() const
     {
-        if (control == nullptr)
-        {
-            return Guid();
-        }
-        return control->GetObjectId();
+        return objectId;
     }
 
     template <typename T>
-    Guid Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::GetObjectId()
+    ObjectHandle Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::GetHandle() const
     {
-        if (control == nullptr)
-        {
-            return Guid();
-        }
-        return control->GetObjectId();
+        return handle;
     }
 
     template <typename T>
@@ -102,7 +88,8 @@ namespace pluto
         {
             return nullptr;
         }
-        return dynamic_cast<const T*>(control->Get());
+
+        return static_cast<const T*>(control->Find(handle));
     }
 
     template <typename T>
@@ -112,19 +99,30 @@ namespace pluto
         {
             return nullptr;
         }
-        return dynamic_cast<T*>(control->Get());
+
+        return static_cast<T*>(control->Find(handle));
     }
 
     template <typename T>
     const T* Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::operator->() const
     {
-        return Get();
+        if (control == nullptr)
+        {
+            return nullptr;
+        }
+
+        return static_cast<const T*>(control->Get(handle));
     }
 
     template <typename T>
     T* Resource<T, std::enable_if_t<std::is_base_of_v<Object, T>>>::operator->()
     {
-        return Get();
+        if (control == nullptr)
+        {
+            return nullptr;
+        }
+
+        return static_cast<T*>(control->Get(handle));
     }
 
     template <typename T1,
@@ -133,12 +131,17 @@ namespace pluto
               std::enable_if_t<std::is_base_of_v<T2, T1>, bool>>
     Resource<T1> ResourceUtils::Cast(const Resource<T2>& resource)
     {
-        if (dynamic_cast<const T1*>(resource.Get()) == nullptr)
+        const T2* object = resource.Get();
+        if (object != nullptr && dynamic_cast<const T1*>(object) == nullptr)
         {
             return nullptr;
         }
+
+        // References to objects that were not added yet are kept, their slot is bound to the id.
         Resource<T1> out;
         out.control = resource.control;
+        out.handle = resource.handle;
+        out.objectId = resource.objectId;
         return out;
     }
 }
@@ -1,41 +1,63 @@
 #pragma once
 
 #include "pluto/api.h"
-#include "pluto/service/base_factory.h"
+#include "pluto/memory/object_handle.h"
 
-#include <memory>
+#include <atomic>
 
 namespace pluto
 {
     class Object;
-    class Guid;
 
-    class PLUTO_API ResourceControl
+    /*
+     * Slot record owned by the MemoryManager. Its address is stable for the lifetime of the manager, so resources keep
+     * a raw pointer to it and validate the object by comparing their handle with the current one.
+     * Dereferencing it through a handle whose object was removed is counted against the type of the last object removed
+     * from the slot, so references kept to dead objects show up in the memory stats. Null checks are not counted.
+     */
+    class PLUTO_API ResourceControl final
     {
-    public:
-        class PLUTO_API Factory final : public BaseFactory
-        {
-        public:
-            explicit Factory(ServiceCollection& serviceCollection);
-            std::unique_ptr<ResourceControl> Create(const std::shared_ptr<Object>& object) const;
-            std::unique_ptr<ResourceControl> Create(const Guid& objectId) const;
-        };
+        friend class MemoryManager;
 
-    private:
-        class Impl;
-        std::unique_ptr<Impl> impl;
+        Object* object;
+        ObjectHandle handle;
+        std::atomic<size_t>* staleReadCount;
 
     public:
         ~ResourceControl();
-        explicit ResourceControl(std::unique_ptr<Impl> impl);
+        ResourceControl();
 
         ResourceControl(const ResourceControl& other) = delete;
-        ResourceControl(ResourceControl&& other) noexcept;
+        ResourceControl(ResourceControl&& other) noexcept = delete;
         ResourceControl& operator=(const ResourceControl& rhs) = delete;
-        ResourceControl& operator=(ResourceControl&& rhs) noexcept;
+        ResourceControl& operator=(ResourceControl&& rhs) noexcept = delete;
+
+        ObjectHandle GetHandle() const
+        {
+            return handle;
+        }
 
-        const Guid& GetObjectId() const;
+        /*
+         * Object of the handle, or null if it was removed, without counting it as a stale read.
+         */
+        Object* Find(const ObjectHandle objectHandle) const
+        {
+            return handle == objectHandle ? object : nullptr;
+        }
 
-        Object* Get() const;
+        Object* Get(const ObjectHandle objectHandle) const
+        {
+            Object* found = Find(objectHandle);
+            if (found != nullptr)
+            {
+                return found;
+            }
+
+            if (staleReadCount != nullptr)
+            {
+                staleReadCount->fetch_add(1, std::memory_order_relaxed);
+            }
+            return nullptr;
+        }
     };
 }
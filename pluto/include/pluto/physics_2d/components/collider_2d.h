@@ -38,5 +38,8 @@ namespace pluto
 
         void OnEarlyFixedUpdate() override;
         void OnLateFixedUpdate() override;
+
+        void OnEnable() override;
+        void OnDisable() override;
     };
 }
@@ -11,7 +11,7 @@ namespace pluto
 
     class GameObject;
 
-    class Guid;
+    class RuntimeId;
     class Vector2F;
     class Physics2DShape;
     class Physics2DCircleShape;
@@ -56,6 +56,9 @@ namespace pluto
         Type GetType(Type type) const;
         void SetType(Type value);
 
+        bool IsActive() const;
+        void SetActive(bool value);
+
         float GetGravityScale() const;
         void SetGravityScale(float value);
 
@@ -75,10 +78,8 @@ namespace pluto
         void AddForce(const Vector2F& force, const Vector2F& point);
         void AddTorque(float torque);
 
-        std::unique_ptr<Physics2DCircleShape> CreateCircleShape(const Guid& colliderId, const Vector2F& offset,
-                                                                float radius);
-        std::unique_ptr<Physics2DBoxShape> CreateBoxShape(const Guid& colliderId, const Vector2F& offset,
-                                                          const Vector2F& size);
+        std::unique_ptr<Physics2DCircleShape> CreateCircleShape(const Vector2F& offset, float radius);
+        std::unique_ptr<Physics2DBoxShape> CreateBoxShape(const Vector2F& offset, const Vector2F& size);
 
         void Update();
         void* GetNativeBody() const;
@@ -6,7 +6,6 @@
 
 namespace pluto
 {
-    class Guid;
     class Physics2DBody;
 
     class PLUTO_API Physics2DBoxShape final : public Physics2DShape
@@ -16,8 +15,7 @@ namespace pluto
         {
         public:
             explicit Factory(ServiceCollection& serviceCollection);
-            std::unique_ptr<Physics2DBoxShape> Create(Physics2DBody& body, const Guid& colliderId,
-                                                      const Vector2F& offset,
+            std::unique_ptr<Physics2DBoxShape> Create(Physics2DBody& body, const Vector2F& offset,
                                                       const Vector2F& size) const;
         };
 
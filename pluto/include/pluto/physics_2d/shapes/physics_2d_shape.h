@@ -4,6 +4,7 @@
 
 namespace pluto
 {
+    class Object;
     class Vector2F;
 
     class PLUTO_API Physics2DShape
@@ -32,6 +33,11 @@ namespace pluto
         bool IsTrigger() const;
         void SetTrigger(bool value);
 
+        /*
+         * Collider the shape belongs to, the contacts of the shape are reported to it.
+         */
+        void SetCollider(Object& collider);
+
         virtual Vector2F GetOffset() const = 0;
         virtual void SetOffset(const Vector2F& value) = 0;
     };
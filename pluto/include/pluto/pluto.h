@@ -6,6 +6,8 @@
 #include "pluto/asset/material_asset.h"
 #include "pluto/asset/mesh_asset.h"
 #include "pluto/asset/package_manifest_asset.h"
+#include "pluto/asset/prefab_asset.h"
+#include "pluto/asset/scene_asset.h"
 #include "pluto/asset/shader_asset.h"
 #include "pluto/asset/text_asset.h"
 #include "pluto/asset/texture_asset.h"
@@ -23,6 +25,8 @@
 #include "pluto/input/input_manager.h"
 #include "pluto/input/key_code.h"
 
+#include "pluto/job/job_system.h"
+
 #include "pluto/log/log_manager.h"
 
 #include "pluto/math/bounds.h"
@@ -48,9 +52,13 @@
 #include "pluto/physics_2d/components/collider_2d.h"
 #include "pluto/physics_2d/components/rigidbody_2d.h"
 
+#include "pluto/scene/command_buffer.h"
+#include "pluto/scene/component_array.h"
 #include "pluto/scene/game_object.h"
 #include "pluto/scene/scene.h"
 #include "pluto/scene/scene_manager.h"
+#include "pluto/scene/system.h"
+#include "pluto/scene/transform_hierarchy.h"
 #include "pluto/scene/components/behaviour.h"
 #include "pluto/scene/components/camera.h"
 #include "pluto/scene/components/component.h"
@@ -71,4 +79,6 @@
 #include "pluto/guid.h"
 #include "pluto/regex.h"
 #include "pluto/root.h"
+#include "pluto/runtime_id.h"
 #include "pluto/stop_watch.h"
+#include "pluto/type_registry.h"
@@ -6,10 +6,13 @@
 namespace pluto
 {
     class MeshAsset;
+    class Matrix4X4;
 
     class PLUTO_API GlMeshBuffer final : public MeshBuffer
     {
     public:
+        static constexpr uint32_t INSTANCE_MODEL_LOCATION = 2;
+
         class PLUTO_API Factory final : public MeshBuffer::Factory
         {
         public:
@@ -31,6 +34,15 @@ namespace pluto
 
         void Bind();
         void Unbind();
+
+        /*
+         * Draws with the mesh buffer that is bound, so consecutive draws of the same mesh only bind it once.
+         */
         void Draw();
+
+        /*
+         * Draws an instance of the bound mesh buffer for each model matrix, with the instanced variant of a shader.
+         */
+        void DrawInstanced(const Matrix4X4* modelMatrices, size_t instancesCount);
     };
 }
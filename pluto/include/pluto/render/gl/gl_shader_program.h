@@ -30,7 +30,24 @@ namespace pluto
         GlShaderProgram& operator=(const GlShaderProgram& rhs) = delete;
         GlShaderProgram& operator=(GlShaderProgram&& rhs) noexcept;
 
-        void Bind(const Matrix4X4& mvp, const MaterialAsset& materialAsset);
+        /*
+         * Uses the program and applies the blend, depth and face cull state of the shader.
+         */
+        void Bind();
+
+        /*
+         * Same as Bind, with the instanced variant of the shader. The model view projection is then the view
+         * projection, the model matrices come from the instance buffer of the mesh.
+         */
+        bool HasInstancedVariant() const;
+        void BindInstanced();
+
         void Unbind();
+
+        /*
+         * Uploads the uniforms of the material to the bound variant of the program.
+         */
+        void SetMaterial(const MaterialAsset& materialAsset);
+        void SetModelViewProjection(const Matrix4X4& mvp);
     };
 }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "pluto/api.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace pluto
+{
+    class GlStateCache;
+    class MeshAsset;
+    class Matrix4X4;
+
+    /*
+     * Merges small meshes drawn with the same material into one streamed vertex buffer. Vertices are moved to world
+     * space on the CPU, so a batch is drawn with the view projection matrix alone, in the order its meshes were added.
+     */
+    class PLUTO_API GlSpriteBatch
+    {
+    public:
+        static constexpr size_t MAX_MESH_VERTICES = 16;
+        static constexpr size_t MAX_VERTICES = 65536;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~GlSpriteBatch();
+        explicit GlSpriteBatch(GlStateCache& stateCache);
+
+        GlSpriteBatch(const GlSpriteBatch& other) = delete;
+        GlSpriteBatch(GlSpriteBatch&& other) noexcept;
+        GlSpriteBatch& operator=(const GlSpriteBatch& rhs) = delete;
+        GlSpriteBatch& operator=(GlSpriteBatch&& rhs) noexcept;
+
+        /*
+         * Meshes up to MAX_MESH_VERTICES vertices with an uv for each of them, like quads, can be batched.
+         */
+        static bool IsBatchable(const MeshAsset& mesh);
+
+        bool IsEmpty() const;
+        bool IsFull(const MeshAsset& mesh) const;
+        size_t GetMeshesCount() const;
+
+        void Add(const MeshAsset& mesh, const Matrix4X4& worldMatrix);
+
+        /*
+         * Draws and clears the batch, the shader program and its material have to be bound already.
+         */
+        void Draw();
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "pluto/service/base_service.h"
+#include "pluto/service/base_factory.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace pluto
+{
+    /*
+     * Shadow copy of the OpenGL state the renderer touches, calls that would not change it never reach the driver.
+     * Every bind of the GL backend has to go through the cache, or it has to be invalidated afterwards. With
+     * glStateCacheValidation on, the shadow state is checked against the real one after every change.
+     */
+    class PLUTO_API GlStateCache final : public BaseService
+    {
+    public:
+        static constexpr uint32_t TEXTURE_UNIT_COUNT = 16;
+
+        class PLUTO_API Factory final : public BaseFactory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection);
+            std::unique_ptr<GlStateCache> Create() const;
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~GlStateCache() override;
+        explicit GlStateCache(std::unique_ptr<Impl> impl);
+
+        GlStateCache(const GlStateCache& other) = delete;
+        GlStateCache(GlStateCache&& other) noexcept;
+        GlStateCache& operator=(const GlStateCache& rhs) = delete;
+        GlStateCache& operator=(GlStateCache&& rhs) noexcept;
+
+        void UseProgram(uint32_t program);
+        void BindVertexArray(uint32_t vertexArray);
+
+        /*
+         * The element array buffer binding belongs to the bound vertex array, it is tracked per vertex array.
+         */
+        void BindBuffer(uint32_t target, uint32_t buffer);
+        void BindTexture(uint32_t unit, uint32_t target, uint32_t texture);
+
+        void SetCapability(uint32_t capability, bool isEnabled);
+        void SetBlendFunction(uint32_t srcFactor, uint32_t dstFactor, uint32_t srcAlphaFactor, uint32_t dstAlphaFactor);
+        void SetBlendEquation(uint32_t equation, uint32_t alphaEquation);
+        void SetDepthFunction(uint32_t function);
+        void SetCullFace(uint32_t face);
+
+        /*
+         * Deleting a bound object resets its binding, so a recycled name is not taken as already bound.
+         */
+        void DeleteProgram(uint32_t program);
+        void DeleteVertexArray(uint32_t vertexArray);
+        void DeleteBuffer(uint32_t buffer);
+        void DeleteTexture(uint32_t texture);
+
+        /*
+         * Forgets the shadow state, for when something else changed the GL state.
+         */
+        void Invalidate();
+
+        /*
+         * Throws if the shadow state does not match the GL state.
+         */
+        void Validate() const;
+
+        size_t GetSkippedCallsCount() const;
+        size_t GetIssuedCallsCount() const;
+        void ResetCallsCount();
+    };
+}
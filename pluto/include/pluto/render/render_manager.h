@@ -12,6 +12,19 @@ namespace pluto
     class PLUTO_API RenderManager : public BaseService
     {
     public:
+        struct FrameStats
+        {
+            size_t commandsCount;
+            size_t drawCalls;
+            size_t shaderChanges;
+            size_t materialChanges;
+            size_t meshChanges;
+            size_t batchedCommands;
+            size_t instancedCommands;
+            size_t stateCallsIssued;
+            size_t stateCallsSkipped;
+        };
+
         virtual ~RenderManager() = 0;
 
         RenderManager();
@@ -24,5 +37,11 @@ namespace pluto
         virtual void DrawCircleGizmo(const Vector2F& position, float radius, const Color& color) = 0;
         virtual void DrawPolygonGizmo(const std::vector<Vector2F>& points, const Color& color) = 0;
         virtual void DrawLineGizmo(const Vector2F& from, const Vector2F& to, const Color& color) = 0;
+
+        /*
+         * Counters of the last rendered frame. Debug builds also log them every renderStatsLogInterval frames when
+         * that is set in the config.
+         */
+        virtual FrameStats GetFrameStats() const = 0;
     };
 }
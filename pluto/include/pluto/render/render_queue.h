@@ -0,0 +1,78 @@
+#pragma once
+
+#include "pluto/api.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace pluto
+{
+    class Renderer;
+    class MeshAsset;
+    class MaterialAsset;
+    class ShaderAsset;
+
+    /*
+     * Draw commands of a frame sorted by a packed 64 bit key. From the most to the least significant bits the key holds
+     * the layer, the depth, the shader, the material and the mesh, so commands that share state end up next to each
+     * other without breaking the layer and depth order.
+     */
+    class PLUTO_API RenderQueue
+    {
+    public:
+        static constexpr uint32_t LAYER_BITS = 8;
+        static constexpr uint32_t DEPTH_BITS = 20;
+        static constexpr uint32_t SHADER_BITS = 10;
+        static constexpr uint32_t MATERIAL_BITS = 16;
+        static constexpr uint32_t MESH_BITS = 10;
+
+        static constexpr uint32_t MESH_SHIFT = 0;
+        static constexpr uint32_t MATERIAL_SHIFT = MESH_SHIFT + MESH_BITS;
+        static constexpr uint32_t SHADER_SHIFT = MATERIAL_SHIFT + MATERIAL_BITS;
+        static constexpr uint32_t DEPTH_SHIFT = SHADER_SHIFT + SHADER_BITS;
+        static constexpr uint32_t LAYER_SHIFT = DEPTH_SHIFT + DEPTH_BITS;
+
+        struct Command
+        {
+            uint64_t key;
+            Renderer* renderer;
+            MeshAsset* mesh;
+            MaterialAsset* material;
+            ShaderAsset* shader;
+        };
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~RenderQueue();
+        RenderQueue();
+
+        RenderQueue(const RenderQueue& other) = delete;
+        RenderQueue(RenderQueue&& other) noexcept;
+        RenderQueue& operator=(const RenderQueue& rhs) = delete;
+        RenderQueue& operator=(RenderQueue&& rhs) noexcept;
+
+        /*
+         * Shader, material and mesh ids are given in the order they are first added in a frame. Past the bits of its
+         * field an id is clamped, the order stays right but those commands no longer group by that state.
+         */
+        static uint64_t MakeKey(uint8_t layer, float depth, uint32_t shader, uint32_t material, uint32_t mesh);
+
+        void Clear();
+
+        /*
+         * Lower depths are drawn first.
+         */
+        void Add(Renderer& renderer, uint8_t layer, float depth);
+
+        /*
+         * Radix sort by key, stable for commands with the same key.
+         */
+        void Sort();
+
+        const std::vector<Command>& GetCommands() const;
+    };
+}
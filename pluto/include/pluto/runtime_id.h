@@ -0,0 +1,70 @@
+#pragma once
+
+#include "api.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <ostream>
+
+namespace pluto
+{
+    /*
+     * Id of an object that only lives in this process (e.g. game objects, components, event subscriptions).
+     * It is a monotonic counter, so it is never persisted; persisted objects are identified by a Guid.
+     */
+    class PLUTO_API RuntimeId
+    {
+        uint64_t value;
+
+    public:
+        constexpr RuntimeId()
+            : value(0)
+        {
+        }
+
+        constexpr explicit RuntimeId(const uint64_t value)
+            : value(value)
+        {
+        }
+
+        constexpr uint64_t GetValue() const
+        {
+            return value;
+        }
+
+        constexpr bool IsNull() const
+        {
+            return value == 0;
+        }
+
+        constexpr bool operator==(const RuntimeId& rhs) const
+        {
+            return value == rhs.value;
+        }
+
+        constexpr bool operator!=(const RuntimeId& rhs) const
+        {
+            return value != rhs.value;
+        }
+
+        friend PLUTO_API std::ostream& operator<<(std::ostream& os, const RuntimeId& runtimeId);
+        std::string Str() const;
+
+        /*
+         * Thread safe, never returns a null id.
+         */
+        static RuntimeId New();
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<pluto::RuntimeId>
+    {
+        size_t operator()(const pluto::RuntimeId& runtimeId) const noexcept
+        {
+            return hash<uint64_t>()(runtimeId.GetValue());
+        }
+    };
+}
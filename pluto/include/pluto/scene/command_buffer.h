@@ -0,0 +1,70 @@
+#pragma once
+
+#include "pluto/scene/components/component.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+namespace pluto
+{
+    template <typename T, typename Enable = void>
+    class Resource;
+
+    class Scene;
+    class GameObject;
+    class Transform;
+
+    /*
+     * Structural changes recorded while the scene runs a parallel phase, executed in recording order once the phase
+     * is done. Recording can be done from any thread.
+     */
+    class PLUTO_API CommandBuffer
+    {
+    public:
+        using Command = std::function<void(Scene& scene)>;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~CommandBuffer();
+        CommandBuffer();
+
+        CommandBuffer(const CommandBuffer& other) = delete;
+        CommandBuffer(CommandBuffer&& other) noexcept;
+        CommandBuffer& operator=(const CommandBuffer& rhs) = delete;
+        CommandBuffer& operator=(CommandBuffer&& rhs) noexcept;
+
+        void Add(Command command);
+
+        /*
+         * onCreated is called with the new game object when the command is executed, so it can be set up.
+         */
+        void CreateGameObject(const Resource<Transform>& parent, const std::string& name,
+                              std::function<void(const Resource<GameObject>& gameObject)> onCreated = nullptr);
+
+        template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        void AddComponent(const Resource<GameObject>& gameObject);
+
+        void AddComponent(const Resource<GameObject>& gameObject, const std::type_info& type,
+                          Component::PhaseMask phases);
+
+        void Destroy(const Resource<GameObject>& gameObject);
+
+        bool IsEmpty() const;
+
+        /*
+         * Runs the recorded commands, the ones recorded while executing are run as well. If a command throws, the
+         * commands that did not run yet are dropped.
+         */
+        void Execute(Scene& scene);
+
+        void Clear();
+    };
+}
+
+#include "command_buffer.inl"
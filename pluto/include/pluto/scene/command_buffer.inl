@@ -0,0 +1,10 @@
+#pragma once
+
+namespace pluto
+{
+    template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    void CommandBuffer::AddComponent(const Resource<GameObject>& gameObject)
+    {
+        AddComponent(gameObject, typeid(T), Component::GetPhaseMask<T>());
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "pluto/scene/game_object.h"
+#include "pluto/memory/resource.h"
+#include "pluto/memory/object_handle.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace pluto
+{
+    class BaseComponentArray
+    {
+    public:
+        BaseComponentArray() = default;
+        virtual ~BaseComponentArray() = default;
+
+        BaseComponentArray(const BaseComponentArray& other) = delete;
+        BaseComponentArray(BaseComponentArray&& other) noexcept = delete;
+        BaseComponentArray& operator=(const BaseComponentArray& rhs) = delete;
+        BaseComponentArray& operator=(BaseComponentArray&& rhs) noexcept = delete;
+
+        virtual bool Has(ObjectHandle owner) const = 0;
+        virtual void Remove(ObjectHandle owner) = 0;
+    };
+
+    /*
+     * Plain data components of type T stored contiguously, meant to be iterated by systems.
+     * Removing swaps the last element into the hole, so indices and references are only stable until the next remove.
+     */
+    template <typename T>
+    class ComponentArray final : public BaseComponentArray
+    {
+        std::vector<T> components;
+        std::vector<Resource<GameObject>> owners;
+        std::unordered_map<ObjectHandle, size_t> indices;
+
+    public:
+        template <typename ... Args>
+        T& Add(const Resource<GameObject>& owner, Args&&... args);
+
+        T* Get(const Resource<GameObject>& owner);
+        const T* Get(const Resource<GameObject>& owner) const;
+
+        bool Has(ObjectHandle owner) const override;
+        void Remove(ObjectHandle owner) override;
+
+        size_t GetSize() const;
+
+        T& operator[](size_t index);
+        const T& operator[](size_t index) const;
+
+        const Resource<GameObject>& GetOwner(size_t index) const;
+
+        typename std::vector<T>::iterator begin();
+        typename std::vector<T>::iterator end();
+        typename std::vector<T>::const_iterator begin() const;
+        typename std::vector<T>::const_iterator end() const;
+
+        static std::unique_ptr<BaseComponentArray> Create();
+    };
+}
+
+#include "component_array.inl"
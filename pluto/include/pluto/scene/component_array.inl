@@ -0,0 +1,125 @@
+#pragma once
+
+#include "pluto/exception.h"
+
+#include <stdexcept>
+
+namespace pluto
+{
+    template <typename T>
+    template <typename ... Args>
+    T& ComponentArray<T>::Add(const Resource<GameObject>& owner, Args&&... args)
+    {
+        if (owner.Get() == nullptr)
+        {
+            Exception::Throw(std::runtime_error("Can not add a component to a game object that does not exist."));
+        }
+
+        const ObjectHandle handle = owner.GetHandle();
+        if (Has(handle))
+        {
+            Exception::Throw(std::runtime_error("Game object already has a component of this type."));
+        }
+
+        indices.emplace(handle, components.size());
+        owners.push_back(owner);
+        components.emplace_back(std::forward<Args>(args)...);
+        return components.back();
+    }
+
+    template <typename T>
+    T* ComponentArray<T>::Get(const Resource<GameObject>& owner)
+    {
+        const auto it = indices.find(owner.GetHandle());
+        return it == indices.end() ? nullptr : &components[it->second];
+    }
+
+    template <typename T>
+    const T* ComponentArray<T>::Get(const Resource<GameObject>& owner) const
+    {
+        const auto it = indices.find(owner.GetHandle());
+        return it == indices.end() ? nullptr : &components[it->second];
+    }
+
+    template <typename T>
+    bool ComponentArray<T>::Has(const ObjectHandle owner) const
+    {
+        return indices.find(owner) != indices.end();
+    }
+
+    template <typename T>
+    void ComponentArray<T>::Remove(const ObjectHandle owner)
+    {
+        const auto it = indices.find(owner);
+        if (it == indices.end())
+        {
+            return;
+        }
+
+        const size_t index = it->second;
+        const size_t lastIndex = components.size() - 1;
+        indices.erase(it);
+        if (index != lastIndex)
+        {
+            components[index] = std::move(components[lastIndex]);
+            owners[index] = owners[lastIndex];
+            indices[owners[index].GetHandle()] = index;
+        }
+        components.pop_back();
+        owners.pop_back();
+    }
+
+    template <typename T>
+    size_t ComponentArray<T>::GetSize() const
+    {
+        return components.size();
+    }
+
+    template <typename T>
+    T& ComponentArray<T>::operator[](const size_t index)
+    {
+        return components[index];
+    }
+
+    template <typename T>
+    const T& ComponentArray<T>::operator[](const size_t index) const
+    {
+        return components[index];
+    }
+
+    template <typename T>
+    const Resource<GameObject>& ComponentArray<T>::GetOwner(const size_t index) const
+    {
+        return owners[index];
+    }
+
+    template <typename T>
+    typename std::vector<T>::iterator ComponentArray<T>::begin()
+    {
+        return components.begin();
+    }
+
+    template <typename T>
+    typename std::vector<T>::iterator ComponentArray<T>::end()
+    {
+        return components.end();
+    }
+
+    template <typename T>
+    typename std::vector<T>::const_iterator ComponentArray<T>::begin() const
+    {
+        return components.begin();
+    }
+
+    template <typename T>
+    typename std::vector<T>::const_iterator ComponentArray<T>::end() const
+    {
+        return components.end();
+    }
+
+    template <typename T>
+    std::unique_ptr<BaseComponentArray> ComponentArray<T>::Create()
+    {
+        return std::make_unique<ComponentArray<T>>();
+    }
+}
@@ -28,7 +28,15 @@ namespace pluto
         Behaviour& operator=(const Behaviour& rhs) = delete;
         Behaviour& operator=(Behaviour&& rhs) noexcept;
 
+        /*
+         * Parallel safe behaviours have their OnUpdate spread across the job system workers. They may only change
+         * their own state and their own transform, must not read what other parallel behaviours write and have to
+         * go through the scene command buffer to add components, create or destroy game objects.
+         */
+        bool IsParallelSafe() const;
+
     protected:
         explicit Behaviour(const Resource<GameObject>& gameObject);
+        Behaviour(const Resource<GameObject>& gameObject, bool isParallelSafe);
     };
 }
@@ -3,14 +3,17 @@
 #include "pluto/service/base_factory.h"
 #include "pluto/memory/object.h"
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
 
 namespace pluto
 {
     template <typename T, typename Enable = void>
     class Resource;
 
-    class Guid;
     class GameObject;
     class Collision2D;
     class Collider2D;
@@ -18,6 +21,32 @@ namespace pluto
     class PLUTO_API Component : public Object
     {
     public:
+        enum class Phase
+        {
+            EarlyFixedUpdate = 0,
+            FixedUpdate = 1,
+            LateFixedUpdate = 2,
+            EarlyUpdate = 3,
+            Update = 4,
+            LateUpdate = 5,
+            PreRender = 6,
+            Render = 7,
+            PostRender = 8,
+        };
+
+        using PhaseMask = uint16_t;
+
+        static constexpr size_t PHASE_COUNT = 9;
+        static constexpr PhaseMask ALL_PHASES = (1u << PHASE_COUNT) - 1;
+
+        using TypeTest = bool(*)(const Component& component);
+
+        struct RegisteredType
+        {
+            const std::type_info* type;
+            PhaseMask phases;
+        };
+
         class PLUTO_API Factory : public BaseFactory
         {
         public:
@@ -40,7 +69,6 @@ namespace pluto
         Component& operator=(const Component& rhs) = delete;
         Component& operator=(Component&& rhs) noexcept;
 
-        const Guid& GetId() const override;
         const std::string& GetName() const override;
         void SetName(const std::string& value) override;
 
@@ -64,6 +92,58 @@ namespace pluto
         virtual void OnRender();
         virtual void OnPostRender();
 
+        virtual void OnEnable();
+        virtual void OnDisable();
+
+        /*
+         * Called when the game object is taken from or returned to a scene pool, instead of being created or
+         * destroyed. Components reset their state here.
+         */
+        virtual void OnSpawn();
+        virtual void OnDespawn();
+
         virtual void OnDestroy();
+
+        /*
+         * Phases whose hook is overridden by T, the scene only calls a component on the phases in its mask.
+         */
+        template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        static constexpr PhaseMask GetPhaseMask();
+
+        /*
+         * Dense id of a component type, game objects and scenes index their components by it.
+         */
+        template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        static size_t GetTypeId();
+
+        static size_t GetTypeId(const std::type_info& type);
+
+        template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        static bool IsInstanceOf(const Component& component);
+
+        /*
+         * Whether components of the type typeId are also of the type baseTypeId. The test is only run once on the
+         * sample for each pair of types, the answer is kept in a table that is read without locking.
+         */
+        static bool IsTypeOf(size_t typeId, size_t baseTypeId, const Component& sample, TypeTest test);
+
+        /*
+         * Assets such as prefabs reference component types by name, only the registered types can be resolved.
+         */
+        template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        static void RegisterType(const std::string& name);
+
+        static void RegisterType(const std::string& name, const std::type_info& type, PhaseMask phases);
+
+        /*
+         * Null when no type is registered with the name.
+         */
+        static const RegisteredType* FindType(const std::string& name);
+
+    private:
+        template <typename Method>
+        static constexpr PhaseMask GetPhaseBit(Phase phase);
     };
 }
+
+#include "component.inl"
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "pluto/type_registry.h"
+
+namespace pluto
+{
+    template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    constexpr Component::PhaseMask Component::GetPhaseMask()
+    {
+        return GetPhaseBit<decltype(&T::OnEarlyFixedUpdate)>(Phase::EarlyFixedUpdate)
+            | GetPhaseBit<decltype(&T::OnFixedUpdate)>(Phase::FixedUpdate)
+            | GetPhaseBit<decltype(&T::OnLateFixedUpdate)>(Phase::LateFixedUpdate)
+            | GetPhaseBit<decltype(&T::OnEarlyUpdate)>(Phase::EarlyUpdate)
+            | GetPhaseBit<decltype(&T::OnUpdate)>(Phase::Update)
+            | GetPhaseBit<decltype(&T::OnLateUpdate)>(Phase::LateUpdate)
+            | GetPhaseBit<decltype(&T::OnPreRender)>(Phase::PreRender)
+            | GetPhaseBit<decltype(&T::OnRender)>(Phase::Render)
+            | GetPhaseBit<decltype(&T::OnPostRender)>(Phase::PostRender);
+    }
+
+    template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    size_t Component::GetTypeId()
+    {
+        return TypeRegistry::GetId<Component, T>();
+    }
+
+    template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    bool Component::IsInstanceOf(const Component& component)
+    {
+        return dynamic_cast<const T*>(&component) != nullptr;
+    }
+
+    template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    void Component::RegisterType(const std::string& name)
+    {
+        RegisterType(name, typeid(T), GetPhaseMask<T>());
+    }
+
+    template <typename Method>
+    constexpr Component::PhaseMask Component::GetPhaseBit(const Phase phase)
+    {
+        // Hooks that are not overridden are still found through Component, overridden ones through a derived class.
+        return std::is_same_v<Method, void(Component::*)()> ? 0 : static_cast<PhaseMask>(1u << static_cast<int>(phase));
+    }
+}
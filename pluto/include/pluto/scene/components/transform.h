@@ -42,6 +42,11 @@ namespace pluto
 
         const std::vector<Resource<Transform>>& GetChildren() const;
 
+        /*
+         * Called by the scene before it frees destroyed game objects, drops the destroyed children from the list.
+         */
+        void RemoveDestroyedChildren();
+
         Resource<Transform> FindChild(const std::string& name) const;
 
         const Vector3F& GetLocalPosition() const;
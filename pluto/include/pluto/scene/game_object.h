@@ -2,7 +2,9 @@
 
 #include "pluto/service/base_factory.h"
 #include "pluto/memory/object.h"
+#include "pluto/scene/components/component.h"
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -13,9 +15,8 @@ namespace pluto
     template <typename T, typename Enable = void>
     class Resource;
 
-    class Guid;
+    class Scene;
     class Transform;
-    class Component;
 
     class Collision2D;
     class Collider2D;
@@ -29,6 +30,14 @@ namespace pluto
             Static = 1,
         };
 
+        using TagMask = uint32_t;
+        using LayerMask = uint32_t;
+
+        static constexpr uint8_t TAG_COUNT = 32;
+        static constexpr uint8_t LAYER_COUNT = 32;
+
+        static constexpr uint32_t NO_POOL = UINT32_MAX;
+
         class PLUTO_API Factory final : public BaseFactory
         {
         public:
@@ -49,9 +58,9 @@ namespace pluto
         GameObject& operator=(const GameObject& rhs) = delete;
         GameObject& operator=(GameObject&& rhs) noexcept;
 
-        const Guid& GetId() const override;
         const std::string& GetName() const override;
         void SetName(const std::string& value) override;
+        size_t GetImplAllocationSize() const override;
 
         bool IsGloballyActive() const;
         bool IsActive() const;
@@ -60,6 +69,30 @@ namespace pluto
         Flags GetFlags() const;
         bool IsDestroyed() const;
 
+        TagMask GetTags() const;
+        bool HasTags(TagMask tags) const;
+        void SetTags(TagMask value);
+
+        uint8_t GetLayer() const;
+        void SetLayer(uint8_t value);
+
+        Scene* GetScene() const;
+
+        /*
+         * Scene pool the game object was spawned from, or NO_POOL.
+         */
+        uint32_t GetPool() const;
+
+        /*
+         * Whether the game object, or the pooled hierarchy it belongs to, is waiting in its pool to be spawned again.
+         */
+        bool IsDespawned() const;
+
+        /*
+         * Components added before the game object had a scene are registered when it is set.
+         */
+        void SetScene(Scene& scene);
+
         Resource<Transform> GetTransform() const;
 
         template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
@@ -67,31 +100,72 @@ namespace pluto
 
         Resource<Component> AddComponent(const std::type_info& type);
 
+        Resource<Component> AddComponent(const std::type_info& type, Component::PhaseMask phases);
+
         template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
         Resource<T> GetComponent() const;
 
         Resource<Component> GetComponent(const std::function<bool(const Component& component)>& predicate) const;
 
+        /*
+         * Only the components whose type is typeId or derives from it, test is used the first time a type is seen.
+         */
+        Resource<Component> GetComponent(size_t typeId, Component::TypeTest test) const;
+
         template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
         std::vector<Resource<T>> GetComponents() const;
 
         std::vector<Resource<Component>> GetComponents(
             const std::function<bool(const Component& component)>& predicate) const;
 
+        void ForEachComponent(size_t typeId, Component::TypeTest test,
+                              const std::function<void(const Resource<Component>& component)>& callback) const;
+
         template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
         Resource<T> GetComponentInChildren() const;
 
         Resource<Component> GetComponentInChildren(
             const std::function<bool(const Component& component)>& predicate) const;
 
+        Resource<Component> GetComponentInChildren(size_t typeId, Component::TypeTest test) const;
+
         template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
         std::vector<Resource<T>> GetComponentsInChildren() const;
 
         std::vector<Resource<Component>> GetComponentsInChildren(
             const std::function<bool(const Component& component)>& predicate) const;
 
+        template <typename T,
+                  typename Allocator,
+                  std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        void GetComponentsInChildren(std::vector<Resource<T>, Allocator>& result) const;
+
+        void ForEachComponentInChildren(const std::function<void(const Resource<Component>& component)>& callback) const;
+
+        void ForEachComponentInChildren(
+            size_t typeId, Component::TypeTest test,
+            const std::function<void(const Resource<Component>& component)>& callback) const;
+
         void Destroy();
 
+        /*
+         * Called by the transform when its parent changes, the active state of the hierarchy is cached.
+         */
+        void OnParentChanged();
+
+        /*
+         * Called by the scene when the game object is taken from or returned to a pool, the components of the whole
+         * hierarchy are notified.
+         */
+        void OnSpawn(uint32_t pool);
+        void OnDespawn();
+
+        /*
+         * Called by the scene when the game object is created to fill a pool, it is parked as despawned without
+         * notifying its components.
+         */
+        void OnPooled(uint32_t pool);
+
         void OnEarlyFixedUpdate();
         void OnFixedUpdate();
         void OnLateFixedUpdate();
@@ -7,55 +7,48 @@ namespace pluto
     template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
     Resource<T> GameObject::AddComponent()
     {
-        return ResourceUtils::Cast<T>(AddComponent(typeid(T)));
+        return ResourceUtils::Cast<T>(AddComponent(typeid(T), Component::GetPhaseMask<T>()));
     }
 
     template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
     Resource<T> GameObject::GetComponent() const
     {
-        return ResourceUtils::Cast<T>(GetComponent([](const Component& component)
-        {
-            return dynamic_cast<const T*>(&component) != nullptr;
-        }));
+        return ResourceUtils::Cast<T>(GetComponent(Component::GetTypeId<T>(), &Component::IsInstanceOf<T>));
     }
 
     template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
     std::vector<Resource<T>> GameObject::GetComponents() const
     {
-        std::vector<Resource<Component>> components = GetComponents([](const Component& component)
-        {
-            return dynamic_cast<const T*>(&component) != nullptr;
-        });
         std::vector<Resource<T>> result;
-        for (auto& it : components)
-        {
-            result.emplace_back(ResourceUtils::Cast<T>(it));
-        }
+        ForEachComponent(Component::GetTypeId<T>(), &Component::IsInstanceOf<T>,
+                         [&result](const Resource<Component>& component)
+                         {
+                             result.emplace_back(ResourceUtils::Cast<T>(component));
+                         });
         return result;
     }
 
     template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
     Resource<T> GameObject::GetComponentInChildren() const
     {
-        return ResourceUtils::Cast<T>(GetComponentInChildren([](const Component& component)
-        {
-            return dynamic_cast<const T*>(&component) != nullptr;
-        }));
+        return ResourceUtils::Cast<T>(GetComponentInChildren(Component::GetTypeId<T>(), &Component::IsInstanceOf<T>));
     }
 
     template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
     std::vector<Resource<T>> GameObject::GetComponentsInChildren() const
     {
-        std::vector<Resource<Component>> components = GetComponentsInChildren(
-            [](const Component& component)
-            {
-                return dynamic_cast<const T*>(&component) != nullptr;
-            });
         std::vector<Resource<T>> result;
-        for (auto& it : components)
-        {
-            result.emplace_back(ResourceUtils::Cast<T>(it));
-        }
+        GetComponentsInChildren(result);
         return result;
     }
+
+    template <typename T, typename Allocator, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    void GameObject::GetComponentsInChildren(std::vector<Resource<T>, Allocator>& result) const
+    {
+        ForEachComponentInChildren(Component::GetTypeId<T>(), &Component::IsInstanceOf<T>,
+                                   [&result](const Resource<Component>& component)
+                                   {
+                                       result.emplace_back(ResourceUtils::Cast<T>(component));
+                                   });
+    }
 }
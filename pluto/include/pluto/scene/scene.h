@@ -1,22 +1,38 @@
 #pragma once
 
 #include "pluto/service/base_factory.h"
+#include "pluto/scene/game_object.h"
+#include "pluto/scene/components/component.h"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace pluto
 {
     template <typename T, typename Enable = void>
     class Resource;
 
-    class Guid;
+    class RuntimeId;
     class GameObject;
     class Transform;
+    class PrefabAsset;
+    class SceneAsset;
+    class TransformHierarchy;
+    class CommandBuffer;
+    class System;
+    class BaseComponentArray;
+
+    template <typename T>
+    class ComponentArray;
 
     class PLUTO_API Scene
     {
     public:
+        using PoolFunction = std::function<Resource<GameObject>(Scene& scene)>;
+
         class PLUTO_API Factory final : public BaseFactory
         {
         public:
@@ -37,7 +53,7 @@ namespace pluto
         Scene& operator=(const Scene& rhs) = delete;
         Scene& operator=(Scene&& rhs) noexcept;
 
-        const Guid& GetId() const;
+        RuntimeId GetId() const;
 
         Resource<GameObject> GetRootGameObject() const;
 
@@ -46,10 +62,112 @@ namespace pluto
         Resource<GameObject> CreateGameObject(const Resource<Transform>& parent);
         Resource<GameObject> CreateGameObject(const Resource<Transform>& parent, const std::string& name);
 
+        /*
+         * Lookups skip destroyed game objects and the ones waiting in a scene pool.
+         */
         Resource<GameObject> FindGameObject(const std::string& name) const;
 
+        void FindGameObjects(const std::string& name, std::vector<Resource<GameObject>>& result) const;
+
+        /*
+         * Game objects that have all the given tags.
+         */
+        void FindGameObjectsWithTags(GameObject::TagMask tags, std::vector<Resource<GameObject>>& result) const;
+
+        void FindGameObjectsInLayers(GameObject::LayerMask layers, std::vector<Resource<GameObject>>& result) const;
+
         void Destroy();
 
+        /*
+         * Builds a copy of the prefab hierarchy under parent and returns its root.
+         */
+        Resource<GameObject> Instantiate(const Resource<PrefabAsset>& prefab);
+        Resource<GameObject> Instantiate(const Resource<PrefabAsset>& prefab, const Resource<Transform>& parent);
+
+        /*
+         * Builds count copies of the prefab at once, the storage for all of them is sized up front. The roots of the
+         * copies are appended to result.
+         */
+        void Instantiate(const Resource<PrefabAsset>& prefab, size_t count, const Resource<Transform>& parent,
+                         std::vector<Resource<GameObject>>& result);
+
+        /*
+         * Builds the next count game objects of the scene asset. loadedGameObjects holds the ones built so far, in the
+         * asset order, and the new ones are appended to it. Calling it once a frame spreads a big scene over frames.
+         */
+        void LoadGameObjects(const SceneAsset& sceneAsset, size_t count,
+                             std::vector<Resource<GameObject>>& loadedGameObjects);
+
+        /*
+         * Pools recycle whole game object hierarchies instead of destroying them. create builds a new instance when
+         * the pool runs out, capacity instances are built up front so spawning does not allocate afterwards.
+         */
+        uint32_t CreatePool(PoolFunction create, size_t capacity);
+
+        /*
+         * Takes a game object from the pool and activates it under parent, its components are called OnSpawn.
+         */
+        Resource<GameObject> Spawn(uint32_t pool);
+        Resource<GameObject> Spawn(uint32_t pool, const Resource<Transform>& parent);
+
+        /*
+         * Deactivates the game object and returns it to its pool, game objects that were not spawned are destroyed.
+         */
+        void Despawn(const Resource<GameObject>& gameObject);
+
+        TransformHierarchy& GetTransformHierarchy();
+
+        /*
+         * True while the parallel safe behaviours are being updated, structural changes have to be recorded in the
+         * command buffer meanwhile. It is executed right after the parallel phase.
+         */
+        bool IsRunningParallelPhase() const;
+        CommandBuffer& GetCommandBuffer();
+
+        /*
+         * Storage of the plain data components of type T, created the first time it is requested.
+         */
+        template <typename T>
+        ComponentArray<T>& GetComponentArray();
+
+        BaseComponentArray& GetComponentArray(size_t typeId, std::unique_ptr<BaseComponentArray> (*factory)());
+
+        template <typename T, typename ... Args, std::enable_if_t<std::is_base_of_v<System, T>, bool>  = false>
+        T& AddSystem(Args&&... args);
+
+        System& AddSystem(std::unique_ptr<System> system);
+
+        /*
+         * Called by the game object when a component is added, the component is only updated on the given phases.
+         */
+        void RegisterComponent(const Resource<Component>& component, GameObject& gameObject, size_t typeId,
+                               Component::PhaseMask phases);
+
+        size_t GetComponentTypeCount() const;
+
+        /*
+         * Components of exactly the type typeId, including the ones of inactive game objects.
+         */
+        const std::vector<Resource<Component>>& GetComponentsOfType(size_t typeId) const;
+
+        /*
+         * First component of type T on an active game object, without walking the hierarchy.
+         */
+        template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        Resource<T> FindComponent() const;
+
+        template <typename T,
+                  typename Allocator,
+                  std::enable_if_t<std::is_base_of_v<Component, T>, bool>  = false>
+        void FindComponents(std::vector<Resource<T>, Allocator>& result) const;
+
+        /*
+         * Called by the game object when its name, tags or layer change, the scene indexes its game objects by them.
+         */
+        void OnGameObjectRenamed(GameObject& gameObject, const std::string& previousName);
+        void OnGameObjectTagsChanged(GameObject& gameObject, GameObject::TagMask previousTags);
+        void OnGameObjectLayerChanged(GameObject& gameObject, uint8_t previousLayer);
+
         void OnEarlyFixedUpdate();
         void OnFixedUpdate();
         void OnLateFixedUpdate();
@@ -65,3 +183,5 @@ namespace pluto
         void Cleanup();
     };
 }
+
+#include "scene.inl"
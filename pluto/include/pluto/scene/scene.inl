@@ -0,0 +1,72 @@
+#pragma once
+
+#include "component_array.h"
+#include "game_object.h"
+#include "system.h"
+#include "pluto/memory/resource.h"
+#include "pluto/type_registry.h"
+
+namespace pluto
+{
+    template <typename T>
+    ComponentArray<T>& Scene::GetComponentArray()
+    {
+        const size_t typeId = TypeRegistry::GetId<BaseComponentArray, T>();
+        return static_cast<ComponentArray<T>&>(GetComponentArray(typeId, &ComponentArray<T>::Create));
+    }
+
+    template <typename T, typename ... Args, std::enable_if_t<std::is_base_of_v<System, T>, bool>>
+    T& Scene::AddSystem(Args&&... args)
+    {
+        return static_cast<T&>(AddSystem(std::make_unique<T>(std::forward<Args>(args)...)));
+    }
+
+    template <typename T, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    Resource<T> Scene::FindComponent() const
+    {
+        const size_t baseTypeId = Component::GetTypeId<T>();
+        const size_t typeCount = GetComponentTypeCount();
+        for (size_t typeId = 0; typeId < typeCount; ++typeId)
+        {
+            const auto& components = GetComponentsOfType(typeId);
+            if (components.empty() || !Component::IsTypeOf(typeId, baseTypeId, *components.front().Get(),
+                                                            &Component::IsInstanceOf<T>))
+            {
+                continue;
+            }
+
+            for (const auto& component : components)
+            {
+                if (component->GetGameObject()->IsGloballyActive())
+                {
+                    return ResourceUtils::Cast<T>(component);
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T, typename Allocator, std::enable_if_t<std::is_base_of_v<Component, T>, bool>>
+    void Scene::FindComponents(std::vector<Resource<T>, Allocator>& result) const
+    {
+        const size_t baseTypeId = Component::GetTypeId<T>();
+        const size_t typeCount = GetComponentTypeCount();
+        for (size_t typeId = 0; typeId < typeCount; ++typeId)
+        {
+            const auto& components = GetComponentsOfType(typeId);
+            if (components.empty() || !Component::IsTypeOf(typeId, baseTypeId, *components.front().Get(),
+                                                            &Component::IsInstanceOf<T>))
+            {
+                continue;
+            }
+
+            for (const auto& component : components)
+            {
+                if (component->GetGameObject()->IsGloballyActive())
+                {
+                    result.emplace_back(ResourceUtils::Cast<T>(component));
+                }
+            }
+        }
+    }
+}
@@ -7,8 +7,12 @@
 
 namespace pluto
 {
+    template <typename T, typename Enable = void>
+    class Resource;
+
     class Scene;
     class GameObject;
+    class SceneAsset;
 
     class PLUTO_API SceneManager final : public BaseService
     {
@@ -36,5 +40,12 @@ namespace pluto
         Scene& GetActiveScene() const;
 
         void LoadEmptyScene();
+
+        /*
+         * The scene is built over several frames, a fixed number of game objects each frame. OnSceneLoadedEvent is
+         * dispatched once all of them were built.
+         */
+        void LoadScene(const Resource<SceneAsset>& sceneAsset);
+        bool IsLoadingScene() const;
     };
 }
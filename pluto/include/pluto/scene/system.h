@@ -0,0 +1,35 @@
+#pragma once
+
+#include "pluto/api.h"
+
+namespace pluto
+{
+    class Scene;
+
+    /*
+     * Updates the components stored in the scene component arrays, called after the game objects on every phase.
+     */
+    class PLUTO_API System
+    {
+    public:
+        virtual ~System() = 0;
+        System();
+
+        System(const System& other) = delete;
+        System(System&& other) noexcept;
+        System& operator=(const System& rhs) = delete;
+        System& operator=(System&& rhs) noexcept;
+
+        virtual void OnEarlyFixedUpdate(Scene& scene);
+        virtual void OnFixedUpdate(Scene& scene);
+        virtual void OnLateFixedUpdate(Scene& scene);
+
+        virtual void OnEarlyUpdate(Scene& scene);
+        virtual void OnUpdate(Scene& scene);
+        virtual void OnLateUpdate(Scene& scene);
+
+        virtual void OnPreRender(Scene& scene);
+        virtual void OnRender(Scene& scene);
+        virtual void OnPostRender(Scene& scene);
+    };
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "pluto/api.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace pluto
+{
+    class Vector3F;
+    class Quaternion;
+    class Matrix4X4;
+
+    /*
+     * Transform data of a scene stored as parallel arrays. Nodes are kept ordered so that a parent always comes before
+     * its children, letting every changed world matrix be updated in a single linear pass.
+     */
+    class PLUTO_API TransformHierarchy
+    {
+    public:
+        using NodeId = uint32_t;
+        static constexpr NodeId NONE = UINT32_MAX;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> impl;
+
+    public:
+        ~TransformHierarchy();
+        TransformHierarchy();
+
+        TransformHierarchy(const TransformHierarchy& other) = delete;
+        TransformHierarchy(TransformHierarchy&& other) noexcept;
+        TransformHierarchy& operator=(const TransformHierarchy& rhs) = delete;
+        TransformHierarchy& operator=(TransformHierarchy&& rhs) noexcept;
+
+        NodeId CreateNode();
+        void DestroyNode(NodeId node);
+
+        size_t GetNodeCount() const;
+
+        /*
+         * Makes room for count more nodes.
+         */
+        void Reserve(size_t count);
+
+        NodeId GetParent(NodeId node) const;
+        void SetParent(NodeId node, NodeId parent);
+
+        const Vector3F& GetLocalPosition(NodeId node) const;
+        void SetLocalPosition(NodeId node, const Vector3F& value);
+
+        const Quaternion& GetLocalRotation(NodeId node) const;
+        void SetLocalRotation(NodeId node, const Quaternion& value);
+
+        const Vector3F& GetLocalScale(NodeId node) const;
+        void SetLocalScale(NodeId node, const Vector3F& value);
+
+        const Matrix4X4& GetLocalMatrix(NodeId node);
+
+        /*
+         * Up to date even before the next update, only the ancestors of the node are recomputed if needed. Only the
+         * matrix of the node itself is written, so behaviours can read their own one from several threads.
+         */
+        const Matrix4X4& GetWorldMatrix(NodeId node);
+
+        /*
+         * Recomputes the world matrix of every node that changed, or has an ancestor that changed, since the last call.
+         */
+        void UpdateWorldMatrices();
+    };
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "api.h"
+#include <cstddef>
+#include <typeinfo>
+
+namespace pluto
+{
+    /*
+     * Dense ids for types, shared by every module. Each domain numbers its types from zero, in the order they are
+     * first seen, so ids can index flat arrays.
+     */
+    class PLUTO_API TypeRegistry
+    {
+    public:
+        static size_t GetId(const std::type_info& domain, const std::type_info& type);
+
+        template <typename Domain, typename T>
+        static size_t GetId();
+    };
+}
+
+#include "type_registry.inl"
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace pluto
+{
+    template <typename Domain, typename T>
+    size_t TypeRegistry::GetId()
+    {
+        // Each module gets its own copy of this static, the registry keeps the id the same across all of them.
+        static const size_t id = GetId(typeid(Domain), typeid(T));
+        return id;
+    }
+}
@@ -7,6 +7,8 @@
 #include <pluto/asset/shader_asset.h>
 #include <pluto/asset/material_asset.h>
 #include <pluto/asset/texture_asset.h>
+#include <pluto/asset/prefab_asset.h>
+#include <pluto/asset/scene_asset.h>
 #include <pluto/service/service_collection.h>
 
 namespace pluto
@@ -21,6 +23,8 @@ namespace pluto
         serviceCollection.AddFactory<MaterialAsset>(std::make_unique<MaterialAsset::Factory>(serviceCollection));
         serviceCollection.AddFactory<TextureAsset>(std::make_unique<TextureAsset::Factory>(serviceCollection));
         serviceCollection.EmplaceFactory<FontAsset, FontAsset::Factory>();
+        serviceCollection.EmplaceFactory<PrefabAsset, PrefabAsset::Factory>();
+        serviceCollection.EmplaceFactory<SceneAsset, SceneAsset::Factory>();
 
         serviceCollection.AddService(AssetManager::Factory(serviceCollection).Create());
     }
@@ -28,6 +32,8 @@ namespace pluto
     void AssetInstaller::Uninstall(ServiceCollection& serviceCollection)
     {
         serviceCollection.RemoveService<AssetManager>();
+        serviceCollection.RemoveFactory<SceneAsset>();
+        serviceCollection.RemoveFactory<PrefabAsset>();
         serviceCollection.RemoveFactory<FontAsset>();
         serviceCollection.RemoveFactory<TextureAsset>();
         serviceCollection.RemoveFactory<MaterialAsset>();
@@ -119,7 +119,7 @@ namespace pluto
                 manifests.erase(asset.GetName());
             }
 
-            eventManager->Dispatch(OnAssetUnloadEvent(asset));
+            eventManager->Dispatch<OnAssetUnloadEvent>(asset);
             memoryManager->Remove(asset);
         }
 
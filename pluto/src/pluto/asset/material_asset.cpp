@@ -24,25 +24,52 @@
 #include <fmt/format.h>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace pluto
 {
     class MaterialAsset::Impl
     {
+    public:
+        // Material properties are the uniforms of the shader under this struct, files store names without it.
+        static constexpr char PROPERTY_PREFIX[] = "u_mat.";
+
+        enum class Storage
+        {
+            None,
+            Float,
+            Vector,
+            Matrix,
+            Texture,
+        };
+
+    private:
+        struct Slot
+        {
+            Storage storage;
+            size_t index;
+            uint32_t revision;
+        };
+
         Guid guid;
         std::string name;
         Resource<ShaderAsset> shaderAsset;
-        std::unordered_map<std::string, float> floats;
-        std::unordered_map<std::string, Vector4F> vectors;
-        std::unordered_map<std::string, Matrix4X4> matrices;
-        std::unordered_map<std::string, Resource<TextureAsset>> textures;
+
+        uint32_t revision;
+        std::vector<Slot> slots;
+        std::unordered_map<std::string, size_t> slotIndices;
+        std::vector<float> floats;
+        std::vector<Vector4F> vectors;
+        std::vector<Matrix4X4> matrices;
+        std::vector<Resource<TextureAsset>> textures;
 
     public:
         Impl(const Guid& guid, Resource<ShaderAsset> shaderAsset)
             : guid(guid),
-              shaderAsset(std::move(shaderAsset))
+              shaderAsset(std::move(shaderAsset)),
+              revision(0)
         {
-            UpdateProperties();
+            UpdateSlots();
         }
 
         const Guid& GetId() const
@@ -75,46 +102,26 @@ namespace pluto
             Guid shaderGuid = shaderAsset.GetObjectId();
             fileWriter.Write(&shaderGuid, sizeof(Guid));
 
-            uint8_t floatsCount = floats.size();
-            fileWriter.Write(&floatsCount, sizeof(uint8_t));
-            for (const auto& it : floats)
+            DumpProperties(fileWriter, Storage::Float, [this](const Slot& slot, FileStreamWriter& writer)
             {
-                uint8_t uniformNameLength = it.first.size();
-                fileWriter.Write(&uniformNameLength, sizeof(uint8_t));
-                fileWriter.Write(it.first.data(), uniformNameLength);
-                fileWriter.Write(&it.second, sizeof(float));
-            }
+                writer.Write(&floats[slot.index], sizeof(float));
+            });
 
-            uint8_t vectorsCount = vectors.size();
-            fileWriter.Write(&vectorsCount, sizeof(uint8_t));
-            for (const auto& it : vectors)
+            DumpProperties(fileWriter, Storage::Vector, [this](const Slot& slot, FileStreamWriter& writer)
             {
-                uint8_t uniformNameLength = it.first.size();
-                fileWriter.Write(&uniformNameLength, sizeof(uint8_t));
-                fileWriter.Write(it.first.data(), uniformNameLength);
-                fileWriter.Write(&it.second, sizeof(Vector4F));
-            }
+                writer.Write(&vectors[slot.index], sizeof(Vector4F));
+            });
 
-            uint8_t matricesCount = matrices.size();
-            fileWriter.Write(&matricesCount, sizeof(uint8_t));
-            for (const auto& it : matrices)
+            DumpProperties(fileWriter, Storage::Matrix, [this](const Slot& slot, FileStreamWriter& writer)
             {
-                uint8_t uniformNameLength = it.first.size();
-                fileWriter.Write(&uniformNameLength, sizeof(uint8_t));
-                fileWriter.Write(it.first.data(), uniformNameLength);
-                fileWriter.Write(&it.second, sizeof(Matrix4X4));
-            }
+                writer.Write(&matrices[slot.index], sizeof(Matrix4X4));
+            });
 
-            uint8_t texturesCount = textures.size();
-            fileWriter.Write(&texturesCount, sizeof(uint8_t));
-            for (const auto& it : textures)
+            DumpProperties(fileWriter, Storage::Texture, [this](const Slot& slot, FileStreamWriter& writer)
             {
-                uint8_t uniformNameLength = it.first.size();
-                fileWriter.Write(&uniformNameLength, sizeof(uint8_t));
-                fileWriter.Write(it.first.data(), uniformNameLength);
-                Guid textureGuid = it.second.GetObjectId();
-                fileWriter.Write(&textureGuid, sizeof(Guid));
-            }
+                Guid textureGuid = textures[slot.index].GetObjectId();
+                writer.Write(&textureGuid, sizeof(Guid));
+            });
         }
 
         Resource<ShaderAsset> GetShader() const
@@ -125,147 +132,295 @@ namespace pluto
         void SetShader(const Resource<ShaderAsset>& value)
         {
             shaderAsset = value;
-            UpdateProperties();
+            UpdateSlots();
+        }
+
+        size_t FindSlot(const std::string& propertyName) const
+        {
+            const auto it = slotIndices.find(propertyName);
+            return it == slotIndices.end() ? NO_SLOT : it->second;
+        }
+
+        size_t FindSlot(const std::string& propertyName, const Storage storage) const
+        {
+            const size_t slot = FindSlot(propertyName);
+            return slot != NO_SLOT && slots[slot].storage == storage ? slot : NO_SLOT;
         }
 
         float GetFloat(const std::string& propertyName) const
         {
-            const auto it = floats.find(propertyName);
-            if (it == floats.end())
-            {
-                Exception::Throw(std::runtime_error(
-                    fmt::format("The {0} property with name {1} not found in material {2}.", typeid(Matrix4X4).name(),
-                                propertyName, name)));
-            }
-            return it->second;
+            return GetFloat(GetSlot<float>(propertyName, Storage::Float));
+        }
+
+        float GetFloat(const size_t slot) const
+        {
+            return floats[slots[slot].index];
         }
 
         void SetFloat(const std::string& propertyName, const float value)
         {
-            const auto it = floats.find(propertyName);
-            if (it != floats.end())
-            {
-                it->second = value;
-                return;
-            }
+            SetFloat(GetSlotToSet<float>(propertyName, Storage::Float), value);
+        }
 
-            floats.emplace(propertyName, value);
+        void SetFloat(const size_t slot, const float value)
+        {
+            floats[slots[slot].index] = value;
+            MarkChanged(slot);
         }
 
         const Vector4F& GetVector4F(const std::string& propertyName) const
         {
-            const auto it = vectors.find(propertyName);
-            if (it == vectors.end())
-            {
-                Exception::Throw(std::runtime_error(
-                    fmt::format("The {0} property with name {1} not found in material {2}.", typeid(Vector4F).name(),
-                                propertyName, name)));
-            }
-            return it->second;
+            return GetVector4F(GetSlot<Vector4F>(propertyName, Storage::Vector));
+        }
+
+        const Vector4F& GetVector4F(const size_t slot) const
+        {
+            return vectors[slots[slot].index];
         }
 
         void SetVector4F(const std::string& propertyName, const Vector4F& value)
         {
-            auto it = vectors.find(propertyName);
-            if (it != vectors.end())
-            {
-                it->second = value;
-                return;
-            }
+            SetVector4F(GetSlotToSet<Vector4F>(propertyName, Storage::Vector), value);
+        }
 
-            vectors.emplace(propertyName, value);
+        void SetVector4F(const size_t slot, const Vector4F& value)
+        {
+            vectors[slots[slot].index] = value;
+            MarkChanged(slot);
         }
 
         const Matrix4X4& GetMatrix4X4(const std::string& propertyName) const
         {
-            const auto it = matrices.find(propertyName);
-            if (it == matrices.end())
-            {
-                Exception::Throw(std::runtime_error(
-                    fmt::format("The {0} property with name {1} not found in material {2}.", typeid(Matrix4X4).name(),
-                                propertyName, name)));
-            }
-            return it->second;
+            return GetMatrix4X4(GetSlot<Matrix4X4>(propertyName, Storage::Matrix));
+        }
+
+        const Matrix4X4& GetMatrix4X4(const size_t slot) const
+        {
+            return matrices[slots[slot].index];
         }
 
         void SetMatrix4X4(const std::string& propertyName, const Matrix4X4& value)
         {
-            auto it = matrices.find(propertyName);
-            if (it != matrices.end())
-            {
-                it->second = value;
-                return;
-            }
+            SetMatrix4X4(GetSlotToSet<Matrix4X4>(propertyName, Storage::Matrix), value);
+        }
 
-            matrices.emplace(propertyName, value);
+        void SetMatrix4X4(const size_t slot, const Matrix4X4& value)
+        {
+            matrices[slots[slot].index] = value;
+            MarkChanged(slot);
         }
 
         Resource<TextureAsset> GetTexture(const std::string& propertyName) const
         {
-            const auto it = textures.find(propertyName);
-            if (it == textures.end())
+            return GetTexture(GetSlot<TextureAsset>(propertyName, Storage::Texture));
+        }
+
+        Resource<TextureAsset> GetTexture(const size_t slot) const
+        {
+            return textures[slots[slot].index];
+        }
+
+        void SetTexture(const std::string& propertyName, const Resource<TextureAsset>& textureAsset)
+        {
+            SetTexture(GetSlotToSet<TextureAsset>(propertyName, Storage::Texture), textureAsset);
+        }
+
+        void SetTexture(const size_t slot, const Resource<TextureAsset>& textureAsset)
+        {
+            textures[slots[slot].index] = textureAsset;
+            MarkChanged(slot);
+        }
+
+        uint32_t GetRevision() const
+        {
+            return revision;
+        }
+
+        uint32_t GetSlotRevision(const size_t slot) const
+        {
+            return slots[slot].revision;
+        }
+
+        void Clone(const Impl& other)
+        {
+            name = other.name;
+            shaderAsset = other.shaderAsset;
+            slots = other.slots;
+            slotIndices = other.slotIndices;
+            floats = other.floats;
+            vectors = other.vectors;
+            matrices = other.matrices;
+            textures = other.textures;
+            revision = other.revision + 1;
+        }
+
+    private:
+        template <typename T>
+        size_t GetSlot(const std::string& propertyName, const Storage storage) const
+        {
+            const size_t slot = FindSlot(propertyName, storage);
+            if (slot == NO_SLOT)
             {
                 Exception::Throw(std::runtime_error(
-                    fmt::format("The {0} property with name {1} not found in material {2}.",
-                                typeid(TextureAsset).name(),
+                    fmt::format("The {0} property with name {1} not found in material {2}.", typeid(T).name(),
                                 propertyName, name)));
             }
-            return it->second;
+            return slot;
         }
 
-        void SetTexture(const std::string& propertyName, const Resource<TextureAsset>& textureAsset)
+        /*
+         * Without a shader there is no layout to follow, as when the asset manager compiles a material whose shader is
+         * not loaded. The property then gets a slot of its own, its value is kept once the shader is set.
+         */
+        template <typename T>
+        size_t GetSlotToSet(const std::string& propertyName, const Storage storage)
         {
-            auto it = textures.find(propertyName);
-            if (it != textures.end())
+            if (shaderAsset == nullptr && FindSlot(propertyName) == NO_SLOT)
             {
-                it->second = textureAsset;
-                return;
+                return AddSlot(propertyName, storage);
+            }
+            return GetSlot<T>(propertyName, storage);
+        }
+
+        size_t AddSlot(const std::string& propertyName, const Storage storage)
+        {
+            Slot slot{storage, 0, revision};
+            switch (storage)
+            {
+            case Storage::Float:
+                slot.index = floats.size();
+                floats.push_back(0);
+                break;
+            case Storage::Vector:
+                slot.index = vectors.size();
+                vectors.push_back(Vector4F::ZERO);
+                break;
+            case Storage::Matrix:
+                slot.index = matrices.size();
+                matrices.push_back(Matrix4X4::IDENTITY);
+                break;
+            case Storage::Texture:
+                slot.index = textures.size();
+                textures.push_back(nullptr);
+                break;
+            default: ;
             }
 
-            textures.emplace(propertyName, textureAsset);
+            slotIndices.emplace(propertyName, slots.size());
+            slots.push_back(slot);
+            return slots.size() - 1;
         }
 
-        void Clone(const Impl& other)
+        void MarkChanged(const size_t slot)
         {
-            name = other.name;
-            shaderAsset = other.shaderAsset;
+            slots[slot].revision = ++revision;
         }
 
-    private:
-        void UpdateProperties()
+        template <typename Writer>
+        void DumpProperties(FileStreamWriter& fileWriter, const Storage storage, Writer writeValue) const
         {
+            const size_t prefixLength = sizeof(PROPERTY_PREFIX) - 1;
+            std::vector<std::pair<std::string, const Slot*>> properties;
+            for (const auto& it : slotIndices)
+            {
+                const Slot& slot = slots[it.second];
+                if (slot.storage == storage && it.first.compare(0, prefixLength, PROPERTY_PREFIX) == 0)
+                {
+                    properties.emplace_back(it.first.substr(prefixLength), &slot);
+                }
+            }
+
+            uint8_t propertiesCount = properties.size();
+            fileWriter.Write(&propertiesCount, sizeof(uint8_t));
+            for (const auto& property : properties)
+            {
+                uint8_t uniformNameLength = property.first.size();
+                fileWriter.Write(&uniformNameLength, sizeof(uint8_t));
+                fileWriter.Write(property.first.data(), uniformNameLength);
+                writeValue(*property.second, fileWriter);
+            }
+        }
+
+        /*
+         * Lays the slots out like the uniforms of the shader. Values of properties the new shader still has, with the
+         * same storage, are kept.
+         */
+        void UpdateSlots()
+        {
+            std::vector<Slot> oldSlots = std::move(slots);
+            std::unordered_map<std::string, size_t> oldSlotIndices = std::move(slotIndices);
+            std::vector<float> oldFloats = std::move(floats);
+            std::vector<Vector4F> oldVectors = std::move(vectors);
+            std::vector<Matrix4X4> oldMatrices = std::move(matrices);
+            std::vector<Resource<TextureAsset>> oldTextures = std::move(textures);
+
+            slots.clear();
+            slotIndices.clear();
+            floats.clear();
+            vectors.clear();
+            matrices.clear();
+            textures.clear();
+            ++revision;
+
             if (shaderAsset == nullptr)
             {
                 return;
             }
 
-            for (auto& property : shaderAsset->GetUniforms())
+            const std::vector<ShaderAsset::Property>& uniforms = shaderAsset->GetUniforms();
+            slots.reserve(uniforms.size());
+            for (const auto& property : uniforms)
             {
-                switch (property.type)
+                const Slot& slot = slots[AddSlot(property.name, GetStorage(property.type))];
+                const auto old = oldSlotIndices.find(property.name);
+                if (old == oldSlotIndices.end() || oldSlots[old->second].storage != slot.storage)
                 {
-                case ShaderAsset::Property::Type::Bool:
-                case ShaderAsset::Property::Type::Int:
-                case ShaderAsset::Property::Type::Float:
-                    floats.emplace(property.name, 0);
+                    continue;
+                }
+
+                const size_t oldIndex = oldSlots[old->second].index;
+                switch (slot.storage)
+                {
+                case Storage::Float:
+                    floats[slot.index] = oldFloats[oldIndex];
                     break;
-                case ShaderAsset::Property::Type::Vector2I:
-                case ShaderAsset::Property::Type::Vector2F:
-                case ShaderAsset::Property::Type::Vector3I:
-                case ShaderAsset::Property::Type::Vector3F:
-                case ShaderAsset::Property::Type::Vector4I:
-                case ShaderAsset::Property::Type::Vector4F:
-                    vectors.emplace(property.name, Vector4F::ZERO);
+                case Storage::Vector:
+                    vectors[slot.index] = oldVectors[oldIndex];
                     break;
-                case ShaderAsset::Property::Type::Matrix4X4:
-                    matrices.emplace(property.name, Matrix4X4::IDENTITY);
+                case Storage::Matrix:
+                    matrices[slot.index] = oldMatrices[oldIndex];
                     break;
-                case ShaderAsset::Property::Type::Sampler2D:
-                    textures.emplace(property.name, nullptr);
+                case Storage::Texture:
+                    textures[slot.index] = oldTextures[oldIndex];
                     break;
                 default: ;
                 }
             }
         }
+
+        static Storage GetStorage(const ShaderAsset::Property::Type type)
+        {
+            switch (type)
+            {
+            case ShaderAsset::Property::Type::Bool:
+            case ShaderAsset::Property::Type::Int:
+            case ShaderAsset::Property::Type::Float:
+                return Storage::Float;
+            case ShaderAsset::Property::Type::Vector2I:
+            case ShaderAsset::Property::Type::Vector2F:
+            case ShaderAsset::Property::Type::Vector3I:
+            case ShaderAsset::Property::Type::Vector3F:
+            case ShaderAsset::Property::Type::Vector4I:
+            case ShaderAsset::Property::Type::Vector4F:
+                return Storage::Vector;
+            case ShaderAsset::Property::Type::Matrix4X4:
+                return Storage::Matrix;
+            case ShaderAsset::Property::Type::Sampler2D:
+                return Storage::Texture;
+            default:
+                return Storage::None;
+            }
+        }
     };
 
     MaterialAsset::Factory::Factory(ServiceCollection& serviceCollection)
@@ -335,7 +490,12 @@ namespace pluto
             reader.Read(uniformName.data(), uniformNameLength);
             float value;
             reader.Read(&value, sizeof(float));
-            materialAsset->SetFloat("u_mat." + uniformName, value);
+            const size_t slot = materialAsset->impl->FindSlot(Impl::PROPERTY_PREFIX + uniformName,
+                                                              Impl::Storage::Float);
+            if (slot != NO_SLOT)
+            {
+                materialAsset->impl->SetFloat(slot, value);
+            }
         }
 
         uint8_t vectorsCount;
@@ -348,7 +508,12 @@ namespace pluto
             reader.Read(uniformName.data(), uniformNameLength);
             Vector4F value;
             reader.Read(&value, sizeof(Vector4F));
-            materialAsset->SetVector4F("u_mat." + uniformName, value);
+            const size_t slot = materialAsset->impl->FindSlot(Impl::PROPERTY_PREFIX + uniformName,
+                                                              Impl::Storage::Vector);
+            if (slot != NO_SLOT)
+            {
+                materialAsset->impl->SetVector4F(slot, value);
+            }
         }
 
         uint8_t matricesCount;
@@ -361,7 +526,12 @@ namespace pluto
             reader.Read(uniformName.data(), uniformNameLength);
             Matrix4X4 value;
             reader.Read(&value, sizeof(Matrix4X4));
-            materialAsset->SetMatrix4X4("u_mat." + uniformName, value);
+            const size_t slot = materialAsset->impl->FindSlot(Impl::PROPERTY_PREFIX + uniformName,
+                                                              Impl::Storage::Matrix);
+            if (slot != NO_SLOT)
+            {
+                materialAsset->impl->SetMatrix4X4(slot, value);
+            }
         }
 
         uint8_t texturesCount;
@@ -376,7 +546,12 @@ namespace pluto
             Guid textureGuid;
             reader.Read(&textureGuid, sizeof(Guid));
             Resource<TextureAsset> texture = assetManager.Load<TextureAsset>(textureGuid);
-            materialAsset->SetTexture("u_mat." + uniformName, texture);
+            const size_t slot = materialAsset->impl->FindSlot(Impl::PROPERTY_PREFIX + uniformName,
+                                                              Impl::Storage::Texture);
+            if (slot != NO_SLOT)
+            {
+                materialAsset->impl->SetTexture(slot, texture);
+            }
         }
 
         return materialAsset;
@@ -423,6 +598,21 @@ namespace pluto
         impl->SetShader(value);
     }
 
+    size_t MaterialAsset::FindSlot(const std::string& propertyName) const
+    {
+        return impl->FindSlot(propertyName);
+    }
+
+    uint32_t MaterialAsset::GetRevision() const
+    {
+        return impl->GetRevision();
+    }
+
+    uint32_t MaterialAsset::GetSlotRevision(const size_t slot) const
+    {
+        return impl->GetSlotRevision(slot);
+    }
+
     bool MaterialAsset::GetBool(const std::string& propertyName) const
     {
         return impl->GetFloat(propertyName) != 0;
@@ -453,6 +643,16 @@ namespace pluto
         impl->SetFloat(propertyName, value);
     }
 
+    float MaterialAsset::GetFloat(const size_t slot) const
+    {
+        return impl->GetFloat(slot);
+    }
+
+    void MaterialAsset::SetFloat(const size_t slot, const float value)
+    {
+        impl->SetFloat(slot, value);
+    }
+
     Vector2I MaterialAsset::GetVector2I(const std::string& propertyName) const
     {
         const Vector4F vec = impl->GetVector4F(propertyName);
@@ -516,6 +716,16 @@ namespace pluto
         impl->SetVector4F(propertyName, value);
     }
 
+    const Vector4F& MaterialAsset::GetVector4F(const size_t slot) const
+    {
+        return impl->GetVector4F(slot);
+    }
+
+    void MaterialAsset::SetVector4F(const size_t slot, const Vector4F& value)
+    {
+        impl->SetVector4F(slot, value);
+    }
+
     const Matrix4X4& MaterialAsset::GetMatrix4X4(const std::string& propertyName) const
     {
         return impl->GetMatrix4X4(propertyName);
@@ -526,6 +736,16 @@ namespace pluto
         impl->SetMatrix4X4(propertyName, value);
     }
 
+    const Matrix4X4& MaterialAsset::GetMatrix4X4(const size_t slot) const
+    {
+        return impl->GetMatrix4X4(slot);
+    }
+
+    void MaterialAsset::SetMatrix4X4(const size_t slot, const Matrix4X4& value)
+    {
+        impl->SetMatrix4X4(slot, value);
+    }
+
     Resource<TextureAsset> MaterialAsset::GetTexture(const std::string& propertyName) const
     {
         return impl->GetTexture(propertyName);
@@ -535,4 +755,14 @@ namespace pluto
     {
         impl->SetTexture(propertyName, textureAsset);
     }
+
+    Resource<TextureAsset> MaterialAsset::GetTexture(const size_t slot) const
+    {
+        return impl->GetTexture(slot);
+    }
+
+    void MaterialAsset::SetTexture(const size_t slot, const Resource<TextureAsset>& textureAsset)
+    {
+        impl->SetTexture(slot, textureAsset);
+    }
 }
@@ -97,6 +97,13 @@ namespace pluto
             isBufferDirty = true;
         }
 
+        void SetPositions(const Vector3F* data, const size_t count)
+        {
+            // Assigning keeps the current capacity, meshes rebuilt every frame stop hitting the heap.
+            positions.assign(data, data + count);
+            isBufferDirty = true;
+        }
+
         const std::vector<Vector2F>& GetUVs() const
         {
             return uvs;
@@ -108,6 +115,12 @@ namespace pluto
             isBufferDirty = true;
         }
 
+        void SetUVs(const Vector2F* data, const size_t count)
+        {
+            uvs.assign(data, data + count);
+            isBufferDirty = true;
+        }
+
         const std::vector<Vector3I>& GetTriangles() const
         {
             return triangles;
@@ -119,6 +132,12 @@ namespace pluto
             isBufferDirty = true;
         }
 
+        void SetTriangles(const Vector3I* data, const size_t count)
+        {
+            triangles.assign(data, data + count);
+            isBufferDirty = true;
+        }
+
         void Clone(const Impl& other)
         {
             name = other.name;
@@ -128,6 +147,22 @@ namespace pluto
             isBufferDirty = true;
         }
 
+        size_t GetCpuPayloadSize() const
+        {
+            return positions.capacity() * sizeof(Vector3F) + uvs.capacity() * sizeof(Vector2F) +
+                triangles.capacity() * sizeof(Vector3I);
+        }
+
+        size_t GetGpuPayloadSize() const
+        {
+            if (meshBuffer == nullptr)
+            {
+                return 0;
+            }
+            return positions.size() * sizeof(Vector3F) + uvs.size() * sizeof(Vector2F) +
+                triangles.size() * sizeof(Vector3I);
+        }
+
         MeshBuffer& GetMeshBuffer()
         {
             if (isBufferDirty)
@@ -233,6 +268,16 @@ namespace pluto
         impl->SetName(value);
     }
 
+    size_t MeshAsset::GetCpuPayloadSize() const
+    {
+        return impl->GetCpuPayloadSize();
+    }
+
+    size_t MeshAsset::GetGpuPayloadSize() const
+    {
+        return impl->GetGpuPayloadSize();
+    }
+
     void MeshAsset::Dump(FileStreamWriter& fileWriter) const
     {
         impl->Dump(fileWriter);
@@ -248,6 +293,11 @@ namespace pluto
         impl->SetPositions(std::move(value));
     }
 
+    void MeshAsset::SetPositions(const Vector3F* data, const size_t count)
+    {
+        impl->SetPositions(data, count);
+    }
+
     const std::vector<Vector2F>& MeshAsset::GetUVs() const
     {
         return impl->GetUVs();
@@ -258,6 +308,11 @@ namespace pluto
         impl->SetUVs(std::move(value));
     }
 
+    void MeshAsset::SetUVs(const Vector2F* data, const size_t count)
+    {
+        impl->SetUVs(data, count);
+    }
+
     const std::vector<Vector3I>& MeshAsset::GetTriangles() const
     {
         return impl->GetTriangles();
@@ -268,6 +323,11 @@ namespace pluto
         impl->SetTriangles(std::move(value));
     }
 
+    void MeshAsset::SetTriangles(const Vector3I* data, const size_t count)
+    {
+        impl->SetTriangles(data, count);
+    }
+
     MeshBuffer& MeshAsset::GetMeshBuffer()
     {
         return impl->GetMeshBuffer();
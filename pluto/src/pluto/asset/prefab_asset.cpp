@@ -0,0 +1,232 @@
+#include <pluto/asset/prefab_asset.h>
+#include <pluto/file/stream_reader.h>
+#include <pluto/file/file_stream_writer.h>
+
+#include <pluto/guid.h>
+#include <pluto/exception.h>
+
+#include <vector>
+
+namespace pluto
+{
+    class PrefabAsset::Impl
+    {
+        Guid guid;
+        std::string name;
+        std::vector<Node> nodes;
+
+    public:
+        explicit Impl(const Guid& guid)
+            : guid(guid)
+        {
+        }
+
+        const Guid& GetId() const
+        {
+            return guid;
+        }
+
+        const std::string& GetName() const
+        {
+            return name;
+        }
+
+        void SetName(const std::string& value)
+        {
+            name = value;
+        }
+
+        void Dump(FileStreamWriter& fileWriter) const
+        {
+            fileWriter.Write(&Guid::PLUTO_IDENTIFIER, sizeof(Guid));
+            uint8_t serializerVersion = 1;
+            fileWriter.Write(&serializerVersion, sizeof(uint8_t));
+            auto assetType = static_cast<uint8_t>(Type::Prefab);
+            fileWriter.Write(&assetType, sizeof(uint8_t));
+            fileWriter.Write(&guid, sizeof(Guid));
+            uint8_t assetNameLength = name.size();
+            fileWriter.Write(&assetNameLength, sizeof(uint8_t));
+            fileWriter.Write(name.data(), assetNameLength);
+
+            uint32_t nodesCount = nodes.size();
+            fileWriter.Write(&nodesCount, sizeof(uint32_t));
+            for (const auto& node : nodes)
+            {
+                uint8_t nodeNameLength = node.name.size();
+                fileWriter.Write(&nodeNameLength, sizeof(uint8_t));
+                fileWriter.Write(node.name.data(), nodeNameLength);
+                fileWriter.Write(&node.parent, sizeof(uint32_t));
+                uint8_t isActive = node.isActive;
+                fileWriter.Write(&isActive, sizeof(uint8_t));
+                fileWriter.Write(&node.tags, sizeof(uint32_t));
+                fileWriter.Write(&node.layer, sizeof(uint8_t));
+                fileWriter.Write(&node.localPosition, sizeof(Vector3F));
+                fileWriter.Write(&node.localRotation, sizeof(Quaternion));
+                fileWriter.Write(&node.localScale, sizeof(Vector3F));
+
+                uint8_t componentsCount = node.components.size();
+                fileWriter.Write(&componentsCount, sizeof(uint8_t));
+                for (const auto& component : node.components)
+                {
+                    uint8_t componentNameLength = component.size();
+                    fileWriter.Write(&componentNameLength, sizeof(uint8_t));
+                    fileWriter.Write(component.data(), componentNameLength);
+                }
+            }
+            fileWriter.Flush();
+        }
+
+        const std::vector<Node>& GetNodes() const
+        {
+            return nodes;
+        }
+
+        void Reserve(const size_t count)
+        {
+            nodes.reserve(count);
+        }
+
+        uint32_t AddNode(const Node& node)
+        {
+            const auto index = static_cast<uint32_t>(nodes.size());
+            if (index == 0 ? node.parent != NO_PARENT : node.parent >= index)
+            {
+                Exception::Throw(std::runtime_error("Prefab node parent must be added before the node."));
+            }
+
+            nodes.push_back(node);
+            return index;
+        }
+    };
+
+    PrefabAsset::Factory::Factory(ServiceCollection& serviceCollection)
+        : Asset::Factory(serviceCollection)
+    {
+    }
+
+    std::unique_ptr<PrefabAsset> PrefabAsset::Factory::Create() const
+    {
+        return std::make_unique<PrefabAsset>(std::make_unique<Impl>(Guid::New()));
+    }
+
+    std::unique_ptr<PrefabAsset> PrefabAsset::Factory::Create(const PrefabAsset& original) const
+    {
+        auto prefabAsset = Create();
+        prefabAsset->SetName(original.GetName());
+        for (const auto& node : original.GetNodes())
+        {
+            prefabAsset->AddNode(node);
+        }
+        return prefabAsset;
+    }
+
+    std::unique_ptr<Asset> PrefabAsset::Factory::Create(StreamReader& reader) const
+    {
+        Guid signature;
+        reader.Read(&signature, sizeof(Guid));
+
+        if (signature != Guid::PLUTO_IDENTIFIER)
+        {
+            Exception::Throw(
+                std::runtime_error("Trying to load a asset but file signature does not match with pluto."));
+        }
+
+        uint8_t serializerVersion;
+        reader.Read(&serializerVersion, sizeof(uint8_t));
+        uint8_t assetType;
+        reader.Read(&assetType, sizeof(uint8_t));
+
+        if (assetType != static_cast<uint8_t>(Type::Prefab))
+        {
+            Exception::Throw(
+                std::runtime_error("Trying to load a prefab but file is not a prefab asset."));
+        }
+
+        Guid assetId;
+        reader.Read(&assetId, sizeof(Guid));
+        uint8_t assetNameLength;
+        reader.Read(&assetNameLength, sizeof(uint8_t));
+        std::string assetName(assetNameLength, ' ');
+        reader.Read(assetName.data(), assetNameLength);
+
+        auto prefabAsset = std::make_unique<PrefabAsset>(std::make_unique<Impl>(assetId));
+        prefabAsset->SetName(assetName);
+
+        uint32_t nodesCount;
+        reader.Read(&nodesCount, sizeof(uint32_t));
+        prefabAsset->impl->Reserve(nodesCount);
+        for (uint32_t i = 0; i < nodesCount; ++i)
+        {
+            Node node;
+            uint8_t nodeNameLength;
+            reader.Read(&nodeNameLength, sizeof(uint8_t));
+            node.name.resize(nodeNameLength);
+            reader.Read(node.name.data(), nodeNameLength);
+            reader.Read(&node.parent, sizeof(uint32_t));
+            uint8_t isActive;
+            reader.Read(&isActive, sizeof(uint8_t));
+            node.isActive = isActive != 0;
+            reader.Read(&node.tags, sizeof(uint32_t));
+            reader.Read(&node.layer, sizeof(uint8_t));
+            reader.Read(&node.localPosition, sizeof(Vector3F));
+            reader.Read(&node.localRotation, sizeof(Quaternion));
+            reader.Read(&node.localScale, sizeof(Vector3F));
+
+            uint8_t componentsCount;
+            reader.Read(&componentsCount, sizeof(uint8_t));
+            node.components.resize(componentsCount);
+            for (auto& component : node.components)
+            {
+                uint8_t componentNameLength;
+                reader.Read(&componentNameLength, sizeof(uint8_t));
+                component.resize(componentNameLength);
+                reader.Read(component.data(), componentNameLength);
+            }
+
+            prefabAsset->AddNode(node);
+        }
+
+        return prefabAsset;
+    }
+
+    PrefabAsset::~PrefabAsset() = default;
+
+    PrefabAsset::PrefabAsset(std::unique_ptr<Impl> impl)
+        : impl(std::move(impl))
+    {
+    }
+
+    PrefabAsset::PrefabAsset(PrefabAsset&& other) noexcept = default;
+
+    PrefabAsset& PrefabAsset::operator=(PrefabAsset&& rhs) noexcept = default;
+
+    const Guid& PrefabAsset::GetId() const
+    {
+        return impl->GetId();
+    }
+
+    const std::string& PrefabAsset::GetName() const
+    {
+        return impl->GetName();
+    }
+
+    void PrefabAsset::SetName(const std::string& value)
+    {
+        impl->SetName(value);
+    }
+
+    void PrefabAsset::Dump(FileStreamWriter& fileWriter) const
+    {
+        impl->Dump(fileWriter);
+    }
+
+    const std::vector<PrefabAsset::Node>& PrefabAsset::GetNodes() const
+    {
+        return impl->GetNodes();
+    }
+
+    uint32_t PrefabAsset::AddNode(const Node& node)
+    {
+        return impl->AddNode(node);
+    }
+}
@@ -0,0 +1,402 @@
+#include <pluto/asset/scene_asset.h>
+#include <pluto/file/stream_reader.h>
+#include <pluto/file/file_stream_writer.h>
+
+#include <pluto/guid.h>
+#include <pluto/exception.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace pluto
+{
+    class SceneAsset::Impl
+    {
+        Guid guid;
+        std::string name;
+
+        std::vector<std::string> names;
+        std::vector<uint32_t> parents;
+        std::vector<Vector3F> localPositions;
+        std::vector<Quaternion> localRotations;
+        std::vector<Vector3F> localScales;
+        std::vector<uint8_t> activeStates;
+        std::vector<uint32_t> tags;
+        std::vector<uint8_t> layers;
+
+        std::vector<std::string> componentTypeNames;
+        std::unordered_map<std::string, uint16_t> componentTypeIndices;
+        std::vector<uint32_t> componentGameObjects;
+        std::vector<uint16_t> componentTypes;
+
+    public:
+        explicit Impl(const Guid& guid)
+            : guid(guid)
+        {
+        }
+
+        const Guid& GetId() const
+        {
+            return guid;
+        }
+
+        const std::string& GetName() const
+        {
+            return name;
+        }
+
+        void SetName(const std::string& value)
+        {
+            name = value;
+        }
+
+        void Dump(FileStreamWriter& fileWriter) const
+        {
+            fileWriter.Write(&Guid::PLUTO_IDENTIFIER, sizeof(Guid));
+            uint8_t serializerVersion = 1;
+            fileWriter.Write(&serializerVersion, sizeof(uint8_t));
+            auto assetType = static_cast<uint8_t>(Type::Scene);
+            fileWriter.Write(&assetType, sizeof(uint8_t));
+            fileWriter.Write(&guid, sizeof(Guid));
+            uint8_t assetNameLength = name.size();
+            fileWriter.Write(&assetNameLength, sizeof(uint8_t));
+            fileWriter.Write(name.data(), assetNameLength);
+
+            uint16_t componentTypesCount = componentTypeNames.size();
+            fileWriter.Write(&componentTypesCount, sizeof(uint16_t));
+            for (const auto& componentTypeName : componentTypeNames)
+            {
+                WriteString(fileWriter, componentTypeName);
+            }
+
+            uint32_t gameObjectsCount = names.size();
+            fileWriter.Write(&gameObjectsCount, sizeof(uint32_t));
+            fileWriter.Write(parents.data(), sizeof(uint32_t) * gameObjectsCount);
+            fileWriter.Write(localPositions.data(), sizeof(Vector3F) * gameObjectsCount);
+            fileWriter.Write(localRotations.data(), sizeof(Quaternion) * gameObjectsCount);
+            fileWriter.Write(localScales.data(), sizeof(Vector3F) * gameObjectsCount);
+            fileWriter.Write(activeStates.data(), sizeof(uint8_t) * gameObjectsCount);
+            fileWriter.Write(tags.data(), sizeof(uint32_t) * gameObjectsCount);
+            fileWriter.Write(layers.data(), sizeof(uint8_t) * gameObjectsCount);
+            for (const auto& gameObjectName : names)
+            {
+                WriteString(fileWriter, gameObjectName);
+            }
+
+            uint32_t componentsCount = componentTypes.size();
+            fileWriter.Write(&componentsCount, sizeof(uint32_t));
+            fileWriter.Write(componentGameObjects.data(), sizeof(uint32_t) * componentsCount);
+            fileWriter.Write(componentTypes.data(), sizeof(uint16_t) * componentsCount);
+            fileWriter.Flush();
+        }
+
+        void Read(StreamReader& reader)
+        {
+            uint16_t componentTypesCount;
+            reader.Read(&componentTypesCount, sizeof(uint16_t));
+            componentTypeNames.resize(componentTypesCount);
+            for (uint16_t i = 0; i < componentTypesCount; ++i)
+            {
+                componentTypeNames[i] = ReadString(reader);
+                componentTypeIndices.emplace(componentTypeNames[i], i);
+            }
+
+            uint32_t gameObjectsCount;
+            reader.Read(&gameObjectsCount, sizeof(uint32_t));
+            parents.resize(gameObjectsCount);
+            reader.Read(parents.data(), sizeof(uint32_t) * gameObjectsCount);
+            localPositions.resize(gameObjectsCount);
+            reader.Read(localPositions.data(), sizeof(Vector3F) * gameObjectsCount);
+            localRotations.resize(gameObjectsCount);
+            reader.Read(localRotations.data(), sizeof(Quaternion) * gameObjectsCount);
+            localScales.resize(gameObjectsCount);
+            reader.Read(localScales.data(), sizeof(Vector3F) * gameObjectsCount);
+            activeStates.resize(gameObjectsCount);
+            reader.Read(activeStates.data(), sizeof(uint8_t) * gameObjectsCount);
+            tags.resize(gameObjectsCount);
+            reader.Read(tags.data(), sizeof(uint32_t) * gameObjectsCount);
+            layers.resize(gameObjectsCount);
+            reader.Read(layers.data(), sizeof(uint8_t) * gameObjectsCount);
+            names.resize(gameObjectsCount);
+            for (auto& gameObjectName : names)
+            {
+                gameObjectName = ReadString(reader);
+            }
+
+            uint32_t componentsCount;
+            reader.Read(&componentsCount, sizeof(uint32_t));
+            componentGameObjects.resize(componentsCount);
+            reader.Read(componentGameObjects.data(), sizeof(uint32_t) * componentsCount);
+            componentTypes.resize(componentsCount);
+            reader.Read(componentTypes.data(), sizeof(uint16_t) * componentsCount);
+
+            // The loader relies on these, so a corrupted file fails here instead of while the scene is built.
+            for (uint32_t i = 0; i < gameObjectsCount; ++i)
+            {
+                if (parents[i] != NO_PARENT && parents[i] >= i)
+                {
+                    Exception::Throw(std::runtime_error("Scene game object parent must be stored before it."));
+                }
+            }
+
+            for (uint32_t i = 0; i < componentsCount; ++i)
+            {
+                if (componentGameObjects[i] >= gameObjectsCount || componentTypes[i] >= componentTypesCount ||
+                    (i > 0 && componentGameObjects[i] < componentGameObjects[i - 1]))
+                {
+                    Exception::Throw(std::runtime_error("Scene component does not match its game objects or types."));
+                }
+            }
+        }
+
+        size_t GetGameObjectCount() const
+        {
+            return names.size();
+        }
+
+        const std::vector<std::string>& GetNames() const
+        {
+            return names;
+        }
+
+        const std::vector<uint32_t>& GetParents() const
+        {
+            return parents;
+        }
+
+        const std::vector<Vector3F>& GetLocalPositions() const
+        {
+            return localPositions;
+        }
+
+        const std::vector<Quaternion>& GetLocalRotations() const
+        {
+            return localRotations;
+        }
+
+        const std::vector<Vector3F>& GetLocalScales() const
+        {
+            return localScales;
+        }
+
+        const std::vector<uint8_t>& GetActiveStates() const
+        {
+            return activeStates;
+        }
+
+        const std::vector<uint32_t>& GetTags() const
+        {
+            return tags;
+        }
+
+        const std::vector<uint8_t>& GetLayers() const
+        {
+            return layers;
+        }
+
+        const std::vector<std::string>& GetComponentTypeNames() const
+        {
+            return componentTypeNames;
+        }
+
+        const std::vector<uint32_t>& GetComponentGameObjects() const
+        {
+            return componentGameObjects;
+        }
+
+        const std::vector<uint16_t>& GetComponentTypes() const
+        {
+            return componentTypes;
+        }
+
+        uint32_t AddGameObject(const PrefabAsset::Node& node)
+        {
+            const auto index = static_cast<uint32_t>(names.size());
+            if (node.parent != NO_PARENT && node.parent >= index)
+            {
+                Exception::Throw(std::runtime_error("Scene game object parent must be added before the game object."));
+            }
+
+            names.push_back(node.name);
+            parents.push_back(node.parent);
+            localPositions.push_back(node.localPosition);
+            localRotations.push_back(node.localRotation);
+            localScales.push_back(node.localScale);
+            activeStates.push_back(node.isActive);
+            tags.push_back(node.tags);
+            layers.push_back(node.layer);
+
+            for (const auto& component : node.components)
+            {
+                auto it = componentTypeIndices.find(component);
+                if (it == componentTypeIndices.end())
+                {
+                    it = componentTypeIndices.emplace(component, componentTypeNames.size()).first;
+                    componentTypeNames.push_back(component);
+                }
+
+                componentGameObjects.push_back(index);
+                componentTypes.push_back(it->second);
+            }
+            return index;
+        }
+
+    private:
+        static void WriteString(FileStreamWriter& fileWriter, const std::string& str)
+        {
+            uint8_t length = str.size();
+            fileWriter.Write(&length, sizeof(uint8_t));
+            fileWriter.Write(str.data(), length);
+        }
+
+        static std::string ReadString(StreamReader& reader)
+        {
+            uint8_t length;
+            reader.Read(&length, sizeof(uint8_t));
+            std::string str(length, ' ');
+            reader.Read(str.data(), length);
+            return str;
+        }
+    };
+
+    SceneAsset::Factory::Factory(ServiceCollection& serviceCollection)
+        : Asset::Factory(serviceCollection)
+    {
+    }
+
+    std::unique_ptr<SceneAsset> SceneAsset::Factory::Create() const
+    {
+        return std::make_unique<SceneAsset>(std::make_unique<Impl>(Guid::New()));
+    }
+
+    std::unique_ptr<Asset> SceneAsset::Factory::Create(StreamReader& reader) const
+    {
+        Guid signature;
+        reader.Read(&signature, sizeof(Guid));
+
+        if (signature != Guid::PLUTO_IDENTIFIER)
+        {
+            Exception::Throw(
+                std::runtime_error("Trying to load a asset but file signature does not match with pluto."));
+        }
+
+        uint8_t serializerVersion;
+        reader.Read(&serializerVersion, sizeof(uint8_t));
+        uint8_t assetType;
+        reader.Read(&assetType, sizeof(uint8_t));
+
+        if (assetType != static_cast<uint8_t>(Type::Scene))
+        {
+            Exception::Throw(
+                std::runtime_error("Trying to load a scene but file is not a scene asset."));
+        }
+
+        Guid assetId;
+        reader.Read(&assetId, sizeof(Guid));
+        uint8_t assetNameLength;
+        reader.Read(&assetNameLength, sizeof(uint8_t));
+        std::string assetName(assetNameLength, ' ');
+        reader.Read(assetName.data(), assetNameLength);
+
+        auto sceneAsset = std::make_unique<SceneAsset>(std::make_unique<Impl>(assetId));
+        sceneAsset->SetName(assetName);
+        sceneAsset->impl->Read(reader);
+        return sceneAsset;
+    }
+
+    SceneAsset::~SceneAsset() = default;
+
+    SceneAsset::SceneAsset(std::unique_ptr<Impl> impl)
+        : impl(std::move(impl))
+    {
+    }
+
+    SceneAsset::SceneAsset(SceneAsset&& other) noexcept = default;
+
+    SceneAsset& SceneAsset::operator=(SceneAsset&& rhs) noexcept = default;
+
+    const Guid& SceneAsset::GetId() const
+    {
+        return impl->GetId();
+    }
+
+    const std::string& SceneAsset::GetName() const
+    {
+        return impl->GetName();
+    }
+
+    void SceneAsset::SetName(const std::string& value)
+    {
+        impl->SetName(value);
+    }
+
+    void SceneAsset::Dump(FileStreamWriter& fileWriter) const
+    {
+        impl->Dump(fileWriter);
+    }
+
+    size_t SceneAsset::GetGameObjectCount() const
+    {
+        return impl->GetGameObjectCount();
+    }
+
+    const std::vector<std::string>& SceneAsset::GetNames() const
+    {
+        return impl->GetNames();
+    }
+
+    const std::vector<uint32_t>& SceneAsset::GetParents() const
+    {
+        return impl->GetParents();
+    }
+
+    const std::vector<Vector3F>& SceneAsset::GetLocalPositions() const
+    {
+        return impl->GetLocalPositions();
+    }
+
+    const std::vector<Quaternion>& SceneAsset::GetLocalRotations() const
+    {
+        return impl->GetLocalRotations();
+    }
+
+    const std::vector<Vector3F>& SceneAsset::GetLocalScales() const
+    {
+        return impl->GetLocalScales();
+    }
+
+    const std::vector<uint8_t>& SceneAsset::GetActiveStates() const
+    {
+        return impl->GetActiveStates();
+    }
+
+    const std::vector<uint32_t>& SceneAsset::GetTags() const
+    {
+        return impl->GetTags();
+    }
+
+    const std::vector<uint8_t>& SceneAsset::GetLayers() const
+    {
+        return impl->GetLayers();
+    }
+
+    const std::vector<std::string>& SceneAsset::GetComponentTypeNames() const
+    {
+        return impl->GetComponentTypeNames();
+    }
+
+    const std::vector<uint32_t>& SceneAsset::GetComponentGameObjects() const
+    {
+        return impl->GetComponentGameObjects();
+    }
+
+    const std::vector<uint16_t>& SceneAsset::GetComponentTypes() const
+    {
+        return impl->GetComponentTypes();
+    }
+
+    uint32_t SceneAsset::AddGameObject(const PrefabAsset::Node& node)
+    {
+        return impl->AddGameObject(node);
+    }
+}
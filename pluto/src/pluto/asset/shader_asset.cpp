@@ -30,6 +30,7 @@ namespace pluto
 
         uint32_t binaryFormat;
         std::vector<uint8_t> binaryData;
+        std::vector<uint8_t> instancedBinaryData;
 
         std::unique_ptr<ShaderProgram> shaderProgram;
 
@@ -38,7 +39,7 @@ namespace pluto
              const BlendFactor blendSrcFactor, const BlendFactor blendDstFactor, const BlendFactor blendSrcAlphaFactor,
              const BlendFactor blendDstAlphaFactor, const DepthTest depthTest, const CullFace cullFace,
              std::vector<Property> attributes, std::vector<Property> uniforms, const uint32_t binaryFormat,
-             std::vector<uint8_t> binaryData)
+             std::vector<uint8_t> binaryData, std::vector<uint8_t> instancedBinaryData)
             : guid(guid),
               blendEquation(blendEquation),
               blendAlphaEquation(blendAlphaEquation),
@@ -51,7 +52,8 @@ namespace pluto
               attributes(std::move(attributes)),
               uniforms(std::move(uniforms)),
               binaryFormat(binaryFormat),
-              binaryData(std::move(binaryData))
+              binaryData(std::move(binaryData)),
+              instancedBinaryData(std::move(instancedBinaryData))
         {
         }
 
@@ -73,7 +75,7 @@ namespace pluto
         void Dump(FileStreamWriter& fileWriter) const
         {
             fileWriter.Write(&guid, sizeof(Guid));
-            uint8_t serializerVersion = 1;
+            uint8_t serializerVersion = 2;
             fileWriter.Write(&serializerVersion, sizeof(uint8_t));
             uint8_t assetType = 1;
             fileWriter.Write(&assetType, sizeof(uint8_t));
@@ -140,6 +142,10 @@ namespace pluto
             fileWriter.Write(&binaryDataSize, sizeof(uint32_t));
             fileWriter.Write(binaryData.data(), binaryDataSize);
 
+            uint32_t instancedBinaryDataSize = instancedBinaryData.size();
+            fileWriter.Write(&instancedBinaryDataSize, sizeof(uint32_t));
+            fileWriter.Write(instancedBinaryData.data(), instancedBinaryDataSize);
+
             fileWriter.Flush();
         }
 
@@ -203,6 +209,11 @@ namespace pluto
             return binaryData;
         }
 
+        const std::vector<uint8_t>& GetInstancedBinaryData() const
+        {
+            return instancedBinaryData;
+        }
+
         ShaderProgram& GetShaderProgram()
         {
             return *shaderProgram;
@@ -228,11 +239,13 @@ namespace pluto
                                                               const std::vector<Property>& attributes,
                                                               const std::vector<Property>& uniforms,
                                                               uint32_t binaryFormat,
-                                                              const std::vector<uint8_t>& binaryData) const
+                                                              const std::vector<uint8_t>& binaryData,
+                                                              const std::vector<uint8_t>& instancedBinaryData) const
     {
         auto shaderAsset = std::make_unique<ShaderAsset>(std::make_unique<Impl>(
             Guid::New(), blendEquation, blendAlphaEquation, blendSrcFactor, blendDstFactor, blendSrcAlphaFactor,
-            blendDstAlphaFactor, depthTest, cullFace, attributes, uniforms, binaryFormat, binaryData));
+            blendDstAlphaFactor, depthTest, cullFace, attributes, uniforms, binaryFormat, binaryData,
+            instancedBinaryData));
 
         ServiceCollection& serviceCollection = GetServiceCollection();
         auto& shaderProgramFactory = serviceCollection.GetFactory<ShaderProgram>();
@@ -319,12 +332,22 @@ namespace pluto
         std::vector<uint8_t> binaryData(binarySize);
         reader.Read(binaryData.data(), binarySize);
 
+        // Version 1 files have no instanced variant.
+        std::vector<uint8_t> instancedBinaryData;
+        if (serializerVersion >= 2)
+        {
+            uint32_t instancedBinarySize;
+            reader.Read(&instancedBinarySize, sizeof(uint32_t));
+            instancedBinaryData.resize(instancedBinarySize);
+            reader.Read(instancedBinaryData.data(), instancedBinarySize);
+        }
+
         auto shaderAsset = std::make_unique<ShaderAsset>(std::make_unique<Impl>(
             assetId, static_cast<BlendEquation>(blendEquation), static_cast<BlendEquation>(blendAlphaEquation),
             static_cast<BlendFactor>(blendSrcFactor), static_cast<BlendFactor>(blendDstFactor),
             static_cast<BlendFactor>(blendSrcAlphaFactor), static_cast<BlendFactor>(blendDstAlphaFactor),
             static_cast<DepthTest>(depthTest), static_cast<CullFace>(cullFace), attributes, uniforms,
-            binaryFormat, binaryData));
+            binaryFormat, binaryData, instancedBinaryData));
 
         shaderAsset->SetName(assetName);
 
@@ -425,6 +448,11 @@ namespace pluto
         return impl->GetBinaryData();
     }
 
+    const std::vector<uint8_t>& ShaderAsset::GetInstancedBinaryData() const
+    {
+        return impl->GetInstancedBinaryData();
+    }
+
     ShaderProgram& ShaderAsset::GetShaderProgram()
     {
         return impl->GetShaderProgram();
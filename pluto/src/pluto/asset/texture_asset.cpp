@@ -310,6 +310,17 @@ namespace pluto
             textureBuffer->Update(*instance);
         }
 
+        size_t GetCpuPayloadSize() const
+        {
+            return data.capacity();
+        }
+
+        size_t GetGpuPayloadSize() const
+        {
+            // Estimated from the base level only, drivers may add padding and mipmaps on top of it.
+            return static_cast<size_t>(width) * height * GetChannelsCount();
+        }
+
     private:
         size_t GetChannelsCount() const
         {
@@ -477,6 +488,16 @@ namespace pluto
         impl->SetName(value);
     }
 
+    size_t TextureAsset::GetCpuPayloadSize() const
+    {
+        return impl->GetCpuPayloadSize();
+    }
+
+    size_t TextureAsset::GetGpuPayloadSize() const
+    {
+        return impl->GetGpuPayloadSize();
+    }
+
     void TextureAsset::Dump(FileStreamWriter& fileWriter) const
     {
         impl->Dump(fileWriter);
@@ -1,11 +1,15 @@
 #include <pluto/event/event_manager.h>
+#include <pluto/event/event_queue.h>
+#include <pluto/event/posted_event.h>
 #include <pluto/log/log_manager.h>
 #include <pluto/service/service_collection.h>
 
-#include <pluto/guid.h>
+#include <pluto/runtime_id.h>
+#include <pluto/type_registry.h>
 
 #include <pluto/asset/events/on_asset_unload_event.h>
 
+#include <atomic>
 #include <memory>
 #include <typeindex>
 #include <vector>
@@ -13,20 +17,174 @@
 
 namespace pluto
 {
+    /*
+     * Intrusive multi producer single consumer queue (Dmitry Vyukov's design).
+     * Producers only do one atomic exchange, the consumer never blocks but may miss a node that is half pushed,
+     * it is picked on the next pop.
+     */
+    class EventInbox
+    {
+        class StubPostedEvent final : public BasePostedEvent
+        {
+        public:
+            void Dispatch(EventManager& eventManager) const override
+            {
+            }
+        };
+
+        std::atomic<BasePostedEvent*> head;
+        BasePostedEvent* tail;
+        StubPostedEvent stub;
+
+    public:
+        EventInbox()
+            : head(&stub),
+              tail(&stub)
+        {
+        }
+
+        ~EventInbox()
+        {
+            BasePostedEvent* postedEvent = Pop();
+            while (postedEvent != nullptr)
+            {
+                delete postedEvent;
+                postedEvent = Pop();
+            }
+        }
+
+        EventInbox(const EventInbox& other) = delete;
+        EventInbox(EventInbox&& other) noexcept = delete;
+        EventInbox& operator=(const EventInbox& rhs) = delete;
+        EventInbox& operator=(EventInbox&& rhs) noexcept = delete;
+
+        void Push(BasePostedEvent* postedEvent)
+        {
+            postedEvent->next.store(nullptr, std::memory_order_relaxed);
+            BasePostedEvent* previous = head.exchange(postedEvent, std::memory_order_acq_rel);
+            previous->next.store(postedEvent, std::memory_order_release);
+        }
+
+        const BasePostedEvent* GetLast() const
+        {
+            return head.load(std::memory_order_acquire);
+        }
+
+        BasePostedEvent* Pop()
+        {
+            BasePostedEvent* current = tail;
+            BasePostedEvent* next = current->next.load(std::memory_order_acquire);
+            if (current == &stub)
+            {
+                if (next == nullptr)
+                {
+                    return nullptr;
+                }
+
+                tail = next;
+                current = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if (next != nullptr)
+            {
+                tail = next;
+                return current;
+            }
+
+            if (current != head.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            // Current is the last node, the stub goes behind it so it can be handed out.
+            Push(&stub);
+            next = current->next.load(std::memory_order_acquire);
+            if (next != nullptr)
+            {
+                tail = next;
+                return current;
+            }
+            return nullptr;
+        }
+    };
+
     class EventManager::Impl
     {
         struct EventListenerEntry final
         {
-            Guid guid;
-            EventListener<BaseEvent> callback;
+            RuntimeId listenerId;
+            EventDelegate delegate;
+            bool active;
+        };
+
+        struct Channel final
+        {
+            std::vector<EventListenerEntry> listeners;
+
+            // Listeners subscribed while the channel is being dispatched, they start receiving events after it ends.
+            std::vector<EventListenerEntry> pendingListeners;
+            uint32_t dispatchDepth;
+            bool dirty;
+        };
+
+        struct ListenerLocation final
+        {
+            size_t eventTypeId;
+            size_t index;
+            bool pending;
+        };
+
+        /*
+         * Marks the channel as being dispatched while it is alive, so a listener that throws does not leave it marked.
+         */
+        class DispatchScope final
+        {
+            Impl& impl;
+            Channel& channel;
+
+        public:
+            DispatchScope(Impl& impl, Channel& channel)
+                : impl(impl),
+                  channel(channel)
+            {
+                ++channel.dispatchDepth;
+            }
+
+            ~DispatchScope()
+            {
+                --channel.dispatchDepth;
+                if (channel.dispatchDepth == 0 && channel.dirty)
+                {
+                    impl.ApplyPendingChanges(channel);
+                }
+            }
+
+            DispatchScope(const DispatchScope& other) = delete;
+            DispatchScope(DispatchScope&& other) noexcept = delete;
+            DispatchScope& operator=(const DispatchScope& rhs) = delete;
+            DispatchScope& operator=(DispatchScope&& rhs) noexcept = delete;
         };
 
         LogManager* logManager;
-        std::unordered_map<std::type_index, std::vector<EventListenerEntry>> listeners;
+
+        // Indexed by event type id. Channels are boxed so a dispatch in progress is not affected by new event types.
+        std::vector<std::unique_ptr<Channel>> channels;
+        std::unordered_map<RuntimeId, ListenerLocation> locations;
+
+        // Also indexed by event type id, queues are created the first time an event type is enqueued.
+        std::vector<std::unique_ptr<BaseEventQueue>> queues;
+        std::vector<BaseEventQueue*> pendingQueues;
+        std::vector<BaseEventQueue*> flushingQueues;
+        bool isFlushing;
+
+        std::unique_ptr<EventInbox> inbox;
 
     public:
         explicit Impl(LogManager& logManager)
-            : logManager(&logManager)
+            : logManager(&logManager),
+              isFlushing(false),
+              inbox(std::make_unique<EventInbox>())
         {
             logManager.LogInfo("EventManager Initialized!");
         }
@@ -36,55 +194,184 @@ namespace pluto
             logManager->LogInfo("EventManager Terminated!");
         }
 
-        Guid Subscribe(const std::type_info& eventType, const EventListener<BaseEvent>& listener)
+        RuntimeId Subscribe(const size_t eventTypeId, EventDelegate&& delegate)
         {
-            const auto it = listeners.find(eventType);
-            if (it == listeners.end())
+            while (eventTypeId >= channels.size())
             {
-                listeners[eventType] = std::vector<EventListenerEntry>();
+                channels.push_back(std::make_unique<Channel>(Channel{{}, {}, 0, false}));
             }
 
-            auto& vec = listeners[eventType];
-            const Guid guid = Guid::New();
-            vec.push_back({guid, listener});
-            return guid;
+            const RuntimeId listenerId = RuntimeId::New();
+            Channel& channel = *channels[eventTypeId];
+            if (channel.dispatchDepth > 0)
+            {
+                locations.emplace(listenerId, ListenerLocation{eventTypeId, channel.pendingListeners.size(), true});
+                channel.pendingListeners.push_back({listenerId, std::move(delegate), true});
+                channel.dirty = true;
+            }
+            else
+            {
+                locations.emplace(listenerId, ListenerLocation{eventTypeId, channel.listeners.size(), false});
+                channel.listeners.push_back({listenerId, std::move(delegate), true});
+            }
+            return listenerId;
         }
 
-        void Unsubscribe(const std::type_info& eventType, const Guid& guid)
+        void Unsubscribe(const size_t eventTypeId, const RuntimeId listenerId)
         {
-            const auto it = listeners.find(eventType);
-            if (it == listeners.end())
+            const auto it = locations.find(listenerId);
+            if (it == locations.end() || it->second.eventTypeId != eventTypeId)
             {
                 return;
             }
 
-            // TODO: Improve here, this can perform badly when a given event is listen in lot of places. e.g. OnUpdateEvent.
-            for (auto i = it->second.begin(); i != it->second.end(); ++i)
+            const ListenerLocation location = it->second;
+            locations.erase(it);
+
+            Channel& channel = *channels[eventTypeId];
+            if (location.pending)
             {
-                if (i->guid == guid)
+                channel.pendingListeners[location.index].active = false;
+            }
+            else if (channel.dispatchDepth > 0)
+            {
+                // Removing now would shift entries under the dispatch loop, the entry is dropped when it ends.
+                channel.listeners[location.index].active = false;
+                channel.dirty = true;
+            }
+            else
+            {
+                RemoveListener(channel, location.index);
+            }
+        }
+
+        void Dispatch(const size_t eventTypeId, const BaseEvent& event)
+        {
+            if (eventTypeId >= channels.size())
+            {
+                return;
+            }
+
+            Channel& channel = *channels[eventTypeId];
+            const DispatchScope scope(*this, channel);
+
+            // Only the listeners present when the dispatch started are visited, new ones are queued as pending.
+            const size_t count = channel.listeners.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const EventListenerEntry& listener = channel.listeners[i];
+                if (listener.active)
                 {
-                    it->second.erase(i);
-                    break;
+                    listener.delegate(event);
                 }
             }
+        }
 
-            if (it->second.empty())
+        BaseEventQueue& GetEventQueue(const size_t eventTypeId, std::unique_ptr<BaseEventQueue> (*factory)())
+        {
+            if (eventTypeId >= queues.size())
             {
-                listeners.erase(it);
+                queues.resize(eventTypeId + 1);
             }
+
+            auto& queue = queues[eventTypeId];
+            if (queue == nullptr)
+            {
+                queue = factory();
+            }
+
+            // Callers always push an event, so the queue is flushed in the order it first got one.
+            if (!queue->IsPending())
+            {
+                queue->SetPending(true);
+                pendingQueues.push_back(queue.get());
+            }
+            return *queue;
         }
 
-        void Dispatch(const BaseEvent& event) const
+        void FlushEventQueues(EventManager& eventManager)
         {
-            const auto it = listeners.find(typeid(event));
-            if (it == listeners.end())
+            if (isFlushing)
             {
                 return;
             }
-            for (auto& listener : it->second)
+
+            isFlushing = true;
+            std::swap(pendingQueues, flushingQueues);
+            for (BaseEventQueue* queue : flushingQueues)
+            {
+                queue->SetPending(false);
+                queue->Flush(eventManager);
+            }
+            flushingQueues.clear();
+            isFlushing = false;
+        }
+
+        void Post(std::unique_ptr<BasePostedEvent> postedEvent)
+        {
+            inbox->Push(postedEvent.release());
+        }
+
+        void DispatchPostedEvents(EventManager& eventManager)
+        {
+            // Stops at the last event posted before it started, producers that keep posting cannot stall the main thread.
+            const BasePostedEvent* last = inbox->GetLast();
+            BasePostedEvent* postedEvent = inbox->Pop();
+            while (postedEvent != nullptr)
+            {
+                const std::unique_ptr<BasePostedEvent> owner(postedEvent);
+                postedEvent->Dispatch(eventManager);
+                if (postedEvent == last)
+                {
+                    break;
+                }
+                postedEvent = inbox->Pop();
+            }
+        }
+
+    private:
+        void RemoveListener(Channel& channel, const size_t index)
+        {
+            const size_t lastIndex = channel.listeners.size() - 1;
+            if (index != lastIndex)
+            {
+                channel.listeners[index] = std::move(channel.listeners[lastIndex]);
+                if (channel.listeners[index].active)
+                {
+                    locations.at(channel.listeners[index].listenerId).index = index;
+                }
+            }
+            channel.listeners.pop_back();
+        }
+
+        void ApplyPendingChanges(Channel& channel)
+        {
+            size_t i = 0;
+            while (i < channel.listeners.size())
             {
-                listener.callback(event);
+                if (channel.listeners[i].active)
+                {
+                    ++i;
+                }
+                else
+                {
+                    RemoveListener(channel, i);
+                }
             }
+
+            for (auto& listener : channel.pendingListeners)
+            {
+                if (listener.active)
+                {
+                    ListenerLocation& location = locations.at(listener.listenerId);
+                    location.index = channel.listeners.size();
+                    location.pending = false;
+                    channel.listeners.push_back(std::move(listener));
+                }
+            }
+
+            channel.pendingListeners.clear();
+            channel.dirty = false;
         }
     };
 
@@ -111,18 +398,59 @@ namespace pluto
 
     EventManager& EventManager::operator=(EventManager&& other) noexcept = default;
 
-    Guid EventManager::Subscribe(const std::type_info& eventType, const EventListener<BaseEvent>& listener)
+    RuntimeId EventManager::Subscribe(const std::type_info& eventType, const EventListener<BaseEvent>& listener)
     {
-        return impl->Subscribe(eventType, listener);
+        return impl->Subscribe(GetEventTypeId(eventType), EventDelegate::Create<BaseEvent>(listener));
     }
 
-    void EventManager::Unsubscribe(const std::type_info& eventType, const Guid& guid)
+    void EventManager::Unsubscribe(const std::type_info& eventType, const RuntimeId listenerId)
     {
-        impl->Unsubscribe(eventType, guid);
+        impl->Unsubscribe(GetEventTypeId(eventType), listenerId);
     }
 
     void EventManager::Dispatch(const BaseEvent& event) const
     {
-        impl->Dispatch(event);
+        impl->Dispatch(GetEventTypeId(typeid(event)), event);
+    }
+
+    RuntimeId EventManager::Subscribe(const size_t eventTypeId, EventDelegate&& delegate)
+    {
+        return impl->Subscribe(eventTypeId, std::move(delegate));
+    }
+
+    void EventManager::Unsubscribe(const size_t eventTypeId, const RuntimeId listenerId)
+    {
+        impl->Unsubscribe(eventTypeId, listenerId);
+    }
+
+    void EventManager::Dispatch(const size_t eventTypeId, const BaseEvent& event) const
+    {
+        impl->Dispatch(eventTypeId, event);
+    }
+
+    size_t EventManager::GetEventTypeId(const std::type_info& eventType)
+    {
+        return TypeRegistry::GetId(typeid(BaseEvent), eventType);
+    }
+
+    BaseEventQueue& EventManager::GetEventQueue(const size_t eventTypeId,
+                                                std::unique_ptr<BaseEventQueue> (*factory)())
+    {
+        return impl->GetEventQueue(eventTypeId, factory);
+    }
+
+    void EventManager::FlushEventQueues()
+    {
+        impl->FlushEventQueues(*this);
+    }
+
+    void EventManager::Post(std::unique_ptr<BasePostedEvent> postedEvent)
+    {
+        impl->Post(std::move(postedEvent));
+    }
+
+    void EventManager::DispatchPostedEvents()
+    {
+        impl->DispatchPostedEvents(*this);
     }
 }
@@ -1,8 +1,9 @@
 #include <pluto/guid.h>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_hash.hpp>
+#include <boost/uuid/uuid_io.hpp>
 
+#include <cstring>
 #include <sstream>
 
 namespace pluto
@@ -84,5 +85,15 @@ namespace pluto
 
 size_t std::hash<pluto::Guid>::operator()(const pluto::Guid& guid) const noexcept
 {
-    return hash_value(ToBoost(guid));
+    // Uuids are already well distributed, a cheap mix of the two halves is enough.
+    uint64_t high;
+    uint64_t low;
+    std::memcpy(&high, &guid, sizeof(uint64_t));
+    std::memcpy(&low, reinterpret_cast<const uint8_t*>(&guid) + sizeof(uint64_t), sizeof(uint64_t));
+
+    uint64_t value = high ^ (low * 0x9e3779b97f4a7c15ull);
+    value ^= value >> 32;
+    value *= 0xd6e8feb86659fd93ull;
+    value ^= value >> 32;
+    return static_cast<size_t>(value);
 }
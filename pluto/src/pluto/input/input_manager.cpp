@@ -8,7 +8,7 @@
 
 #include "pluto/simulation/events/on_main_loop_begin.h"
 
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 #include "pluto/math/vector2f.h"
 
 #include <unordered_set>
@@ -27,7 +27,7 @@ namespace pluto
         double mouseScrollDeltaX;
         double mouseScrollDeltaY;
 
-        Guid onMainLoopBeginEventListenerId;
+        RuntimeId onMainLoopBeginEventListenerId;
 
         LogManager* logManager;
         EventManager* eventManager;
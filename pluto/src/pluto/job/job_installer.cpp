@@ -0,0 +1,17 @@
+#include "pluto/job/job_installer.h"
+#include "pluto/job/job_system.h"
+
+#include "pluto/service/service_collection.h"
+
+namespace pluto
+{
+    void JobInstaller::Install(ServiceCollection& serviceCollection)
+    {
+        serviceCollection.AddService(JobSystem::Factory(serviceCollection).Create());
+    }
+
+    void JobInstaller::Uninstall(ServiceCollection& serviceCollection)
+    {
+        serviceCollection.RemoveService<JobSystem>();
+    }
+}
@@ -0,0 +1,293 @@
+#include "pluto/job/job_system.h"
+
+#include "pluto/service/service_collection.h"
+#include "pluto/log/log_manager.h"
+#include "pluto/config/config_manager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pluto
+{
+    class JobSystem::Impl
+    {
+        struct Batch
+        {
+            const std::function<void(size_t, size_t)>* function;
+            std::atomic<size_t> remainingJobs;
+            std::mutex exceptionMutex;
+            std::exception_ptr exception;
+        };
+
+        struct Job
+        {
+            Batch* batch;
+            size_t begin;
+            size_t end;
+        };
+
+        // The owner thread works at the back, the others steal from the front.
+        struct WorkQueue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        struct ThreadContext
+        {
+            const Impl* jobSystem;
+            size_t queueIndex;
+        };
+
+        static thread_local ThreadContext threadContext;
+
+        // The first queue is shared by every thread that is not a worker.
+        std::vector<std::unique_ptr<WorkQueue>> queues;
+        std::vector<std::thread> workers;
+
+        std::atomic<size_t> queuedJobs;
+        std::mutex sleepMutex;
+        std::condition_variable wakeCondition;
+        bool isStopping;
+
+        LogManager* logManager;
+
+    public:
+        ~Impl()
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                isStopping = true;
+            }
+            wakeCondition.notify_all();
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+
+            logManager->LogInfo("JobSystem terminated!");
+        }
+
+        Impl(const size_t workerCount, LogManager& logManager)
+            : queuedJobs(0),
+              isStopping(false),
+              logManager(&logManager)
+        {
+            for (size_t i = 0; i <= workerCount; ++i)
+            {
+                queues.push_back(std::make_unique<WorkQueue>());
+            }
+
+            for (size_t i = 1; i <= workerCount; ++i)
+            {
+                workers.emplace_back(&Impl::WorkerLoop, this, i);
+            }
+
+            logManager.LogInfo("JobSystem initialized with " + std::to_string(workerCount) + " workers!");
+        }
+
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = delete;
+        Impl& operator=(const Impl& rhs) = delete;
+        Impl& operator=(Impl&& rhs) noexcept = delete;
+
+        size_t GetWorkerCount() const
+        {
+            return workers.size();
+        }
+
+        void ParallelFor(const size_t count, const size_t chunkSize,
+                         const std::function<void(size_t begin, size_t end)>& function)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            const size_t jobSize = std::max<size_t>(chunkSize, 1);
+            const size_t jobCount = (count + jobSize - 1) / jobSize;
+            if (jobCount == 1 || workers.empty())
+            {
+                for (size_t begin = 0; begin < count; begin += jobSize)
+                {
+                    function(begin, std::min(begin + jobSize, count));
+                }
+                return;
+            }
+
+            Batch batch;
+            batch.function = &function;
+            batch.remainingJobs = jobCount;
+
+            // Counted before they are published, a worker that takes one must never see the count below it.
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                queuedJobs += jobCount;
+            }
+
+            // Jobs are dealt across all the queues, so the workers can start without stealing.
+            const size_t self = GetQueueIndex();
+            const size_t queueCount = queues.size();
+            for (size_t i = 0; i < queueCount && i < jobCount; ++i)
+            {
+                WorkQueue& queue = *queues[(self + i) % queueCount];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                for (size_t job = i; job < jobCount; job += queueCount)
+                {
+                    const size_t begin = job * jobSize;
+                    queue.jobs.push_back({&batch, begin, std::min(begin + jobSize, count)});
+                }
+            }
+            wakeCondition.notify_all();
+
+            while (batch.remainingJobs.load(std::memory_order_acquire) > 0)
+            {
+                if (!RunJob(self))
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            if (batch.exception != nullptr)
+            {
+                std::rethrow_exception(batch.exception);
+            }
+        }
+
+    private:
+        size_t GetQueueIndex() const
+        {
+            return threadContext.jobSystem == this ? threadContext.queueIndex : 0;
+        }
+
+        void WorkerLoop(const size_t queueIndex)
+        {
+            threadContext = {this, queueIndex};
+            while (true)
+            {
+                if (RunJob(queueIndex))
+                {
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wakeCondition.wait(lock, [this]
+                {
+                    return isStopping || queuedJobs.load() > 0;
+                });
+
+                if (isStopping)
+                {
+                    return;
+                }
+            }
+        }
+
+        bool RunJob(const size_t queueIndex)
+        {
+            Job job;
+            if (!PopJob(queueIndex, job) && !StealJob(queueIndex, job))
+            {
+                return false;
+            }
+            --queuedJobs;
+
+            Batch& batch = *job.batch;
+            try
+            {
+                (*batch.function)(job.begin, job.end);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(batch.exceptionMutex);
+                if (batch.exception == nullptr)
+                {
+                    batch.exception = std::current_exception();
+                }
+            }
+
+            // The batch lives on the stack of the thread waiting for it, it must not be touched after this.
+            batch.remainingJobs.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+
+        bool PopJob(const size_t queueIndex, Job& job)
+        {
+            WorkQueue& queue = *queues[queueIndex];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.jobs.empty())
+            {
+                return false;
+            }
+
+            job = queue.jobs.back();
+            queue.jobs.pop_back();
+            return true;
+        }
+
+        bool StealJob(const size_t queueIndex, Job& job)
+        {
+            const size_t queueCount = queues.size();
+            for (size_t i = 1; i < queueCount; ++i)
+            {
+                WorkQueue& queue = *queues[(queueIndex + i) % queueCount];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.jobs.empty())
+                {
+                    job = queue.jobs.front();
+                    queue.jobs.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    thread_local JobSystem::Impl::ThreadContext JobSystem::Impl::threadContext = {nullptr, 0};
+
+    JobSystem::Factory::Factory(ServiceCollection& serviceCollection)
+        : BaseFactory(serviceCollection)
+    {
+    }
+
+    std::unique_ptr<JobSystem> JobSystem::Factory::Create() const
+    {
+        ServiceCollection& serviceCollection = GetServiceCollection();
+        auto& logManager = serviceCollection.GetService<LogManager>();
+        const auto& configManager = serviceCollection.GetService<ConfigManager>();
+
+        // The thread calling into the job system runs jobs as well, so it is not counted.
+        const int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+        const int workerCount = configManager.GetInt("jobWorkerCount", hardwareThreads - 1);
+        return std::make_unique<JobSystem>(std::make_unique<Impl>(std::max(workerCount, 0), logManager));
+    }
+
+    JobSystem::~JobSystem() = default;
+
+    JobSystem::JobSystem(std::unique_ptr<Impl> impl)
+        : impl(std::move(impl))
+    {
+    }
+
+    JobSystem::JobSystem(JobSystem&& other) noexcept = default;
+
+    JobSystem& JobSystem::operator=(JobSystem&& rhs) noexcept = default;
+
+    size_t JobSystem::GetWorkerCount() const
+    {
+        return impl->GetWorkerCount();
+    }
+
+    void JobSystem::ParallelFor(const size_t count, const size_t chunkSize,
+                                const std::function<void(size_t begin, size_t end)>& function)
+    {
+        impl->ParallelFor(count, chunkSize, function);
+    }
+}
@@ -0,0 +1,205 @@
+#include "pluto/memory/frame_allocator.h"
+
+#include "pluto/service/service_collection.h"
+#include "pluto/log/log_manager.h"
+#include "pluto/event/event_manager.h"
+#include "pluto/simulation/events/on_main_loop_end.h"
+
+#include "pluto/runtime_id.h"
+#include "pluto/debug/assert.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace pluto
+{
+    class FrameAllocator::Impl
+    {
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+        struct Chunk
+        {
+            std::unique_ptr<uint8_t[]> data;
+            size_t size;
+        };
+
+        // Only the last chunk is bumped, the ones before it are full.
+        std::vector<Chunk> chunks;
+        size_t offset;
+        size_t usedBytes;
+        size_t highWaterMark;
+
+        std::thread::id ownerThread;
+
+        RuntimeId onMainLoopEndEventListenerId;
+
+        LogManager* logManager;
+        EventManager* eventManager;
+
+    public:
+        ~Impl()
+        {
+            eventManager->Unsubscribe<OnMainLoopEndEvent>(onMainLoopEndEventListenerId);
+            logManager->LogInfo("FrameAllocator terminated!");
+        }
+
+        Impl(LogManager& logManager, EventManager& eventManager)
+            : offset(0),
+              usedBytes(0),
+              highWaterMark(0),
+              ownerThread(std::this_thread::get_id()),
+              logManager(&logManager),
+              eventManager(&eventManager)
+        {
+            AddChunk(DEFAULT_CHUNK_SIZE);
+            onMainLoopEndEventListenerId = eventManager.Subscribe(*this, &Impl::OnMainLoopEnd);
+            logManager.LogInfo("FrameAllocator initialized!");
+        }
+
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = default;
+        Impl& operator=(const Impl& rhs) = delete;
+        Impl& operator=(Impl&& rhs) noexcept = default;
+
+        void* Allocate(const size_t size, const size_t alignment)
+        {
+            ASSERT_THAT_ARE_EQUAL(std::this_thread::get_id(), ownerThread);
+
+            size_t alignedOffset = Align(offset, alignment);
+            if (alignedOffset + size > chunks.back().size)
+            {
+                AddChunk(std::max(DEFAULT_CHUNK_SIZE, size + alignment));
+                alignedOffset = 0;
+            }
+
+            void* ptr = chunks.back().data.get() + alignedOffset;
+            usedBytes += alignedOffset - offset + size;
+            offset = alignedOffset + size;
+            highWaterMark = std::max(highWaterMark, usedBytes);
+            return ptr;
+        }
+
+        void Deallocate(void* ptr, const size_t size)
+        {
+            ASSERT_THAT_ARE_EQUAL(std::this_thread::get_id(), ownerThread);
+
+            // Only the latest allocation can be given back, which is the common case for a growing container.
+            uint8_t* top = chunks.back().data.get() + offset;
+            if (static_cast<uint8_t*>(ptr) + size == top)
+            {
+                offset -= size;
+                usedBytes -= size;
+            }
+        }
+
+        void Reset()
+        {
+            ASSERT_THAT_ARE_EQUAL(std::this_thread::get_id(), ownerThread);
+
+            // Merge the chunks used by the last frame, so the next one fits in a single block.
+            if (chunks.size() > 1)
+            {
+                size_t capacity = 0;
+                for (const Chunk& chunk : chunks)
+                {
+                    capacity += chunk.size;
+                }
+                chunks.clear();
+                AddChunk(capacity);
+            }
+            offset = 0;
+            usedBytes = 0;
+        }
+
+        size_t GetUsedBytes() const
+        {
+            return usedBytes;
+        }
+
+        size_t GetCapacity() const
+        {
+            size_t capacity = 0;
+            for (const Chunk& chunk : chunks)
+            {
+                capacity += chunk.size;
+            }
+            return capacity;
+        }
+
+        size_t GetHighWaterMark() const
+        {
+            return highWaterMark;
+        }
+
+    private:
+        void OnMainLoopEnd(const OnMainLoopEndEvent& evt)
+        {
+            Reset();
+        }
+
+        void AddChunk(const size_t size)
+        {
+            chunks.push_back({std::make_unique<uint8_t[]>(size), size});
+            offset = 0;
+        }
+
+        static size_t Align(const size_t value, const size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    };
+
+    FrameAllocator::Factory::Factory(ServiceCollection& serviceCollection)
+        : BaseFactory(serviceCollection)
+    {
+    }
+
+    std::unique_ptr<FrameAllocator> FrameAllocator::Factory::Create() const
+    {
+        ServiceCollection& serviceCollection = GetServiceCollection();
+        auto& logManager = serviceCollection.GetService<LogManager>();
+        auto& eventManager = serviceCollection.GetService<EventManager>();
+        return std::make_unique<FrameAllocator>(std::make_unique<Impl>(logManager, eventManager));
+    }
+
+    FrameAllocator::~FrameAllocator() = default;
+
+    FrameAllocator::FrameAllocator(std::unique_ptr<Impl> impl)
+        : impl(std::move(impl))
+    {
+    }
+
+    FrameAllocator::FrameAllocator(FrameAllocator&& other) noexcept = default;
+
+    FrameAllocator& FrameAllocator::operator=(FrameAllocator&& rhs) noexcept = default;
+
+    void* FrameAllocator::Allocate(const size_t size, const size_t alignment)
+    {
+        return impl->Allocate(size, alignment);
+    }
+
+    void FrameAllocator::Deallocate(void* ptr, const size_t size)
+    {
+        impl->Deallocate(ptr, size);
+    }
+
+    void FrameAllocator::Reset()
+    {
+        impl->Reset();
+    }
+
+    size_t FrameAllocator::GetUsedBytes() const
+    {
+        return impl->GetUsedBytes();
+    }
+
+    size_t FrameAllocator::GetCapacity() const
+    {
+        return impl->GetCapacity();
+    }
+
+    size_t FrameAllocator::GetHighWaterMark() const
+    {
+        return impl->GetHighWaterMark();
+    }
+}
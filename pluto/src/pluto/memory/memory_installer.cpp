@@ -1,6 +1,8 @@
 #include "pluto/memory/memory_installer.h"
 #include "pluto/memory/memory_manager.h"
-#include "pluto/memory/resource_control.h"
+#include "pluto/memory/memory_profiler.h"
+#include "pluto/memory/pool_allocator.h"
+#include "pluto/memory/frame_allocator.h"
 
 #include "pluto/service/service_collection.h"
 
@@ -8,13 +10,17 @@ namespace pluto
 {
     void MemoryInstaller::Install(ServiceCollection& serviceCollection)
     {
-        serviceCollection.AddFactory<ResourceControl>(std::make_unique<ResourceControl::Factory>(serviceCollection));
+        serviceCollection.AddService(PoolAllocator::Factory(serviceCollection).Create());
+        serviceCollection.AddService(FrameAllocator::Factory(serviceCollection).Create());
         serviceCollection.AddService(MemoryManager::Factory(serviceCollection).Create());
+        serviceCollection.AddService(MemoryProfiler::Factory(serviceCollection).Create());
     }
 
     void MemoryInstaller::Uninstall(ServiceCollection& serviceCollection)
     {
+        serviceCollection.RemoveService<MemoryProfiler>();
         serviceCollection.RemoveService<MemoryManager>();
-        serviceCollection.RemoveFactory<ResourceControl>();
+        serviceCollection.RemoveService<FrameAllocator>();
+        serviceCollection.RemoveService<PoolAllocator>();
     }
 }
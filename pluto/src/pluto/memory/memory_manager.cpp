@@ -2,33 +2,86 @@
 #include "pluto/memory/resource_control.h"
 #include "pluto/memory/resource.h"
 #include "pluto/memory/object.h"
+#include "pluto/memory/pool_allocator.h"
 
 #include "pluto/service/service_collection.h"
 #include "pluto/log/log_manager.h"
 #include "pluto/guid.h"
 #include "pluto/exception.h"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <typeindex>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace pluto
 {
     class MemoryManager::Impl
     {
-        std::unordered_map<Guid, std::shared_ptr<Object>> objects;
+        static constexpr uint32_t SLOTS_PER_PAGE = 4096;
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        struct Slot
+        {
+            ResourceControl control;
+            uint32_t denseIndex;
+            uint32_t nextFree;
+        };
+
+        // Sparse slots live in fixed size pages so their address never changes while the manager is alive.
+        // Slots of objects with a persisted id stay bound to that id and are never recycled: when the object is removed
+        // its resources read null, and when an object with the same id is added again they see it, without a lookup.
+        std::vector<std::unique_ptr<Slot[]>> pages;
+        uint32_t slotCount;
+        uint32_t freeHead;
+        uint32_t freeTail;
+
+        // Dense storage, objects[i] is owned by the slot denseToSlot[i].
+        std::vector<std::unique_ptr<Object>> objects;
+        std::vector<uint32_t> denseToSlot;
+
+        // Only objects with a persisted id are in the guid index, the others are found through the handle they keep.
+        // Guids are kept in the index after their object is removed, so the slot can be found again.
+        std::unordered_map<Guid, ObjectHandle> guidIndex;
+
+        std::unordered_map<std::type_index, TypeStats> typeStats;
+
+        // Kept apart from the stats, slots point at the counter of the type of the last object they held.
+        std::unordered_map<std::type_index, std::atomic<size_t>> staleReadCounts;
 
         LogManager* logManager;
-        ResourceControl::Factory* resourceControlFactory;
 
     public:
         ~Impl()
         {
+            // Objects may remove other objects when destroyed, so release them one by one keeping the map consistent.
+            while (!objects.empty())
+            {
+                Release(denseToSlot.back());
+            }
+
+            for (const auto& it : typeStats)
+            {
+                const size_t staleReadCount = staleReadCounts.at(it.first).load(std::memory_order_relaxed);
+                if (staleReadCount > 0)
+                {
+                    logManager->LogWarning(fmt::format("MemoryManager saw {0} reads of removed objects of type {1}.",
+                                                       staleReadCount, it.second.typeName));
+                }
+            }
+
             logManager->LogInfo("MemoryManager terminated!");
         }
 
-        Impl(LogManager& logManager, ResourceControl::Factory& resourceControlFactory)
-            : logManager(&logManager),
-              resourceControlFactory(&resourceControlFactory)
+        explicit Impl(LogManager& logManager)
+            : slotCount(0),
+              freeHead(INVALID_INDEX),
+              freeTail(INVALID_INDEX),
+              logManager(&logManager)
         {
             logManager.LogInfo("MemoryManager initialized!");
         }
@@ -43,47 +96,299 @@ namespace pluto
 
         Resource<Object> Add(std::unique_ptr<Object> object)
         {
-            const auto it = objects.find(object->GetId());
-            if (it != objects.end())
+            if (IsValid(object->handle))
+            {
+                Exception::Throw(std::runtime_error("Object with id already exists in memory manager."));
+            }
+
+            const uint32_t slotIndex = object->GetId() != Guid() ? BindSlot(object->GetId()) : AcquireSlot();
+            Slot& slot = GetSlot(slotIndex);
+            if (slot.denseIndex != INVALID_INDEX)
             {
                 Exception::Throw(std::runtime_error("Object with id already exists in memory manager."));
             }
 
-            std::shared_ptr<Object> ptr(object.release());
-            Resource<Object> resource(resourceControlFactory->Create(ptr));
-            objects.emplace(ptr->GetId(), ptr);
-            return resource;
+            slot.denseIndex = static_cast<uint32_t>(objects.size());
+            slot.control.object = object.get();
+
+            const ObjectHandle handle = slot.control.handle;
+            object->handle = handle;
+            TrackAdd(*object);
+            denseToSlot.push_back(slotIndex);
+            objects.push_back(std::move(object));
+            return Resource<Object>(slot.control, handle, objects.back()->GetId());
+        }
+
+        std::vector<Resource<Object>> AddRange(std::vector<std::unique_ptr<Object>> newObjects)
+        {
+            Reserve(newObjects.size());
+
+            std::vector<Resource<Object>> resources;
+            resources.reserve(newObjects.size());
+            for (auto& object : newObjects)
+            {
+                resources.push_back(Add(std::move(object)));
+            }
+            return resources;
+        }
+
+        void Reserve(const size_t count)
+        {
+            // Grows at least twofold, so many small batches do not copy the whole storage once each.
+            const size_t capacity = objects.size() + count;
+            if (capacity <= objects.capacity())
+            {
+                return;
+            }
+
+            const size_t newCapacity = std::max(capacity, objects.capacity() * 2);
+            objects.reserve(newCapacity);
+            denseToSlot.reserve(newCapacity);
         }
 
         Resource<Object> Get(const Guid& objectId) const
         {
-            const std::shared_ptr<Object> object = GetPtr(objectId);
+            return Get(GetHandle(objectId));
+        }
+
+        Resource<Object> Get(const ObjectHandle handle) const
+        {
+            Object* object = GetPtr(handle);
             if (object == nullptr)
             {
                 return nullptr;
             }
 
-            return Resource<Object>(resourceControlFactory->Create(object));
+            return Resource<Object>(*GetControl(handle), handle, object->GetId());
+        }
+
+        Resource<Object> GetReference(const Guid& objectId)
+        {
+            Slot& slot = GetSlot(BindSlot(objectId));
+            return Resource<Object>(slot.control, slot.control.handle, objectId);
         }
 
         void Remove(const Object& object)
         {
-            const auto it = objects.find(object.GetId());
-            if (it != objects.end())
+            Remove(object.handle);
+        }
+
+        void Remove(const ObjectHandle handle)
+        {
+            if (IsValid(handle))
             {
-                objects.erase(it);
+                Release(handle.GetIndex());
             }
         }
 
-        std::shared_ptr<Object> GetPtr(const Guid& objectId) const
+        Object* GetPtr(const Guid& objectId) const
         {
-            const auto it = objects.find(objectId);
-            if (it == objects.end())
+            return GetPtr(GetHandle(objectId));
+        }
+
+        Object* GetPtr(const ObjectHandle handle) const
+        {
+            if (!IsValid(handle))
             {
                 return nullptr;
             }
+
+            return GetSlot(handle.GetIndex()).control.object;
+        }
+
+        ObjectHandle GetHandle(const Guid& objectId) const
+        {
+            const auto it = guidIndex.find(objectId);
+            if (it == guidIndex.end() || !IsValid(it->second))
+            {
+                return ObjectHandle();
+            }
             return it->second;
         }
+
+        bool IsValid(const ObjectHandle handle) const
+        {
+            if (handle.IsNull() || handle.GetIndex() >= slotCount)
+            {
+                return false;
+            }
+
+            const Slot& slot = GetSlot(handle.GetIndex());
+            return slot.denseIndex != INVALID_INDEX && slot.control.handle == handle;
+        }
+
+        ResourceControl* GetControl(const ObjectHandle handle) const
+        {
+            if (!IsValid(handle))
+            {
+                return nullptr;
+            }
+
+            return &GetSlot(handle.GetIndex()).control;
+        }
+
+        size_t GetObjectCount() const
+        {
+            return objects.size();
+        }
+
+        std::vector<TypeStats> GetTypeStats() const
+        {
+            std::unordered_map<std::type_index, TypeStats> result = typeStats;
+            for (const auto& object : objects)
+            {
+                TypeStats& stats = result.at(typeid(*object));
+                stats.cpuPayloadBytes += object->GetCpuPayloadSize();
+                stats.gpuPayloadBytes += object->GetGpuPayloadSize();
+            }
+
+            for (auto& it : result)
+            {
+                it.second.staleReadCount = staleReadCounts.at(it.first).load(std::memory_order_relaxed);
+            }
+
+            std::vector<TypeStats> stats;
+            stats.reserve(result.size());
+            for (auto& it : result)
+            {
+                stats.push_back(std::move(it.second));
+            }
+            std::sort(stats.begin(), stats.end(), [](const TypeStats& lhs, const TypeStats& rhs)
+            {
+                return lhs.liveBytes > rhs.liveBytes;
+            });
+            return stats;
+        }
+
+    private:
+        Slot& GetSlot(const uint32_t index) const
+        {
+            return pages[index / SLOTS_PER_PAGE][index % SLOTS_PER_PAGE];
+        }
+
+        /*
+         * Slot the guid is bound to, a new one is bound the first time the guid is seen.
+         */
+        uint32_t BindSlot(const Guid& objectId)
+        {
+            const auto it = guidIndex.find(objectId);
+            if (it != guidIndex.end())
+            {
+                return it->second.GetIndex();
+            }
+
+            const uint32_t slotIndex = AcquireSlot();
+            guidIndex.emplace(objectId, GetSlot(slotIndex).control.handle);
+            return slotIndex;
+        }
+
+        uint32_t AcquireSlot()
+        {
+            if (freeHead != INVALID_INDEX)
+            {
+                const uint32_t index = freeHead;
+                freeHead = GetSlot(index).nextFree;
+                if (freeHead == INVALID_INDEX)
+                {
+                    freeTail = INVALID_INDEX;
+                }
+                return index;
+            }
+
+            if (slotCount > ObjectHandle::MAX_INDEX)
+            {
+                Exception::Throw(std::runtime_error("Memory manager ran out of object slots."));
+            }
+
+            if (slotCount % SLOTS_PER_PAGE == 0)
+            {
+                pages.emplace_back(std::make_unique<Slot[]>(SLOTS_PER_PAGE));
+            }
+
+            const uint32_t index = slotCount++;
+            Slot& slot = GetSlot(index);
+            slot.control.handle = ObjectHandle(index, ObjectHandle::NextGeneration(0));
+            slot.denseIndex = INVALID_INDEX;
+            slot.nextFree = INVALID_INDEX;
+            return index;
+        }
+
+        void TrackAdd(const Object& object)
+        {
+            const std::type_info& type = typeid(object);
+            auto it = typeStats.find(type);
+            if (it == typeStats.end())
+            {
+                it = typeStats.emplace(type, TypeStats{type.name(), 0, 0, 0, 0, 0, 0, 0}).first;
+                staleReadCounts.try_emplace(type, 0);
+            }
+
+            TypeStats& stats = it->second;
+            stats.liveCount += 1;
+            stats.liveBytes += GetAllocationSize(object);
+            stats.highWaterCount = std::max(stats.highWaterCount, stats.liveCount);
+            stats.highWaterBytes = std::max(stats.highWaterBytes, stats.liveBytes);
+        }
+
+        void TrackRemove(const Object& object)
+        {
+            TypeStats& stats = typeStats.at(typeid(object));
+            stats.liveCount -= 1;
+            stats.liveBytes -= GetAllocationSize(object);
+        }
+
+        static size_t GetAllocationSize(const Object& object)
+        {
+            const size_t objectSize = PoolAllocator::GetAllocationSize(dynamic_cast<const void*>(&object));
+            return objectSize + object.GetImplAllocationSize();
+        }
+
+        void Release(const uint32_t slotIndex)
+        {
+            Slot& slot = GetSlot(slotIndex);
+            const uint32_t denseIndex = slot.denseIndex;
+            std::unique_ptr<Object> object = std::move(objects[denseIndex]);
+
+            const uint32_t lastIndex = static_cast<uint32_t>(objects.size()) - 1;
+            if (denseIndex != lastIndex)
+            {
+                objects[denseIndex] = std::move(objects[lastIndex]);
+                denseToSlot[denseIndex] = denseToSlot[lastIndex];
+                GetSlot(denseToSlot[denseIndex]).denseIndex = denseIndex;
+            }
+            objects.pop_back();
+            denseToSlot.pop_back();
+
+            object->handle = ObjectHandle();
+            TrackRemove(*object);
+
+            slot.denseIndex = INVALID_INDEX;
+            slot.control.object = nullptr;
+            slot.control.staleReadCount = &staleReadCounts.at(typeid(*object));
+            if (object->GetId() != Guid())
+            {
+                // Bound slots keep their generation, the resources to the removed object see the next one added.
+                object.reset();
+                return;
+            }
+
+            // FIFO reuse delays the generation wrap around of hot slots.
+            const uint32_t generation = ObjectHandle::NextGeneration(slot.control.handle.GetGeneration());
+            slot.control.handle = ObjectHandle(slotIndex, generation);
+            slot.nextFree = INVALID_INDEX;
+            if (freeTail == INVALID_INDEX)
+            {
+                freeHead = slotIndex;
+            }
+            else
+            {
+                GetSlot(freeTail).nextFree = slotIndex;
+            }
+            freeTail = slotIndex;
+
+            // The destructor may re-enter the manager, the bookkeeping above must be done by now.
+            object.reset();
+        }
     };
 
     MemoryManager::Factory::Factory(ServiceCollection& serviceCollection)
@@ -95,9 +400,7 @@ namespace pluto
     {
         ServiceCollection& serviceCollection = GetServiceCollection();
         auto& logManager = serviceCollection.GetService<LogManager>();
-        ResourceControl::Factory& resourceControlFactory = serviceCollection.GetFactory<ResourceControl>();
-
-        return std::make_unique<MemoryManager>(std::make_unique<Impl>(logManager, resourceControlFactory));
+        return std::make_unique<MemoryManager>(std::make_unique<Impl>(logManager));
     }
 
     MemoryManager::~MemoryManager() = default;
@@ -116,18 +419,73 @@ namespace pluto
         return impl->Add(std::move(object));
     }
 
+    std::vector<Resource<Object>> MemoryManager::AddRange(std::vector<std::unique_ptr<Object>> objects)
+    {
+        return impl->AddRange(std::move(objects));
+    }
+
+    void MemoryManager::Reserve(const size_t count)
+    {
+        impl->Reserve(count);
+    }
+
     Resource<Object> MemoryManager::Get(const Guid& objectId) const
     {
         return impl->Get(objectId);
     }
 
+    Resource<Object> MemoryManager::Get(const ObjectHandle handle) const
+    {
+        return impl->Get(handle);
+    }
+
     void MemoryManager::Remove(const Object& object)
     {
         impl->Remove(object);
     }
 
-    std::shared_ptr<Object> MemoryManager::GetPtr(const Guid& objectId) const
+    void MemoryManager::Remove(const ObjectHandle handle)
+    {
+        impl->Remove(handle);
+    }
+
+    Resource<Object> MemoryManager::GetReference(const Guid& objectId)
+    {
+        return impl->GetReference(objectId);
+    }
+
+    Object* MemoryManager::GetPtr(const Guid& objectId) const
     {
         return impl->GetPtr(objectId);
     }
+
+    Object* MemoryManager::GetPtr(const ObjectHandle handle) const
+    {
+        return impl->GetPtr(handle);
+    }
+
+    ObjectHandle MemoryManager::GetHandle(const Guid& objectId) const
+    {
+        return impl->GetHandle(objectId);
+    }
+
+    ResourceControl* MemoryManager::GetControl(const ObjectHandle handle) const
+    {
+        return impl->GetControl(handle);
+    }
+
+    bool MemoryManager::IsValid(const ObjectHandle handle) const
+    {
+        return impl->IsValid(handle);
+    }
+
+    size_t MemoryManager::GetObjectCount() const
+    {
+        return impl->GetObjectCount();
+    }
+
+    std::vector<MemoryManager::TypeStats> MemoryManager::GetTypeStats() const
+    {
+        return impl->GetTypeStats();
+    }
 }
@@ -0,0 +1,158 @@
+#include "pluto/memory/memory_profiler.h"
+#include "pluto/memory/memory_manager.h"
+
+#include "pluto/service/service_collection.h"
+#include "pluto/config/config_manager.h"
+#include "pluto/event/event_manager.h"
+#include "pluto/log/log_manager.h"
+#include "pluto/file/file_manager.h"
+#include "pluto/file/file_stream_writer.h"
+#include "pluto/simulation/events/on_main_loop_end.h"
+
+#include "pluto/runtime_id.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace pluto
+{
+    class MemoryProfiler::Impl
+    {
+        Format format;
+        uint32_t interval;
+        uint64_t frame;
+        std::unique_ptr<FileStreamWriter> file;
+
+        RuntimeId onMainLoopEndEventListenerId;
+
+        LogManager* logManager;
+        EventManager* eventManager;
+        MemoryManager* memoryManager;
+
+    public:
+        ~Impl()
+        {
+            eventManager->Unsubscribe<OnMainLoopEndEvent>(onMainLoopEndEventListenerId);
+            logManager->LogInfo("MemoryProfiler terminated!");
+        }
+
+        Impl(const Format format, const uint32_t interval, std::unique_ptr<FileStreamWriter> file,
+             LogManager& logManager, EventManager& eventManager, MemoryManager& memoryManager)
+            : format(format),
+              interval(interval),
+              frame(0),
+              file(std::move(file)),
+              logManager(&logManager),
+              eventManager(&eventManager),
+              memoryManager(&memoryManager)
+        {
+            if (this->file != nullptr && format == Format::Csv)
+            {
+                this->file->Write(std::string(
+                    "frame,type,liveCount,liveBytes,highWaterCount,highWaterBytes,cpuPayloadBytes,gpuPayloadBytes,"
+                    "staleReadCount\n"));
+            }
+
+            onMainLoopEndEventListenerId = eventManager.Subscribe(*this, &Impl::OnMainLoopEnd);
+            logManager.LogInfo("MemoryProfiler initialized!");
+        }
+
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = default;
+        Impl& operator=(const Impl& rhs) = delete;
+        Impl& operator=(Impl&& rhs) noexcept = default;
+
+        void Dump(StreamWriter& writer, const Format format) const
+        {
+            const std::vector<MemoryManager::TypeStats> stats = memoryManager->GetTypeStats();
+            fmt::memory_buffer buffer;
+            const auto out = std::back_inserter(buffer);
+            if (format == Format::Csv)
+            {
+                for (const auto& it : stats)
+                {
+                    fmt::format_to(out, "{0},\"{1}\",{2},{3},{4},{5},{6},{7},{8}\n", frame, it.typeName, it.liveCount,
+                                   it.liveBytes, it.highWaterCount, it.highWaterBytes, it.cpuPayloadBytes,
+                                   it.gpuPayloadBytes, it.staleReadCount);
+                }
+            }
+            else
+            {
+                fmt::format_to(out, "{{\"frame\":{0},\"types\":[", frame);
+                for (size_t i = 0; i < stats.size(); ++i)
+                {
+                    const auto& it = stats[i];
+                    fmt::format_to(out,
+                                   "{0}{{\"type\":\"{1}\",\"liveCount\":{2},\"liveBytes\":{3},\"highWaterCount\":{4},"
+                                   "\"highWaterBytes\":{5},\"cpuPayloadBytes\":{6},\"gpuPayloadBytes\":{7},"
+                                   "\"staleReadCount\":{8}}}",
+                                   i == 0 ? "" : ",", it.typeName, it.liveCount, it.liveBytes, it.highWaterCount,
+                                   it.highWaterBytes, it.cpuPayloadBytes, it.gpuPayloadBytes, it.staleReadCount);
+                }
+                fmt::format_to(out, "]}}\n");
+            }
+            writer.Write(buffer.data(), buffer.size());
+        }
+
+    private:
+        void OnMainLoopEnd(const OnMainLoopEndEvent& evt)
+        {
+            ++frame;
+            if (file == nullptr || interval == 0 || frame % interval != 0)
+            {
+                return;
+            }
+
+            Dump(*file, format);
+            file->Flush();
+        }
+    };
+
+    MemoryProfiler::Factory::Factory(ServiceCollection& serviceCollection)
+        : BaseFactory(serviceCollection)
+    {
+    }
+
+    std::unique_ptr<MemoryProfiler> MemoryProfiler::Factory::Create() const
+    {
+        ServiceCollection& serviceCollection = GetServiceCollection();
+        auto& logManager = serviceCollection.GetService<LogManager>();
+        auto& eventManager = serviceCollection.GetService<EventManager>();
+        auto& memoryManager = serviceCollection.GetService<MemoryManager>();
+        const auto& configManager = serviceCollection.GetService<ConfigManager>();
+        const auto& fileManager = serviceCollection.GetService<FileManager>();
+
+        const int interval = configManager.GetInt("memoryProfilerInterval", 0);
+        const Format format = configManager.GetString("memoryProfilerFormat", "csv") == "json"
+                                  ? Format::Json
+                                  : Format::Csv;
+
+        std::unique_ptr<FileStreamWriter> file;
+        if (interval > 0)
+        {
+            const std::string defaultPath = format == Format::Json ? "memory_profile.json" : "memory_profile.csv";
+            file = fileManager.OpenWrite(configManager.GetString("memoryProfilerFile", defaultPath));
+        }
+
+        return std::make_unique<MemoryProfiler>(std::make_unique<Impl>(
+            format, std::max(interval, 0), std::move(file), logManager, eventManager, memoryManager));
+    }
+
+    MemoryProfiler::~MemoryProfiler() = default;
+
+    MemoryProfiler::MemoryProfiler(std::unique_ptr<Impl> impl)
+        : impl(std::move(impl))
+    {
+    }
+
+    MemoryProfiler::MemoryProfiler(MemoryProfiler&& other) noexcept = default;
+
+    MemoryProfiler& MemoryProfiler::operator=(MemoryProfiler&& rhs) noexcept = default;
+
+    void MemoryProfiler::Dump(StreamWriter& writer, const Format format) const
+    {
+        impl->Dump(writer, format);
+    }
+}
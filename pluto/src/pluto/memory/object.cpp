@@ -5,7 +5,15 @@ namespace pluto
 {
     Object::~Object() = default;
 
-    Object::Object() = default;
+    Object::Object()
+        : runtimeId(RuntimeId::New())
+    {
+    }
+
+    Object::Object(const RuntimeId runtimeId)
+        : runtimeId(runtimeId)
+    {
+    }
 
     Object::Object(Object&& other) noexcept = default;
 
@@ -13,11 +21,42 @@ namespace pluto
 
     bool Object::operator==(const Object& rhs) const
     {
-        return GetId() == rhs.GetId();
+        return runtimeId == rhs.runtimeId;
     }
 
     bool Object::operator!=(const Object& rhs) const
     {
         return !(*this == rhs);
     }
+
+    RuntimeId Object::GetRuntimeId() const
+    {
+        return runtimeId;
+    }
+
+    ObjectHandle Object::GetHandle() const
+    {
+        return handle;
+    }
+
+    const Guid& Object::GetId() const
+    {
+        static const Guid EMPTY;
+        return EMPTY;
+    }
+
+    size_t Object::GetCpuPayloadSize() const
+    {
+        return 0;
+    }
+
+    size_t Object::GetGpuPayloadSize() const
+    {
+        return 0;
+    }
+
+    size_t Object::GetImplAllocationSize() const
+    {
+        return 0;
+    }
 }
@@ -0,0 +1,239 @@
+#include "pluto/memory/pool_allocator.h"
+
+#include "pluto/service/service_collection.h"
+#include "pluto/log/log_manager.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <typeindex>
+#include <unordered_map>
+
+namespace pluto
+{
+    class Pool;
+
+    /*
+     * Header placed before every PoolObject.
+     * +------------+------+------------------------------------------------+
+     * | Offset     | Size | Description                                    |
+     * +------------+------+------------------------------------------------+
+     * | 0          | 8    | Owner pool, null when allocated from the heap. |
+     * | 8          | 8    | Size requested for the object.                 |
+     * +------------+------+------------------------------------------------+
+     */
+    struct alignas(std::max_align_t) BlockHeader
+    {
+        Pool* pool;
+        size_t size;
+    };
+
+    constexpr size_t HEADER_SIZE = sizeof(BlockHeader);
+    constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    class Pool
+    {
+        std::string typeName;
+        size_t blockSize;
+        size_t blocksPerChunk;
+
+        std::vector<std::unique_ptr<uint8_t[]>> chunks;
+        void* freeList;
+
+        size_t liveCount;
+        size_t highWaterMark;
+
+        // Set when the allocator goes away while the pool still has live objects, the last one to be freed deletes it.
+        bool isOrphaned;
+
+    public:
+        Pool(std::string typeName, const size_t objectSize)
+            : typeName(std::move(typeName)),
+              blockSize(HEADER_SIZE + (objectSize + HEADER_SIZE - 1) / HEADER_SIZE * HEADER_SIZE),
+              blocksPerChunk(std::max<size_t>(1, CHUNK_SIZE / blockSize)),
+              freeList(nullptr),
+              liveCount(0),
+              highWaterMark(0),
+              isOrphaned(false)
+        {
+        }
+
+        void* Allocate()
+        {
+            if (freeList == nullptr)
+            {
+                Grow();
+            }
+
+            void* block = freeList;
+            freeList = *static_cast<void**>(block);
+            highWaterMark = std::max(highWaterMark, ++liveCount);
+            return block;
+        }
+
+        /*
+         * Returns true when the pool is orphaned and this was its last live block, so the pool has to be deleted.
+         */
+        bool Free(void* block)
+        {
+            *static_cast<void**>(block) = freeList;
+            freeList = block;
+            --liveCount;
+            return isOrphaned && liveCount == 0;
+        }
+
+        void Orphan()
+        {
+            isOrphaned = true;
+        }
+
+        PoolAllocator::Stats GetStats() const
+        {
+            return {typeName, blockSize, chunks.size() * blocksPerChunk, liveCount, highWaterMark};
+        }
+
+    private:
+        void Grow()
+        {
+            // Blocks are threaded in address order so a fresh chunk is handed out contiguously.
+            auto chunk = std::make_unique<uint8_t[]>(blockSize * blocksPerChunk);
+            for (size_t i = blocksPerChunk; i > 0; --i)
+            {
+                void* block = chunk.get() + (i - 1) * blockSize;
+                *static_cast<void**>(block) = freeList;
+                freeList = block;
+            }
+            chunks.push_back(std::move(chunk));
+        }
+    };
+
+    class PoolAllocator::Impl
+    {
+        std::unordered_map<std::type_index, std::unique_ptr<Pool>> pools;
+
+        LogManager* logManager;
+
+    public:
+        explicit Impl(LogManager& logManager)
+            : logManager(&logManager)
+        {
+            logManager.LogInfo("PoolAllocator initialized!");
+        }
+
+        ~Impl()
+        {
+            for (auto& it : pools)
+            {
+                const Stats stats = it.second->GetStats();
+                if (stats.liveCount > 0)
+                {
+                    logManager->LogWarning(fmt::format("PoolAllocator terminated with {0} alive objects of type {1}.",
+                                                       stats.liveCount, stats.typeName));
+
+                    // Objects still point at their pool, it is kept until the last of them is released.
+                    it.second->Orphan();
+                    it.second.release();
+                }
+            }
+            logManager->LogInfo("PoolAllocator terminated!");
+        }
+
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = default;
+        Impl& operator=(const Impl& other) = delete;
+        Impl& operator=(Impl&& other) noexcept = default;
+
+        void* Allocate(const std::type_info& type, const size_t size)
+        {
+            auto it = pools.find(type);
+            if (it == pools.end())
+            {
+                it = pools.emplace(type, std::make_unique<Pool>(type.name(), size)).first;
+            }
+
+            Pool* pool = it->second.get();
+            auto* header = static_cast<BlockHeader*>(pool->Allocate());
+            header->pool = pool;
+            header->size = size;
+            return reinterpret_cast<uint8_t*>(header) + HEADER_SIZE;
+        }
+
+        std::vector<Stats> GetStats() const
+        {
+            std::vector<Stats> stats;
+            stats.reserve(pools.size());
+            for (const auto& it : pools)
+            {
+                stats.push_back(it.second->GetStats());
+            }
+            return stats;
+        }
+    };
+
+    PoolAllocator::Factory::Factory(ServiceCollection& serviceCollection)
+        : BaseFactory(serviceCollection)
+    {
+    }
+
+    std::unique_ptr<PoolAllocator> PoolAllocator::Factory::Create() const
+    {
+        ServiceCollection& serviceCollection = GetServiceCollection();
+        auto& logManager = serviceCollection.GetService<LogManager>();
+        return std::make_unique<PoolAllocator>(std::make_unique<Impl>(logManager));
+    }
+
+    PoolAllocator::~PoolAllocator() = default;
+
+    PoolAllocator::PoolAllocator(std::unique_ptr<Impl> impl)
+        : impl(std::move(impl))
+    {
+    }
+
+    PoolAllocator::PoolAllocator(PoolAllocator&& other) noexcept = default;
+
+    PoolAllocator& PoolAllocator::operator=(PoolAllocator&& rhs) noexcept = default;
+
+    void* PoolAllocator::Allocate(const std::type_info& type, const size_t size)
+    {
+        return impl->Allocate(type, size);
+    }
+
+    std::vector<PoolAllocator::Stats> PoolAllocator::GetStats() const
+    {
+        return impl->GetStats();
+    }
+
+    void* PoolAllocator::AllocateUnpooled(const size_t size)
+    {
+        auto* header = static_cast<BlockHeader*>(::operator new(HEADER_SIZE + size));
+        header->pool = nullptr;
+        header->size = size;
+        return reinterpret_cast<uint8_t*>(header) + HEADER_SIZE;
+    }
+
+    size_t PoolAllocator::GetAllocationSize(const void* ptr)
+    {
+        const auto* header = reinterpret_cast<const BlockHeader*>(static_cast<const uint8_t*>(ptr) - HEADER_SIZE);
+        return header->size;
+    }
+
+    void PoolAllocator::Release(void* ptr) noexcept
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+
+        auto* header = reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(ptr) - HEADER_SIZE);
+        if (header->pool == nullptr)
+        {
+            ::operator delete(header);
+            return;
+        }
+        Pool* pool = header->pool;
+        if (pool->Free(header))
+        {
+            delete pool;
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#include "pluto/memory/pool_object.h"
+#include "pluto/memory/pool_allocator.h"
+
+namespace pluto
+{
+    void* PoolObject::operator new(const size_t size)
+    {
+        return PoolAllocator::AllocateUnpooled(size);
+    }
+
+    void* PoolObject::operator new(size_t, void* where) noexcept
+    {
+        return where;
+    }
+
+    void PoolObject::operator delete(void* ptr) noexcept
+    {
+        PoolAllocator::Release(ptr);
+    }
+
+    void PoolObject::operator delete(void* ptr, void*) noexcept
+    {
+        PoolAllocator::Release(ptr);
+    }
+}
@@ -17,8 +17,7 @@ namespace pluto
         std::vector<Vector2F> contactPoints;
 
     public:
-        Impl(Resource<Collider2D> collider, Resource<Collider2D> otherCollider,
-             std::vector<Vector2F> contactPoints)
+        Impl(Resource<Collider2D> collider, Resource<Collider2D> otherCollider, std::vector<Vector2F> contactPoints)
             : collider(std::move(collider)),
               otherCollider(std::move(otherCollider)),
               contactPoints(std::move(contactPoints))
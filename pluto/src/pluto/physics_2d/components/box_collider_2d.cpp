@@ -2,6 +2,7 @@
 #include "pluto/physics_2d/components/collider_2d.impl.hpp"
 #include "pluto/physics_2d/shapes/physics_2d_box_shape.h"
 #include "pluto/physics_2d/physics_2d_manager.h"
+#include "pluto/memory/pool_allocator.h"
 
 #include "pluto/service/service_collection.h"
 
@@ -12,9 +13,9 @@ namespace pluto
         std::unique_ptr<Physics2DBoxShape> shape;
 
     public:
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject, std::unique_ptr<Physics2DBoxShape> shape,
-             const std::shared_ptr<Physics2DBody>& body)
-            : Collider2D::Impl(guid, gameObject, *shape, body),
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject,
+             std::unique_ptr<Physics2DBoxShape> shape, const std::shared_ptr<Physics2DBody>& body)
+            : Collider2D::Impl(runtimeId, gameObject, *shape, body),
               shape(std::move(shape))
         {
         }
@@ -41,10 +42,13 @@ namespace pluto
         auto& physics2DManager = serviceCollection.GetService<Physics2DManager>();
         std::shared_ptr<Physics2DBody> body = physics2DManager.GetOrCreateBody(gameObject);
 
-        Guid colliderId = Guid::New();
-        std::unique_ptr<Physics2DBoxShape> shape = body->CreateBoxShape(colliderId, Vector2F::ZERO, Vector2F::ONE);
-        return std::make_unique<BoxCollider2D>(
-            std::make_unique<Impl>(colliderId, gameObject, std::move(shape), body));
+        std::unique_ptr<Physics2DBoxShape> shape = body->CreateBoxShape(Vector2F::ZERO, Vector2F::ONE);
+        Physics2DBoxShape& shapeRef = *shape;
+        auto& poolAllocator = serviceCollection.GetService<PoolAllocator>();
+        std::unique_ptr<BoxCollider2D> collider = poolAllocator.New<BoxCollider2D>(
+            poolAllocator.New<Impl>(RuntimeId::New(), gameObject, std::move(shape), body));
+        shapeRef.SetCollider(*collider);
+        return collider;
     }
 
     BoxCollider2D::~BoxCollider2D() = default;
@@ -2,6 +2,7 @@
 #include "pluto/physics_2d/components/collider_2d.impl.hpp"
 #include "pluto/physics_2d/shapes/physics_2d_circle_shape.h"
 #include "pluto/physics_2d/physics_2d_manager.h"
+#include "pluto/memory/pool_allocator.h"
 
 #include "pluto/service/service_collection.h"
 
@@ -12,9 +13,9 @@ namespace pluto
         std::unique_ptr<Physics2DCircleShape> shape;
 
     public:
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject, std::unique_ptr<Physics2DCircleShape> shape,
-             const std::shared_ptr<Physics2DBody>& body)
-            : Collider2D::Impl(guid, gameObject, *shape, body),
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject,
+             std::unique_ptr<Physics2DCircleShape> shape, const std::shared_ptr<Physics2DBody>& body)
+            : Collider2D::Impl(runtimeId, gameObject, *shape, body),
               shape(std::move(shape))
         {
         }
@@ -40,10 +41,13 @@ namespace pluto
         ServiceCollection& serviceCollection = GetServiceCollection();
         auto& physics2DManager = serviceCollection.GetService<Physics2DManager>();
         std::shared_ptr<Physics2DBody> body = physics2DManager.GetOrCreateBody(gameObject);
-        Guid colliderId = Guid::New();
-        std::unique_ptr<Physics2DCircleShape> shape = body->CreateCircleShape(colliderId, Vector2F::ZERO, 1);
-        return std::make_unique<CircleCollider2D>(
-            std::make_unique<Impl>(colliderId, gameObject, std::move(shape), body));
+        std::unique_ptr<Physics2DCircleShape> shape = body->CreateCircleShape(Vector2F::ZERO, 1);
+        Physics2DCircleShape& shapeRef = *shape;
+        auto& poolAllocator = serviceCollection.GetService<PoolAllocator>();
+        std::unique_ptr<CircleCollider2D> collider = poolAllocator.New<CircleCollider2D>(
+            poolAllocator.New<Impl>(RuntimeId::New(), gameObject, std::move(shape), body));
+        shapeRef.SetCollider(*collider);
+        return collider;
     }
 
     CircleCollider2D::~CircleCollider2D() = default;
@@ -69,4 +69,14 @@ namespace pluto
     {
         impl->OnLateFixedUpdate();
     }
+
+    void Collider2D::OnEnable()
+    {
+        impl->OnEnable();
+    }
+
+    void Collider2D::OnDisable()
+    {
+        impl->OnDisable();
+    }
 }
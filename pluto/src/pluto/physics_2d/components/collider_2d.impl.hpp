@@ -27,9 +27,9 @@ namespace pluto
         std::shared_ptr<Physics2DBody> body;
 
     public:
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject, Physics2DShape& shape,
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject, Physics2DShape& shape,
              std::shared_ptr<Physics2DBody> body)
-            : Component::Impl(guid, gameObject),
+            : Component::Impl(runtimeId, gameObject),
               lastPosition(body->GetPosition()),
               lastAngle(body->GetAngle()),
               shape(&shape),
@@ -102,5 +102,15 @@ namespace pluto
             lastPosition = body->GetPosition();
             lastAngle = body->GetAngle();
         }
+
+        void OnEnable()
+        {
+            body->SetActive(true);
+        }
+
+        void OnDisable()
+        {
+            body->SetActive(false);
+        }
     };
 }
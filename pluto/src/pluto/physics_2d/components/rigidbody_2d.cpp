@@ -7,13 +7,14 @@
 #include "pluto/scene/components/transform.h"
 #include "pluto/scene/components/component.impl.hpp"
 #include "pluto/memory/resource.h"
+#include "pluto/memory/pool_allocator.h"
 
 #include "pluto/math/math.h"
 #include "pluto/math/vector2f.h"
 #include "pluto/math/vector3f.h"
 #include "pluto/math/quaternion.h"
 
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 
 namespace pluto
 {
@@ -26,9 +27,9 @@ namespace pluto
         std::shared_ptr<Physics2DBody> body;
 
     public:
-        explicit Impl(const Guid& guid, const Resource<GameObject>& gameObject,
+        explicit Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject,
                       std::shared_ptr<Physics2DBody> body)
-            : Component::Impl(guid, gameObject),
+            : Component::Impl(runtimeId, gameObject),
               lastPosition(body->GetPosition()),
               lastAngle(body->GetAngle()),
               transform(gameObject->GetTransform()),
@@ -124,6 +125,16 @@ namespace pluto
             transformEulerAngles.z = lastAngle;
             transform->SetRotation(Quaternion::Euler(transformEulerAngles));
         }
+
+        void OnEnable()
+        {
+            body->SetActive(true);
+        }
+
+        void OnDisable()
+        {
+            body->SetActive(false);
+        }
     };
 
     Rigidbody2D::Factory::Factory(ServiceCollection& serviceCollection)
@@ -137,7 +148,8 @@ namespace pluto
         auto& physics2DManager = serviceCollection.GetService<Physics2DManager>();
         std::shared_ptr<Physics2DBody> body = physics2DManager.CreateBody(gameObject);
         body->SetType(Physics2DBody::Type::Dynamic);
-        return std::make_unique<Rigidbody2D>(std::make_unique<Impl>(Guid::New(), gameObject, body));
+        auto& poolAllocator = serviceCollection.GetService<PoolAllocator>();
+        return poolAllocator.New<Rigidbody2D>(poolAllocator.New<Impl>(RuntimeId::New(), gameObject, body));
     }
 
     Rigidbody2D::~Rigidbody2D() = default;
@@ -216,4 +228,14 @@ namespace pluto
     {
         impl->OnLateFixedUpdate();
     }
+
+    void Rigidbody2D::OnEnable()
+    {
+        impl->OnEnable();
+    }
+
+    void Rigidbody2D::OnDisable()
+    {
+        impl->OnDisable();
+    }
 }
@@ -16,7 +16,7 @@ namespace pluto
 {
     class Physics2DBody::Impl
     {
-        std::unique_ptr<Guid> gameObjectId;
+        std::unique_ptr<RuntimeId> gameObjectId;
         float density;
 
         b2Body* body;
@@ -32,7 +32,7 @@ namespace pluto
             body = nullptr;
         }
 
-        Impl(std::unique_ptr<Guid> gameObjectId, b2Body& body, Physics2DCircleShape::Factory& circleShapeFactory,
+        Impl(std::unique_ptr<RuntimeId> gameObjectId, b2Body& body, Physics2DCircleShape::Factory& circleShapeFactory,
              Physics2DBoxShape::Factory& boxShapeFactory)
             : gameObjectId(std::move(gameObjectId)),
               density(1.0f),
@@ -100,6 +100,16 @@ namespace pluto
             }
         }
 
+        bool IsActive() const
+        {
+            return body->IsActive();
+        }
+
+        void SetActive(const bool value)
+        {
+            body->SetActive(value);
+        }
+
         float GetGravityScale() const
         {
             return body->GetGravityScale();
@@ -167,16 +177,14 @@ namespace pluto
             body->ApplyTorque(torque, true);
         }
 
-        std::unique_ptr<Physics2DCircleShape> CreateCircleShape(const Guid& colliderId, const Vector2F& offset,
-                                                                const float radius)
+        std::unique_ptr<Physics2DCircleShape> CreateCircleShape(const Vector2F& offset, const float radius)
         {
-            return circleShapeFactory->Create(*instance, colliderId, offset, radius);
+            return circleShapeFactory->Create(*instance, offset, radius);
         }
 
-        std::unique_ptr<Physics2DBoxShape> CreateBoxShape(const Guid& colliderId, const Vector2F& offset,
-                                                          const Vector2F& size)
+        std::unique_ptr<Physics2DBoxShape> CreateBoxShape(const Vector2F& offset, const Vector2F& size)
         {
-            return boxShapeFactory->Create(*instance, colliderId, offset, size);
+            return boxShapeFactory->Create(*instance, offset, size);
         }
 
         void* GetNativeBody() const
@@ -198,7 +206,7 @@ namespace pluto
         auto& circleShapeFactory = serviceCollection.GetFactory<Physics2DCircleShape>();
         auto& boxShapeFactory = serviceCollection.GetFactory<Physics2DBoxShape>();
 
-        std::unique_ptr<Guid> gameObjectId = std::make_unique<Guid>(gameObject.GetObjectId());
+        std::unique_ptr<RuntimeId> gameObjectId = std::make_unique<RuntimeId>(gameObject->GetRuntimeId());
 
         b2BodyDef bodyDef;
         bodyDef.position = {position.x, position.y};
@@ -245,6 +253,16 @@ namespace pluto
         impl->SetType(value);
     }
 
+    bool Physics2DBody::IsActive() const
+    {
+        return impl->IsActive();
+    }
+
+    void Physics2DBody::SetActive(const bool value)
+    {
+        impl->SetActive(value);
+    }
+
     float Physics2DBody::GetGravityScale() const
     {
         return impl->GetGravityScale();
@@ -310,16 +328,14 @@ namespace pluto
         impl->AddTorque(torque);
     }
 
-    std::unique_ptr<Physics2DCircleShape> Physics2DBody::CreateCircleShape(
-        const Guid& colliderId, const Vector2F& offset, const float radius)
+    std::unique_ptr<Physics2DCircleShape> Physics2DBody::CreateCircleShape(const Vector2F& offset, const float radius)
     {
-        return impl->CreateCircleShape(colliderId, offset, radius);
+        return impl->CreateCircleShape(offset, radius);
     }
 
-    std::unique_ptr<Physics2DBoxShape> Physics2DBody::CreateBoxShape(const Guid& colliderId, const Vector2F& offset,
-                                                                     const Vector2F& size)
+    std::unique_ptr<Physics2DBoxShape> Physics2DBody::CreateBoxShape(const Vector2F& offset, const Vector2F& size)
     {
-        return impl->CreateBoxShape(colliderId, offset, size);
+        return impl->CreateBoxShape(offset, size);
     }
 
     void* Physics2DBody::GetNativeBody() const
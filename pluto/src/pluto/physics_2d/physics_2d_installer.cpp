@@ -21,6 +21,10 @@ namespace pluto
         serviceCollection.EmplaceFactory<BoxCollider2D>();
         serviceCollection.EmplaceFactory<Collision2D>();
         serviceCollection.AddService<Physics2DManager>(Physics2DManager::Factory(serviceCollection).Create());
+
+        Component::RegisterType<Rigidbody2D>("Rigidbody2D");
+        Component::RegisterType<CircleCollider2D>("CircleCollider2D");
+        Component::RegisterType<BoxCollider2D>("BoxCollider2D");
     }
 
     void Physics2DInstaller::Uninstall(ServiceCollection& serviceCollection)
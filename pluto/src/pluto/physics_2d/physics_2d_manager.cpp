@@ -10,12 +10,14 @@
 #include "pluto/log/log_manager.h"
 #include "pluto/event/event_manager.h"
 #include "pluto/memory/memory_manager.h"
+#include "pluto/memory/frame_allocator.h"
 
 #include "pluto/render/events/on_pre_render_event.h"
 
 #include "pluto/render/render_manager.h"
 
 #include "pluto/memory/resource.h"
+#include "pluto/memory/object_handle.h"
 
 #include "pluto/scene/components/transform.h"
 #include "pluto/scene/game_object.h"
@@ -25,23 +27,39 @@
 #include "pluto/math/vector3f.h"
 #include "pluto/math/quaternion.h"
 
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 
 #include <Box2D/Box2D.h>
 
 #include <unordered_map>
 #include <iostream>
+#include <vector>
 
 namespace pluto
 {
     class PhysicsContactListener final : public b2ContactListener
     {
+        struct Contact final
+        {
+            Resource<Collider2D> colliderA;
+            Resource<Collider2D> colliderB;
+            FrameVector<Vector2F> contactPoints;
+            bool isSensor;
+            bool isBegin;
+        };
+
         MemoryManager* memoryManager;
+        FrameAllocator* frameAllocator;
         Collision2D::Factory* collisionFactory;
 
+        // Contacts are reported after the step, the world is locked while it runs and callbacks could not change it.
+        std::vector<Contact> contacts;
+
     public:
-        explicit PhysicsContactListener(MemoryManager& memoryManager, Collision2D::Factory& collisionFactory)
+        explicit PhysicsContactListener(MemoryManager& memoryManager, FrameAllocator& frameAllocator,
+                                        Collision2D::Factory& collisionFactory)
             : memoryManager(&memoryManager),
+              frameAllocator(&frameAllocator),
               collisionFactory(&collisionFactory)
         {
         }
@@ -56,6 +74,29 @@ namespace pluto
             HandleContact(*contact, false);
         }
 
+        void DispatchContacts()
+        {
+            // Destroying a body from a callback reports its contacts right away, so the vector may grow meanwhile.
+            for (size_t i = 0; i < contacts.size(); ++i)
+            {
+                const Contact contact = std::move(contacts[i]);
+                if (contact.colliderA == nullptr || contact.colliderB == nullptr)
+                {
+                    continue;
+                }
+
+                if (contact.isSensor)
+                {
+                    HandleSensor(contact.colliderA, contact.colliderB, contact.isBegin);
+                }
+                else
+                {
+                    HandleCollision(contact.colliderA, contact.colliderB, contact.contactPoints, contact.isBegin);
+                }
+            }
+            contacts.clear();
+        }
+
     private:
         void HandleContact(const b2Contact& contact, const bool isBegin)
         {
@@ -77,27 +118,27 @@ namespace pluto
 
             if (fixtureA->IsSensor())
             {
-                HandleSensor(colliderB, colliderA, isBegin);
+                contacts.push_back({colliderB, colliderA, FrameVector<Vector2F>(*frameAllocator), true, isBegin});
             }
             else if (fixtureB->IsSensor())
             {
-                HandleSensor(colliderA, colliderB, isBegin);
+                contacts.push_back({colliderA, colliderB, FrameVector<Vector2F>(*frameAllocator), true, isBegin});
             }
             else
             {
-                HandleCollision(colliderA, colliderB, *contact.GetManifold(), isBegin);
+                contacts.push_back({
+                    colliderA, colliderB, GetContactPoints(*contact.GetManifold()), false, isBegin
+                });
             }
         }
 
         void HandleCollision(const Resource<Collider2D>& colliderA, const Resource<Collider2D>& colliderB,
-                             const b2Manifold& manifold, const bool isBegin)
+                             const FrameVector<Vector2F>& contactPoints, const bool isBegin)
         {
-            const std::vector<Vector2F> contactPoints = GetContactPoints(manifold);
-
-            const std::unique_ptr<Collision2D> collisionA = collisionFactory->Create(
-                colliderA, colliderB, contactPoints);
-            const std::unique_ptr<Collision2D> collisionB = collisionFactory->Create(
-                colliderB, colliderA, contactPoints);
+            // Collisions are handed to behaviours that may keep them past the frame, so they own their points.
+            const std::vector<Vector2F> points(contactPoints.begin(), contactPoints.end());
+            const std::unique_ptr<Collision2D> collisionA = collisionFactory->Create(colliderA, colliderB, points);
+            const std::unique_ptr<Collision2D> collisionB = collisionFactory->Create(colliderB, colliderA, points);
 
             if (isBegin)
             {
@@ -125,13 +166,14 @@ namespace pluto
 
         Resource<Collider2D> GetCollider(const b2Fixture& fixture) const
         {
-            Guid* colliderId = reinterpret_cast<Guid*>(fixture.GetUserData());
-            return ResourceUtils::Cast<Collider2D>(memoryManager->Get(*colliderId));
+            const auto* collider = reinterpret_cast<Object*>(fixture.GetUserData());
+            return ResourceUtils::Cast<Collider2D>(memoryManager->Get(collider->GetHandle()));
         }
 
-        static std::vector<Vector2F> GetContactPoints(const b2Manifold& manifold)
+        FrameVector<Vector2F> GetContactPoints(const b2Manifold& manifold) const
         {
-            std::vector<Vector2F> contactPoints;
+            FrameVector<Vector2F> contactPoints(*frameAllocator);
+            contactPoints.reserve(manifold.pointCount);
             for (int i = 0; i < manifold.pointCount; ++i)
             {
                 const b2Vec2 point = manifold.points[i].localPoint;
@@ -201,10 +243,11 @@ namespace pluto
         std::unique_ptr<b2World> world;
         std::unique_ptr<PhysicsContactListener> contactListener;
         std::unique_ptr<PhysicsDebugDrawer> debugDrawer;
-        std::unordered_map<Guid, std::shared_ptr<Physics2DBody>> bodies;
+        // Keyed on the handle, it is read from the resource without dereferencing a game object that may be removed.
+        std::unordered_map<ObjectHandle, std::shared_ptr<Physics2DBody>> bodies;
 
-        Guid onFixedUpdateEventListenerId;
-        Guid onPreRenderEventListenerId;
+        RuntimeId onFixedUpdateEventListenerId;
+        RuntimeId onPreRenderEventListenerId;
 
         LogManager* logManager;
         EventManager* eventManager;
@@ -252,13 +295,13 @@ namespace pluto
 
         bool HasBody(const Resource<GameObject>& gameObject) const
         {
-            return bodies.find(gameObject.GetObjectId()) != bodies.end();
+            return bodies.find(gameObject.GetHandle()) != bodies.end();
         }
 
         std::shared_ptr<Physics2DBody> GetBody(const Resource<GameObject>& gameObject) const
         {
             ASSERT_THAT_IS_TRUE(HasBody(gameObject));
-            return bodies.find(gameObject.GetObjectId())->second;
+            return bodies.find(gameObject.GetHandle())->second;
         }
 
         std::shared_ptr<Physics2DBody> CreateBody(const Resource<GameObject>& gameObject)
@@ -272,7 +315,10 @@ namespace pluto
             std::shared_ptr<Physics2DBody> body = bodyFactory->Create(gameObject, {position.x, position.y},
                                                                       eulerAngles.z);
 
-            bodies.emplace(gameObject.GetObjectId(), body);
+            // Afterwards the components keep the body in sync through OnEnable and OnDisable.
+            body->SetActive(gameObject->IsGloballyActive());
+
+            bodies.emplace(gameObject.GetHandle(), body);
             return body;
         }
 
@@ -296,16 +342,12 @@ namespace pluto
                 }
                 else
                 {
-                    auto* body = reinterpret_cast<b2Body*>(it->second->GetNativeBody());
-                    Guid* gameObjectId = reinterpret_cast<Guid*>(body->GetUserData());
-                    Resource<GameObject> gameObject = ResourceUtils::Cast<GameObject
-                    >(memoryManager->Get(*gameObjectId));
-                    body->SetActive(gameObject->IsGloballyActive());
                     ++it;
                 }
             }
 
             world->Step(0.02f, 6, 2);
+            contactListener->DispatchContacts();
         }
 
         void OnPreRender(const OnPreRenderEvent& evt)
@@ -330,11 +372,12 @@ namespace pluto
 
         auto& renderManager = serviceCollection.GetService<RenderManager>();
         auto& memoryManager = serviceCollection.GetService<MemoryManager>();
+        auto& frameAllocator = serviceCollection.GetService<FrameAllocator>();
         Collision2D::Factory& collisionFactory = serviceCollection.GetFactory<Collision2D>();
 
         return std::make_unique<Physics2DManager>(std::make_unique<Impl>(
             logManager, eventManager, memoryManager, bodyFactory,
-            std::make_unique<PhysicsContactListener>(memoryManager, collisionFactory),
+            std::make_unique<PhysicsContactListener>(memoryManager, frameAllocator, collisionFactory),
             std::make_unique<PhysicsDebugDrawer>(renderManager)));
     }
 
@@ -47,4 +47,9 @@ namespace pluto
     {
         impl->SetTrigger(value);
     }
+
+    void Physics2DShape::SetCollider(Object& collider)
+    {
+        impl->SetCollider(collider);
+    }
 }
@@ -1,7 +1,7 @@
 #pragma once
 
-#include "pluto/guid.h"
 #include "pluto/physics_2d/shapes/physics_2d_shape.h"
+#include "pluto/memory/object.h"
 
 #include <Box2D/Box2D.h>
 
@@ -10,7 +10,6 @@ namespace pluto
     class Physics2DShape::Impl
     {
     protected:
-        std::unique_ptr<Guid> colliderId;
         b2Fixture* fixture;
 
     public:
@@ -20,9 +19,8 @@ namespace pluto
             body->DestroyFixture(fixture);
         }
 
-        explicit Impl(std::unique_ptr<Guid> colliderId, b2Fixture& fixture)
-            : colliderId(std::move(colliderId)),
-              fixture(&fixture)
+        explicit Impl(b2Fixture& fixture)
+            : fixture(&fixture)
         {
         }
 
@@ -60,5 +58,10 @@ namespace pluto
         {
             fixture->SetSensor(value);
         }
+
+        void SetCollider(Object& collider)
+        {
+            fixture->SetUserData(&collider);
+        }
     };
 }
@@ -1,11 +1,15 @@
 #include "pluto/render/gl/gl_mesh_buffer.h"
 #include "pluto/asset/mesh_asset.h"
 
+#include "pluto/render/gl/gl_state_cache.h"
 #include "pluto/render/gl/gl_call.h"
 
+#include "pluto/service/service_collection.h"
+
 #include "pluto/math/vector2f.h"
 #include "pluto/math/vector3f.h"
 #include "pluto/math/vector3i.h"
+#include "pluto/math/matrix4x4.h"
 
 #include <GL/glew.h>
 
@@ -19,28 +23,45 @@ namespace pluto
         const uint32_t vertexArrayObject;
         const uint32_t indexBufferObject;
         const std::vector<uint32_t> vertexBufferObjects;
+        GlStateCache* stateCache;
+
+        // Created on the first instanced draw, with the model matrices at the locations 2 to 5 of the vertex array.
+        uint32_t instanceBufferObject;
 
     public:
         Impl(const int verticesCount, const uint32_t vertexArrayObject, const uint32_t indexBufferObject,
-             std::vector<uint32_t> vertexBufferObjects)
+             std::vector<uint32_t> vertexBufferObjects, GlStateCache& stateCache)
             : verticesCount(verticesCount),
               vertexArrayObject(vertexArrayObject),
               indexBufferObject(indexBufferObject),
-              vertexBufferObjects(std::move(vertexBufferObjects))
+              vertexBufferObjects(std::move(vertexBufferObjects)),
+              stateCache(&stateCache),
+              instanceBufferObject(0)
         {
         }
 
         ~Impl()
         {
-            GL_CALL(glDeleteVertexArrays(1, &vertexArrayObject));
-            GL_CALL(glDeleteBuffers(1, &indexBufferObject));
-            GL_CALL(glDeleteBuffers(vertexBufferObjects.size(), &vertexBufferObjects[0]));
+            stateCache->DeleteVertexArray(vertexArrayObject);
+            stateCache->DeleteBuffer(indexBufferObject);
+            for (const uint32_t vertexBufferObject : vertexBufferObjects)
+            {
+                if (vertexBufferObject != 0)
+                {
+                    stateCache->DeleteBuffer(vertexBufferObject);
+                }
+            }
+
+            if (instanceBufferObject != 0)
+            {
+                stateCache->DeleteBuffer(instanceBufferObject);
+            }
         }
 
         void Bind()
         {
-            GL_CALL(glBindVertexArray(vertexArrayObject));
-            GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject));
+            stateCache->BindVertexArray(vertexArrayObject);
+            stateCache->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject);
         }
 
         void Unbind()
@@ -50,9 +71,36 @@ namespace pluto
 
         void Draw()
         {
-            Bind();
             GL_CALL(glDrawElements(GL_TRIANGLES, verticesCount, GL_UNSIGNED_INT, nullptr));
         }
+
+        void DrawInstanced(const Matrix4X4* modelMatrices, const size_t instancesCount)
+        {
+            if (instanceBufferObject == 0)
+            {
+                CreateInstanceBufferObject();
+            }
+
+            stateCache->BindBuffer(GL_ARRAY_BUFFER, instanceBufferObject);
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, instancesCount * sizeof(Matrix4X4), modelMatrices, GL_STREAM_DRAW));
+            GL_CALL(glDrawElementsInstanced(GL_TRIANGLES, verticesCount, GL_UNSIGNED_INT, nullptr,
+                static_cast<GLsizei>(instancesCount)));
+        }
+
+    private:
+        void CreateInstanceBufferObject()
+        {
+            GL_CALL(glGenBuffers(1, &instanceBufferObject));
+            stateCache->BindBuffer(GL_ARRAY_BUFFER, instanceBufferObject);
+            for (uint32_t column = 0; column < 4; ++column)
+            {
+                const uint32_t location = INSTANCE_MODEL_LOCATION + column;
+                const auto offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(column * 4 * sizeof(float)));
+                GL_CALL(glEnableVertexAttribArray(location));
+                GL_CALL(glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(Matrix4X4), offset));
+                GL_CALL(glVertexAttribDivisor(location, 1));
+            }
+        }
     };
 
     GlMeshBuffer::Factory::Factory(ServiceCollection& serviceCollection)
@@ -62,13 +110,13 @@ namespace pluto
 
     template <typename T>
     void CreateVertexBufferObject(const uint32_t stride, const std::vector<T>& values,
-                                  std::vector<uint32_t>& vertexBufferObjects)
+                                  std::vector<uint32_t>& vertexBufferObjects, GlStateCache& stateCache)
     {
         uint32_t vertexArrayObject = 0;
         if (!values.empty())
         {
             GL_CALL(glGenBuffers(1, &vertexArrayObject));
-            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vertexArrayObject));
+            stateCache.BindBuffer(GL_ARRAY_BUFFER, vertexArrayObject);
             GL_CALL(glBufferData(GL_ARRAY_BUFFER, values.size() * sizeof(T), values.data(), GL_STATIC_DRAW));
             GL_CALL(glEnableVertexAttribArray(vertexBufferObjects.size()));
             GL_CALL(glVertexAttribPointer(vertexBufferObjects.size(), stride, GL_FLOAT, GL_FALSE, 0, nullptr));
@@ -78,18 +126,20 @@ namespace pluto
 
     std::unique_ptr<MeshBuffer> GlMeshBuffer::Factory::Create(const MeshAsset& mesh) const
     {
+        auto& stateCache = GetServiceCollection().GetService<GlStateCache>();
+
         uint32_t vertexArrayObject;
         GL_CALL(glGenVertexArrays(1, &vertexArrayObject));
 
         uint32_t indexBufferObject;
         GL_CALL(glGenBuffers(1, &indexBufferObject));
 
-        GL_CALL(glBindVertexArray(vertexArrayObject));
+        stateCache.BindVertexArray(vertexArrayObject);
         std::vector<uint32_t> vertexBufferObjects;
-        CreateVertexBufferObject<Vector3F>(3, mesh.GetPositions(), vertexBufferObjects);
-        CreateVertexBufferObject<Vector2F>(2, mesh.GetUVs(), vertexBufferObjects);
+        CreateVertexBufferObject<Vector3F>(3, mesh.GetPositions(), vertexBufferObjects, stateCache);
+        CreateVertexBufferObject<Vector2F>(2, mesh.GetUVs(), vertexBufferObjects, stateCache);
 
-        GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject));
+        stateCache.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject);
 
         const std::vector<Vector3I>& triangles = mesh.GetTriangles();
         if (!triangles.empty())
@@ -101,7 +151,7 @@ namespace pluto
         int verticesCount = static_cast<int>(triangles.size()) * 3;
 
         auto impl = std::make_unique<Impl>(verticesCount, vertexArrayObject, indexBufferObject,
-                                           std::move(vertexBufferObjects));
+                                           std::move(vertexBufferObjects), stateCache);
         return std::make_unique<GlMeshBuffer>(std::move(impl));
     }
 
@@ -142,4 +192,9 @@ namespace pluto
     {
         impl->Draw();
     }
+
+    void GlMeshBuffer::DrawInstanced(const Matrix4X4* modelMatrices, const size_t instancesCount)
+    {
+        impl->DrawInstanced(modelMatrices, instancesCount);
+    }
 }
@@ -1,14 +1,19 @@
 #include "pluto/render/gl/gl_render_manager.h"
 #include "pluto/render/gl/gl_mesh_buffer.h"
 #include "pluto/render/gl/gl_shader_program.h"
+#include "pluto/render/gl/gl_state_cache.h"
+#include "pluto/render/gl/gl_sprite_batch.h"
 #include "pluto/render/gl/gl_call.h"
+#include "pluto/render/render_queue.h"
 #include "pluto/render/events/on_render_event.h"
 
 #include "pluto/log/log_manager.h"
+#include "pluto/config/config_manager.h"
 #include "pluto/event/event_manager.h"
 #include "pluto/window/window_manager.h"
 
 #include "pluto/memory/resource.h"
+#include "pluto/memory/frame_allocator.h"
 
 #include "pluto/asset/mesh_asset.h"
 #include "pluto/asset/material_asset.h"
@@ -28,20 +33,16 @@
 #include "pluto/math/matrix4x4.h"
 
 #include "pluto/service/service_collection.h"
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 
+#include <fmt/format.h>
 #include <GL/glew.h>
 #include <Box2D/Box2D.h>
+#include <algorithm>
 #include <utility>
 
 namespace pluto
 {
-    struct RenderData
-    {
-        Resource<Renderer> renderer;
-        float z;
-    };
-
     class Gizmo
     {
     public:
@@ -137,13 +138,27 @@ namespace pluto
 
     class GlRenderManager::Impl
     {
-        Guid onRenderEventListenerId;
+        RuntimeId onRenderEventListenerId;
         std::vector<std::unique_ptr<Gizmo>> gizmosToDraw;
 
+        // Runs of at least this many commands with the same mesh and material are drawn instanced.
+        static constexpr size_t MIN_INSTANCES_COUNT = 2;
+
+        RenderQueue renderQueue;
+        GlSpriteBatch spriteBatch;
+        std::vector<Matrix4X4> instanceModelMatrices;
+        FrameStats frameStats;
+
+        // The frame stats are logged every this many frames, never when zero.
+        size_t statsLogInterval;
+        size_t renderedFramesCount;
+
+        GlStateCache* stateCache;
         LogManager* logManager;
         EventManager* eventManager;
         SceneManager* sceneManager;
         WindowManager* windowManager;
+        FrameAllocator* frameAllocator;
 
     public:
         ~Impl()
@@ -152,16 +167,22 @@ namespace pluto
             logManager->LogInfo("OpenGL RenderManager terminated!");
         }
 
-        Impl(LogManager& logManager, EventManager& eventManager, SceneManager& sceneManager,
-             WindowManager& windowManager)
-            : logManager(&logManager),
+        Impl(const size_t statsLogInterval, GlStateCache& stateCache, LogManager& logManager, EventManager& eventManager,
+             SceneManager& sceneManager, WindowManager& windowManager, FrameAllocator& frameAllocator)
+            : spriteBatch(stateCache),
+              frameStats(),
+              statsLogInterval(statsLogInterval),
+              renderedFramesCount(0),
+              stateCache(&stateCache),
+              logManager(&logManager),
               eventManager(&eventManager),
               sceneManager(&sceneManager),
-              windowManager(&windowManager)
+              windowManager(&windowManager),
+              frameAllocator(&frameAllocator)
         {
             glewInit();
             glClearColor(0.1f, 0.1f, 0.1f, 0.0f);
-            glEnable(GL_MULTISAMPLE);
+            stateCache.SetCapability(GL_MULTISAMPLE, true);
             onRenderEventListenerId = eventManager.Subscribe<OnRenderEvent>(
                 std::bind(&Impl::OnRender, this, std::placeholders::_1));
             logManager.LogInfo("OpenGL RenderManager initialized!");
@@ -190,52 +211,48 @@ namespace pluto
         {
         }
 
+        FrameStats GetFrameStats() const
+        {
+            return frameStats;
+        }
+
         void OnRender(const OnRenderEvent& evt)
         {
             GL_CALL(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
 
             const Scene& activeScene = sceneManager->GetActiveScene();
-            const Resource<GameObject> rootGameObject = activeScene.GetRootGameObject();
 
-            auto camera = rootGameObject->GetComponentInChildren<Camera>();
+            auto camera = activeScene.FindComponent<Camera>();
             if (camera == nullptr)
             {
                 return;
             }
 
-            std::vector<Resource<Renderer>> renderers = rootGameObject->GetComponentsInChildren<Renderer>();
+            FrameVector<Resource<Renderer>> renderers(*frameAllocator);
+            activeScene.FindComponents(renderers);
 
-            std::vector<RenderData> renderData;
+            // Culled renderers are left out before sorting.
+            renderQueue.Clear();
             const float cameraZ = camera->GetGameObject()->GetTransform()->GetPosition().z;
-            for (auto renderer : renderers)
-            {
-                renderData.push_back({renderer, renderer->GetGameObject()->GetTransform()->GetPosition().z - cameraZ});
-            }
-
-            const auto compare = [&](RenderData& lhs, RenderData& rhs) -> bool
-            {
-                return lhs.z > rhs.z;
-            };
-
-            std::make_heap(renderData.begin(), renderData.end(), compare);
-
-            const Matrix4X4 mv = camera->GetProjectionMatrix() * camera->GetViewMatrix();
-            while (!renderData.empty())
+            for (auto& renderer : renderers)
             {
-                Renderer& renderer = *renderData.front().renderer.Get();
-                std::pop_heap(renderData.begin(), renderData.end(), compare);
-                renderData.pop_back();
-                if (!camera->IsVisible(renderer))
+                if (!camera->IsVisible(*renderer.Get()))
                 {
                     continue;
                 }
 
-                Draw(mv * renderer.GetGameObject()->GetTransform()->GetWorldMatrix(), *renderer.GetMesh().Get(),
-                     *renderer.GetMaterial().Get());
+                const Resource<GameObject> gameObject = renderer->GetGameObject();
+                renderQueue.Add(*renderer.Get(), gameObject->GetLayer(),
+                                gameObject->GetTransform()->GetPosition().z - cameraZ);
             }
+            renderQueue.Sort();
+
+            const Matrix4X4 mv = camera->GetProjectionMatrix() * camera->GetViewMatrix();
+            Submit(mv, renderQueue.GetCommands());
+            LogFrameStats();
 
 #ifndef NDEBUG
-            GL_CALL(glUseProgram(0));
+            stateCache->UseProgram(0);
             GL_CALL(glClear(GL_DEPTH_BUFFER_BIT));
 
             for (auto it = gizmosToDraw.begin(); it != gizmosToDraw.end(); ++it)
@@ -256,20 +273,216 @@ namespace pluto
             windowManager->SwapBuffers();
         }
 
-        static void Draw(const Matrix4X4& mvp, MeshAsset& meshAsset, MaterialAsset& materialAsset)
+        /*
+         * Commands are sorted by state, so the shader, material and mesh are only bound when they change. Runs with the
+         * same mesh and material are drawn instanced when the shader has that variant, other runs of small meshes with
+         * the same material are merged in the sprite batch.
+         */
+        void Submit(const Matrix4X4& mv, const std::vector<RenderQueue::Command>& commands)
         {
-            auto& meshBuffer = dynamic_cast<GlMeshBuffer&>(meshAsset.GetMeshBuffer());
+            frameStats = FrameStats();
+            frameStats.commandsCount = commands.size();
+            stateCache->ResetCallsCount();
+
+            GlShaderProgram* shaderProgram = nullptr;
+            GlMeshBuffer* meshBuffer = nullptr;
+            const ShaderAsset* lastShader = nullptr;
+            const MaterialAsset* lastMaterial = nullptr;
+            const MeshAsset* lastMesh = nullptr;
+            bool isInstancedVariantBound = false;
+
+            // The batch binds its own vertex array, the next mesh has to be bound again.
+            const auto drawSpriteBatch = [&]()
+            {
+                if (spriteBatch.IsEmpty())
+                {
+                    return;
+                }
 
-            Resource<ShaderAsset> shaderAsset = materialAsset.GetShader();
-            auto& shaderProgram = dynamic_cast<GlShaderProgram&>(shaderAsset->GetShaderProgram());
+                shaderProgram->SetModelViewProjection(mv);
+                spriteBatch.Draw();
+                lastMesh = nullptr;
+                ++frameStats.drawCalls;
+            };
+
+            for (size_t i = 0; i < commands.size(); ++i)
+            {
+                const RenderQueue::Command& command = commands[i];
+                if (command.shader != lastShader)
+                {
+                    drawSpriteBatch();
+                    if (shaderProgram != nullptr)
+                    {
+                        shaderProgram->Unbind();
+                    }
+
+                    shaderProgram = &dynamic_cast<GlShaderProgram&>(command.shader->GetShaderProgram());
+                    shaderProgram->Bind();
+                    isInstancedVariantBound = false;
+                    lastShader = command.shader;
+                    lastMaterial = nullptr;
+                    ++frameStats.shaderChanges;
+                }
+
+                // Both variants keep their own uniforms, the material is set again on the one bound.
+                const size_t instancesCount = GetInstancesCount(commands, i, *shaderProgram);
+                if ((instancesCount > 0) != isInstancedVariantBound)
+                {
+                    drawSpriteBatch();
+                    isInstancedVariantBound = instancesCount > 0;
+                    if (isInstancedVariantBound)
+                    {
+                        shaderProgram->BindInstanced();
+                    }
+                    else
+                    {
+                        shaderProgram->Bind();
+                    }
+                    lastMaterial = nullptr;
+                }
+
+                if (command.material != lastMaterial)
+                {
+                    drawSpriteBatch();
+                    shaderProgram->SetMaterial(*command.material);
+                    lastMaterial = command.material;
+                    ++frameStats.materialChanges;
+                }
 
-            shaderProgram.Bind(mvp, materialAsset);
+                if (instancesCount > 0)
+                {
+                    BindMesh(*command.mesh, meshBuffer, lastMesh);
+                    instanceModelMatrices.clear();
+                    for (size_t j = i; j < i + instancesCount; ++j)
+                    {
+                        instanceModelMatrices.push_back(
+                            commands[j].renderer->GetGameObject()->GetTransform()->GetWorldMatrix());
+                    }
+
+                    shaderProgram->SetModelViewProjection(mv);
+                    meshBuffer->DrawInstanced(instanceModelMatrices.data(), instancesCount);
+                    frameStats.instancedCommands += instancesCount;
+                    ++frameStats.drawCalls;
+                    i += instancesCount - 1;
+                    continue;
+                }
 
-            meshBuffer.Bind();
-            meshBuffer.Draw();
-            meshBuffer.Unbind();
+                if (IsBatched(commands, i))
+                {
+                    if (spriteBatch.IsFull(*command.mesh))
+                    {
+                        drawSpriteBatch();
+                    }
+
+                    spriteBatch.Add(*command.mesh,
+                                    command.renderer->GetGameObject()->GetTransform()->GetWorldMatrix());
+                    ++frameStats.batchedCommands;
+                    continue;
+                }
 
-            shaderProgram.Unbind();
+                drawSpriteBatch();
+                BindMesh(*command.mesh, meshBuffer, lastMesh);
+
+                shaderProgram->SetModelViewProjection(
+                    mv * command.renderer->GetGameObject()->GetTransform()->GetWorldMatrix());
+                meshBuffer->Draw();
+                ++frameStats.drawCalls;
+            }
+
+            drawSpriteBatch();
+
+            if (meshBuffer != nullptr)
+            {
+                meshBuffer->Unbind();
+            }
+
+            if (shaderProgram != nullptr)
+            {
+                shaderProgram->Unbind();
+            }
+
+            frameStats.stateCallsIssued = stateCache->GetIssuedCallsCount();
+            frameStats.stateCallsSkipped = stateCache->GetSkippedCallsCount();
+        }
+
+        void LogFrameStats()
+        {
+            ++renderedFramesCount;
+            if (statsLogInterval == 0 || renderedFramesCount % statsLogInterval != 0)
+            {
+                return;
+            }
+
+            logManager->LogInfo(fmt::format(
+                "Frame {0}: {1} commands in {2} draw calls, {3} batched and {4} instanced. {5} shader, {6} material "
+                "and {7} mesh changes. {8} GL state calls issued, {9} skipped.", renderedFramesCount,
+                frameStats.commandsCount, frameStats.drawCalls, frameStats.batchedCommands,
+                frameStats.instancedCommands, frameStats.shaderChanges, frameStats.materialChanges,
+                frameStats.meshChanges, frameStats.stateCallsIssued, frameStats.stateCallsSkipped));
+        }
+
+        void BindMesh(MeshAsset& mesh, GlMeshBuffer*& meshBuffer, const MeshAsset*& lastMesh)
+        {
+            if (&mesh == lastMesh)
+            {
+                return;
+            }
+
+            if (meshBuffer != nullptr)
+            {
+                meshBuffer->Unbind();
+            }
+
+            meshBuffer = &dynamic_cast<GlMeshBuffer&>(mesh.GetMeshBuffer());
+            meshBuffer->Bind();
+            lastMesh = &mesh;
+            ++frameStats.meshChanges;
+        }
+
+        /*
+         * Number of commands from the index on with the same mesh and material, or zero when they are not drawn
+         * instanced.
+         */
+        static size_t GetInstancesCount(const std::vector<RenderQueue::Command>& commands, const size_t index,
+                                        const GlShaderProgram& shaderProgram)
+        {
+            if (!shaderProgram.HasInstancedVariant())
+            {
+                return 0;
+            }
+
+            const RenderQueue::Command& command = commands[index];
+            size_t end = index + 1;
+            while (end < commands.size() && commands[end].mesh == command.mesh &&
+                commands[end].material == command.material)
+            {
+                ++end;
+            }
+
+            const size_t count = end - index;
+            return count >= MIN_INSTANCES_COUNT ? count : 0;
+        }
+
+        /*
+         * A mesh alone is cheaper to draw from its own buffers, so a batch is only started when the next command can
+         * join it.
+         */
+        bool IsBatched(const std::vector<RenderQueue::Command>& commands, const size_t index) const
+        {
+            const RenderQueue::Command& command = commands[index];
+            if (!GlSpriteBatch::IsBatchable(*command.mesh))
+            {
+                return false;
+            }
+
+            if (!spriteBatch.IsEmpty())
+            {
+                return true;
+            }
+
+            const size_t next = index + 1;
+            return next < commands.size() && commands[next].material == command.material &&
+                GlSpriteBatch::IsBatchable(*commands[next].mesh);
         }
     };
 
@@ -281,12 +494,17 @@ namespace pluto
     std::unique_ptr<GlRenderManager> GlRenderManager::Factory::Create() const
     {
         ServiceCollection& serviceCollection = GetServiceCollection();
+        auto& stateCache = serviceCollection.GetService<GlStateCache>();
         auto& logManager = serviceCollection.GetService<LogManager>();
         auto& eventManager = serviceCollection.GetService<EventManager>();
         auto& sceneManager = serviceCollection.GetService<SceneManager>();
         auto& windowManager = serviceCollection.GetService<WindowManager>();
+        auto& frameAllocator = serviceCollection.GetService<FrameAllocator>();
+        const auto& configManager = serviceCollection.GetService<ConfigManager>();
+        const int statsLogInterval = configManager.GetInt("renderStatsLogInterval", 0);
         return std::make_unique<GlRenderManager>(
-            std::make_unique<Impl>(logManager, eventManager, sceneManager, windowManager));
+            std::make_unique<Impl>(std::max(statsLogInterval, 0), stateCache, logManager, eventManager, sceneManager,
+                                   windowManager, frameAllocator));
     }
 
     GlRenderManager::GlRenderManager(std::unique_ptr<Impl> impl)
@@ -326,4 +544,9 @@ namespace pluto
     {
         impl->DrawLineGizmo(from, to, color);
     }
+
+    RenderManager::FrameStats GlRenderManager::GetFrameStats() const
+    {
+        return impl->GetFrameStats();
+    }
 }
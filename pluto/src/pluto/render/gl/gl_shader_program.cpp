@@ -1,7 +1,10 @@
 #include "pluto/render/gl/gl_shader_program.h"
 #include "pluto/render/gl/gl_texture_buffer.h"
+#include "pluto/render/gl/gl_state_cache.h"
 #include "pluto/render/gl/gl_call.h"
 
+#include "pluto/service/service_collection.h"
+
 #include "pluto/memory/resource.h"
 
 #include "pluto/asset/shader_asset.h"
@@ -16,10 +19,13 @@
 #include "pluto/math/vector4f.h"
 #include "pluto/math/matrix4x4.h"
 
+#include "pluto/runtime_id.h"
+#include "pluto/exception.h"
+
 #include <GL/glew.h>
 
 #include <array>
-#include <unordered_map>
+#include <vector>
 
 namespace pluto
 {
@@ -65,209 +71,275 @@ namespace pluto
 
     class GlShaderProgram::Impl
     {
-        const GLuint programId;
+        struct Program
+        {
+            GLuint id;
+
+            // Indexed by material slot, which is the index of the uniform in the shader.
+            std::vector<GLint> uniformLocations;
+
+            RuntimeId lastMaterialId;
+            uint32_t lastMaterialRevision;
+        };
+
         const ShaderAsset* shaderAsset;
+        GlStateCache* stateCache;
+
+        Program program;
+        Program instancedProgram;
+        Program* boundProgram;
 
-        uint8_t mvpUniformLocation;
-        const MaterialAsset* lastMaterialAsset;
+        std::vector<uint8_t> textureUnits;
+        size_t mvpSlot;
 
     public:
-        Impl(const GLuint programId, const ShaderAsset& shaderAsset)
-            : programId(programId),
-              shaderAsset(&shaderAsset),
-              mvpUniformLocation(255),
-              lastMaterialAsset(nullptr)
+        Impl(const GLuint programId, const GLuint instancedProgramId, const ShaderAsset& shaderAsset,
+             GlStateCache& stateCache)
+            : shaderAsset(&shaderAsset),
+              stateCache(&stateCache),
+              program{programId, {}, RuntimeId(), 0},
+              instancedProgram{instancedProgramId, {}, RuntimeId(), 0},
+              boundProgram(&program),
+              mvpSlot(MaterialAsset::NO_SLOT)
         {
-            for (const auto& property : shaderAsset.GetUniforms())
+            const std::vector<ShaderAsset::Property>& uniforms = shaderAsset.GetUniforms();
+            textureUnits.reserve(uniforms.size());
+
+            uint8_t textureUnitsCount = 0;
+            for (size_t slot = 0; slot < uniforms.size(); ++slot)
             {
-                if (property.name != "u_mvp")
+                textureUnits.push_back(textureUnitsCount);
+                if (uniforms[slot].name == "u_mvp")
                 {
-                    continue;
+                    mvpSlot = slot;
+                }
+                else if (uniforms[slot].type == ShaderAsset::Property::Type::Sampler2D)
+                {
+                    if (textureUnitsCount == GlStateCache::TEXTURE_UNIT_COUNT)
+                    {
+                        Exception::Throw(std::runtime_error(
+                            "Shader " + shaderAsset.GetName() + " uses more textures than the available units."));
+                    }
+                    ++textureUnitsCount;
                 }
+            }
 
-                mvpUniformLocation = property.id;
-                break;
+            SetUpProgram(program);
+            if (HasInstancedVariant())
+            {
+                SetUpProgram(instancedProgram);
             }
         }
 
         ~Impl()
         {
-            GL_CALL(glDeleteProgram(programId));
-            GL_CALL(glUseProgram(0));
+            stateCache->DeleteProgram(program.id);
+            if (HasInstancedVariant())
+            {
+                stateCache->DeleteProgram(instancedProgram.id);
+            }
         }
 
-        void Bind(const Matrix4X4& mvp, const MaterialAsset& materialAsset)
+        bool HasInstancedVariant() const
         {
-            GL_CALL(glUseProgram(programId));
-            UpdateBlendFunction();
-            UpdateDepthTest();
-            UpdateFaceCull();
+            return instancedProgram.id != 0;
+        }
 
-            lastMaterialAsset = &materialAsset;
-            UpdateMaterial();
+        void Bind()
+        {
+            BindProgram(program);
+        }
 
-            UpdateModelViewProjection(mvp);
+        void BindInstanced()
+        {
+            BindProgram(instancedProgram);
         }
 
         void Unbind()
         {
         }
 
-    private:
-        void UpdateBlendFunction()
+        /*
+         * Each program keeps the uniforms of the last material it was given, setting it again only uploads the slots
+         * changed since then. Textures are always bound, as their units are shared with every other program.
+         */
+        void SetMaterial(const MaterialAsset& materialAsset)
         {
-            GL_CALL(const bool isBlendOn = glIsEnabled(GL_BLEND));
-            if (shaderAsset->GetBlendEquation() != ShaderAsset::BlendEquation::Off)
+            const bool isLastMaterial = materialAsset.GetRuntimeId() == boundProgram->lastMaterialId;
+            const std::vector<ShaderAsset::Property>& uniforms = shaderAsset->GetUniforms();
+            for (size_t slot = 0; slot < uniforms.size(); ++slot)
             {
-                if (!isBlendOn)
-                {
-                    GL_CALL(glEnable(GL_BLEND));
-                }
-
-                const GLenum blendSrcFactor = BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendSrcFactor())];
-                const GLenum blendDstFactor = BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendDstFactor())];
-
-                const GLenum blendSrcAlphaFactor = BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendSrcAlphaFactor())
-                ];
-
-                const GLenum blendDstAlphaFactor = BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendDstAlphaFactor())
-                ];
-
-                if (blendSrcFactor == blendSrcAlphaFactor && blendDstFactor == blendDstAlphaFactor)
+                if (slot == mvpSlot)
                 {
-                    GL_CALL(glBlendFunc(blendSrcFactor, blendDstFactor));
-                }
-                else
-                {
-                    GL_CALL(
-                        glBlendFuncSeparate(blendSrcFactor, blendDstFactor, blendSrcAlphaFactor, blendDstAlphaFactor));
+                    continue;
                 }
 
-                const GLenum blendEquation = BLEND_EQUATIONS[static_cast<int>(shaderAsset->GetBlendEquation())];
-                const GLenum blendAlphaEquation = BLEND_EQUATIONS[static_cast<int>(shaderAsset->GetBlendAlphaEquation())
-                ];
-                if (blendEquation == blendAlphaEquation)
+                if (uniforms[slot].type == ShaderAsset::Property::Type::Sampler2D)
                 {
-                    GL_CALL(glBlendEquation(blendEquation));
+                    BindTexture(materialAsset, slot);
                 }
-                else
+                else if (!isLastMaterial || materialAsset.GetSlotRevision(slot) > boundProgram->lastMaterialRevision)
                 {
-                    GL_CALL(glBlendEquationSeparate(blendEquation, blendAlphaEquation));
+                    UpdateUniform(materialAsset, uniforms[slot].type, slot);
                 }
             }
-            else if (isBlendOn)
-            {
-                GL_CALL(glDisable(GL_BLEND));
-            }
+
+            boundProgram->lastMaterialId = materialAsset.GetRuntimeId();
+            boundProgram->lastMaterialRevision = materialAsset.GetRevision();
         }
 
-        void UpdateDepthTest()
+        void SetModelViewProjection(const Matrix4X4& mvp)
+        {
+            UpdateModelViewProjection(mvp);
+        }
+
+    private:
+        /*
+         * Uniforms are found by name, so both variants share the material slots. Samplers always read the same texture
+         * unit, their values are set once here.
+         */
+        void SetUpProgram(Program& value)
         {
-            GL_CALL(const bool isDepthTestOn = glIsEnabled(GL_DEPTH_TEST));
-            if (shaderAsset->GetDepthTest() != ShaderAsset::DepthTest::Off)
+            stateCache->UseProgram(value.id);
+            const std::vector<ShaderAsset::Property>& uniforms = shaderAsset->GetUniforms();
+            value.uniformLocations.reserve(uniforms.size());
+            for (size_t slot = 0; slot < uniforms.size(); ++slot)
             {
-                if (!isDepthTestOn)
+                GL_CALL(const GLint location = glGetUniformLocation(value.id, uniforms[slot].name.c_str()));
+                value.uniformLocations.push_back(location);
+                if (slot != mvpSlot && uniforms[slot].type == ShaderAsset::Property::Type::Sampler2D)
                 {
-                    GL_CALL(glEnable(GL_DEPTH_TEST));
+                    GL_CALL(glUniform1i(location, textureUnits[slot]));
                 }
-
-                GL_CALL(glDepthFunc(DEPTH_TESTS[static_cast<int>(shaderAsset->GetDepthTest())]));
-            }
-            else if (isDepthTestOn)
-            {
-                GL_CALL(glDisable(GL_DEPTH_TEST));
             }
         }
 
-        void UpdateFaceCull()
+        void BindProgram(Program& value)
         {
-            GL_CALL(const bool isFaceCullOn = glIsEnabled(GL_CULL_FACE));
-            ShaderAsset::CullFace cullFace = shaderAsset->GetCullFace();
-            if (cullFace != ShaderAsset::CullFace::Off)
-            {
-                if (!isFaceCullOn)
-                {
-                    GL_CALL(glEnable(GL_CULL_FACE));
-                }
+            stateCache->UseProgram(value.id);
+            boundProgram = &value;
+            UpdateBlendFunction();
+            UpdateDepthTest();
+            UpdateFaceCull();
+        }
 
-                GL_CALL(glCullFace(FACE_CULLING[static_cast<int>(cullFace)]));
-            }
-            else if (isFaceCullOn)
+        void UpdateBlendFunction()
+        {
+            if (shaderAsset->GetBlendEquation() == ShaderAsset::BlendEquation::Off)
             {
-                GL_CALL(glDisable(GL_CULL_FACE));
+                stateCache->SetCapability(GL_BLEND, false);
+                return;
             }
+
+            stateCache->SetCapability(GL_BLEND, true);
+            stateCache->SetBlendFunction(BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendSrcFactor())],
+                                         BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendDstFactor())],
+                                         BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendSrcAlphaFactor())],
+                                         BLEND_FACTORS[static_cast<int>(shaderAsset->GetBlendDstAlphaFactor())]);
+            stateCache->SetBlendEquation(BLEND_EQUATIONS[static_cast<int>(shaderAsset->GetBlendEquation())],
+                                         BLEND_EQUATIONS[static_cast<int>(shaderAsset->GetBlendAlphaEquation())]);
         }
 
-        void UpdateMaterial()
+        void UpdateDepthTest()
         {
-            for (const auto& uniform : shaderAsset->GetUniforms())
+            if (shaderAsset->GetDepthTest() == ShaderAsset::DepthTest::Off)
             {
-                if (uniform.id == mvpUniformLocation)
-                {
-                    continue;
-                }
+                stateCache->SetCapability(GL_DEPTH_TEST, false);
+                return;
+            }
+
+            stateCache->SetCapability(GL_DEPTH_TEST, true);
+            stateCache->SetDepthFunction(DEPTH_TESTS[static_cast<int>(shaderAsset->GetDepthTest())]);
+        }
 
-                UpdateUniform(uniform);
+        void UpdateFaceCull()
+        {
+            const ShaderAsset::CullFace cullFace = shaderAsset->GetCullFace();
+            if (cullFace == ShaderAsset::CullFace::Off)
+            {
+                stateCache->SetCapability(GL_CULL_FACE, false);
+                return;
             }
+
+            stateCache->SetCapability(GL_CULL_FACE, true);
+            stateCache->SetCullFace(FACE_CULLING[static_cast<int>(cullFace)]);
         }
 
         void UpdateModelViewProjection(const Matrix4X4& mvp)
         {
-            GL_CALL(glUniformMatrix4fv(mvpUniformLocation, 1, GL_FALSE, mvp.Data()));
+            if (mvpSlot != MaterialAsset::NO_SLOT)
+            {
+                GL_CALL(glUniformMatrix4fv(boundProgram->uniformLocations[mvpSlot], 1, GL_FALSE, mvp.Data()));
+            }
         }
 
-        void UpdateUniform(const ShaderAsset::Property& uniform)
+        void UpdateUniform(const MaterialAsset& materialAsset, const ShaderAsset::Property::Type type,
+                           const size_t slot)
         {
-            switch (uniform.type)
+            const GLint location = boundProgram->uniformLocations[slot];
+            switch (type)
             {
             case ShaderAsset::Property::Type::Bool:
-                GL_CALL(glUniform1i(uniform.id, lastMaterialAsset->GetBool(uniform.name)));
-                break;
             case ShaderAsset::Property::Type::Int:
-                GL_CALL(glUniform1i(uniform.id, lastMaterialAsset->GetInt(uniform.name)));
+                GL_CALL(glUniform1i(location, static_cast<GLint>(materialAsset.GetFloat(slot))));
                 break;
             case ShaderAsset::Property::Type::Float:
-                GL_CALL(glUniform1f(uniform.id, lastMaterialAsset->GetFloat(uniform.name)));
+                GL_CALL(glUniform1f(location, materialAsset.GetFloat(slot)));
                 break;
             case ShaderAsset::Property::Type::Vector2I:
-                GL_CALL(glUniform2iv(uniform.id, 1, lastMaterialAsset->GetVector2I(uniform.name).Data()));
+                GL_CALL(glUniform2iv(location, 1, ToInts(materialAsset.GetVector4F(slot)).data()));
                 break;
             case ShaderAsset::Property::Type::Vector2F:
-                GL_CALL(glUniform2fv(uniform.id, 1, lastMaterialAsset->GetVector2F(uniform.name).Data()));
+                GL_CALL(glUniform2fv(location, 1, materialAsset.GetVector4F(slot).Data()));
                 break;
             case ShaderAsset::Property::Type::Vector3I:
-                GL_CALL(glUniform3iv(uniform.id, 1, lastMaterialAsset->GetVector3I(uniform.name).Data()));
+                GL_CALL(glUniform3iv(location, 1, ToInts(materialAsset.GetVector4F(slot)).data()));
                 break;
             case ShaderAsset::Property::Type::Vector3F:
-                GL_CALL(glUniform3fv(uniform.id, 1, lastMaterialAsset->GetVector3F(uniform.name).Data()));
+                GL_CALL(glUniform3fv(location, 1, materialAsset.GetVector4F(slot).Data()));
                 break;
             case ShaderAsset::Property::Type::Vector4I:
-                GL_CALL(glUniform4iv(uniform.id, 1, lastMaterialAsset->GetVector4I(uniform.name).Data()));
+                GL_CALL(glUniform4iv(location, 1, ToInts(materialAsset.GetVector4F(slot)).data()));
                 break;
             case ShaderAsset::Property::Type::Vector4F:
-                GL_CALL(glUniform4fv(uniform.id, 1, lastMaterialAsset->GetVector4F(uniform.name).Data()));
+                GL_CALL(glUniform4fv(location, 1, materialAsset.GetVector4F(slot).Data()));
                 break;
             case ShaderAsset::Property::Type::Matrix4X4:
-                GL_CALL(
-                    glUniformMatrix3fv(uniform.id, 1, GL_FALSE, lastMaterialAsset->GetMatrix4X4(uniform.name).Data()
-                    ));
-                break;
-            case ShaderAsset::Property::Type::Sampler2D:
-                BindTexture(uniform);
+                GL_CALL(glUniformMatrix4fv(location, 1, GL_FALSE, materialAsset.GetMatrix4X4(slot).Data()));
                 break;
             default: ;
             }
         }
 
-        void BindTexture(const ShaderAsset::Property& uniform)
+        void BindTexture(const MaterialAsset& materialAsset, const size_t slot)
         {
-            Resource<TextureAsset> textureAsset = lastMaterialAsset->GetTexture(uniform.name);
+            Resource<TextureAsset> textureAsset = materialAsset.GetTexture(slot);
+            if (textureAsset == nullptr)
+            {
+                stateCache->BindTexture(textureUnits[slot], GL_TEXTURE_2D, 0);
+                return;
+            }
+
             auto& textureBuffer = dynamic_cast<GlTextureBuffer&>(textureAsset->GetTextureBuffer());
-            textureBuffer.Bind(0);
-            GL_CALL(glUniform1i(uniform.id, 0));
+            textureBuffer.Bind(textureUnits[slot]);
+        }
+
+        static std::array<GLint, 4> ToInts(const Vector4F& value)
+        {
+            return {
+                static_cast<GLint>(value.x), static_cast<GLint>(value.y), static_cast<GLint>(value.z),
+                static_cast<GLint>(value.w)
+            };
         }
     };
 
+    GLuint CreateProgram(const uint32_t binaryFormat, const std::vector<uint8_t>& binaryData)
+    {
+        GL_CALL(const GLuint programId = glCreateProgram());
+        GL_CALL(glProgramBinary(programId, binaryFormat, binaryData.data(), binaryData.size()));
+        return programId;
+    }
+
     GlShaderProgram::Factory::Factory(ServiceCollection& serviceCollection)
         : ShaderProgram::Factory(serviceCollection)
     {
@@ -275,11 +347,18 @@ namespace pluto
 
     std::unique_ptr<ShaderProgram> GlShaderProgram::Factory::Create(const ShaderAsset& shaderAsset) const
     {
-        GL_CALL(const GLuint programId = glCreateProgram());
-        const std::vector<uint8_t>& binaryData = shaderAsset.GetBinaryData();
-        GL_CALL(glProgramBinary(programId, shaderAsset.GetBinaryFormat(), binaryData.data(), binaryData.size()));
+        const GLuint programId = CreateProgram(shaderAsset.GetBinaryFormat(), shaderAsset.GetBinaryData());
+
+        GLuint instancedProgramId = 0;
+        const std::vector<uint8_t>& instancedBinaryData = shaderAsset.GetInstancedBinaryData();
+        if (!instancedBinaryData.empty())
+        {
+            instancedProgramId = CreateProgram(shaderAsset.GetBinaryFormat(), instancedBinaryData);
+        }
 
-        return std::make_unique<GlShaderProgram>(std::make_unique<Impl>(programId, shaderAsset));
+        auto& stateCache = GetServiceCollection().GetService<GlStateCache>();
+        return std::make_unique<GlShaderProgram>(
+            std::make_unique<Impl>(programId, instancedProgramId, shaderAsset, stateCache));
     }
 
     GlShaderProgram::GlShaderProgram(std::unique_ptr<Impl> impl)
@@ -305,13 +384,33 @@ namespace pluto
         return *this;
     }
 
-    void GlShaderProgram::Bind(const Matrix4X4& mvp, const MaterialAsset& materialAsset)
+    void GlShaderProgram::Bind()
     {
-        impl->Bind(mvp, materialAsset);
+        impl->Bind();
+    }
+
+    bool GlShaderProgram::HasInstancedVariant() const
+    {
+        return impl->HasInstancedVariant();
+    }
+
+    void GlShaderProgram::BindInstanced()
+    {
+        impl->BindInstanced();
     }
 
     void GlShaderProgram::Unbind()
     {
         impl->Unbind();
     }
+
+    void GlShaderProgram::SetMaterial(const MaterialAsset& materialAsset)
+    {
+        impl->SetMaterial(materialAsset);
+    }
+
+    void GlShaderProgram::SetModelViewProjection(const Matrix4X4& mvp)
+    {
+        impl->SetModelViewProjection(mvp);
+    }
 }
@@ -0,0 +1,220 @@
+#include "pluto/render/gl/gl_sprite_batch.h"
+#include "pluto/render/gl/gl_state_cache.h"
+#include "pluto/render/gl/gl_call.h"
+
+#include "pluto/asset/mesh_asset.h"
+
+#include "pluto/math/vector2f.h"
+#include "pluto/math/vector3f.h"
+#include "pluto/math/vector3i.h"
+#include "pluto/math/matrix4x4.h"
+
+#include <GL/glew.h>
+
+#include <vector>
+
+namespace pluto
+{
+    class GlSpriteBatch::Impl
+    {
+        GlStateCache* stateCache;
+
+        // Created on the first draw, OpenGL may not be initialized when the batch is.
+        uint32_t vertexArrayObject;
+        uint32_t positionsBufferObject;
+        uint32_t uvsBufferObject;
+        uint32_t indexBufferObject;
+
+        std::vector<float> positions;
+        std::vector<Vector2F> uvs;
+        std::vector<uint32_t> indices;
+        size_t meshesCount;
+
+    public:
+        ~Impl()
+        {
+            if (vertexArrayObject == 0)
+            {
+                return;
+            }
+
+            stateCache->DeleteVertexArray(vertexArrayObject);
+            stateCache->DeleteBuffer(positionsBufferObject);
+            stateCache->DeleteBuffer(uvsBufferObject);
+            stateCache->DeleteBuffer(indexBufferObject);
+        }
+
+        explicit Impl(GlStateCache& stateCache)
+            : stateCache(&stateCache),
+              vertexArrayObject(0),
+              positionsBufferObject(0),
+              uvsBufferObject(0),
+              indexBufferObject(0),
+              meshesCount(0)
+        {
+            positions.reserve(MAX_VERTICES * 3);
+            uvs.reserve(MAX_VERTICES);
+            indices.reserve(MAX_VERTICES * 3 / 2);
+        }
+
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = delete;
+        Impl& operator=(const Impl& rhs) = delete;
+        Impl& operator=(Impl&& rhs) noexcept = delete;
+
+        static bool IsBatchable(const MeshAsset& mesh)
+        {
+            const size_t verticesCount = mesh.GetPositions().size();
+            return verticesCount > 0 && verticesCount <= MAX_MESH_VERTICES && mesh.GetUVs().size() == verticesCount;
+        }
+
+        bool IsEmpty() const
+        {
+            return meshesCount == 0;
+        }
+
+        bool IsFull(const MeshAsset& mesh) const
+        {
+            return uvs.size() + mesh.GetPositions().size() > MAX_VERTICES;
+        }
+
+        size_t GetMeshesCount() const
+        {
+            return meshesCount;
+        }
+
+        void Add(const MeshAsset& mesh, const Matrix4X4& worldMatrix)
+        {
+            const std::vector<Vector3F>& meshPositions = mesh.GetPositions();
+            const auto baseVertex = static_cast<uint32_t>(uvs.size());
+
+            const size_t offset = positions.size();
+            positions.resize(offset + meshPositions.size() * 3);
+            TransformPoints(worldMatrix, meshPositions.front().Data(), meshPositions.size(), &positions[offset]);
+
+            const std::vector<Vector2F>& meshUVs = mesh.GetUVs();
+            uvs.insert(uvs.end(), meshUVs.begin(), meshUVs.end());
+
+            for (const auto& triangle : mesh.GetTriangles())
+            {
+                indices.push_back(baseVertex + triangle.x);
+                indices.push_back(baseVertex + triangle.y);
+                indices.push_back(baseVertex + triangle.z);
+            }
+
+            ++meshesCount;
+        }
+
+        void Draw()
+        {
+            if (meshesCount == 0)
+            {
+                return;
+            }
+
+            if (vertexArrayObject == 0)
+            {
+                CreateBufferObjects();
+            }
+
+            // Buffers are orphaned with a new store every draw, so the driver does not wait for the previous one.
+            stateCache->BindVertexArray(vertexArrayObject);
+            stateCache->BindBuffer(GL_ARRAY_BUFFER, positionsBufferObject);
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(float), positions.data(), GL_STREAM_DRAW));
+            stateCache->BindBuffer(GL_ARRAY_BUFFER, uvsBufferObject);
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(Vector2F), uvs.data(), GL_STREAM_DRAW));
+            stateCache->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject);
+            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(),
+                GL_STREAM_DRAW));
+
+            GL_CALL(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr));
+
+            positions.clear();
+            uvs.clear();
+            indices.clear();
+            meshesCount = 0;
+        }
+
+    private:
+        void CreateBufferObjects()
+        {
+            GL_CALL(glGenVertexArrays(1, &vertexArrayObject));
+            GL_CALL(glGenBuffers(1, &positionsBufferObject));
+            GL_CALL(glGenBuffers(1, &uvsBufferObject));
+            GL_CALL(glGenBuffers(1, &indexBufferObject));
+
+            // Same attributes as the ones of GlMeshBuffer, so any shader that draws a mesh can draw a batch.
+            stateCache->BindVertexArray(vertexArrayObject);
+            stateCache->BindBuffer(GL_ARRAY_BUFFER, positionsBufferObject);
+            GL_CALL(glEnableVertexAttribArray(0));
+            GL_CALL(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr));
+            stateCache->BindBuffer(GL_ARRAY_BUFFER, uvsBufferObject);
+            GL_CALL(glEnableVertexAttribArray(1));
+            GL_CALL(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, nullptr));
+        }
+
+        /*
+         * Flat loop over floats with the matrix held in locals, which the compiler turns into vector instructions.
+         * World matrices are affine, so there is no perspective divide.
+         */
+        static void TransformPoints(const Matrix4X4& matrix, const float* points, const size_t count, float* result)
+        {
+            const float* m = matrix.Data();
+            const float m0 = m[0], m1 = m[1], m2 = m[2];
+            const float m4 = m[4], m5 = m[5], m6 = m[6];
+            const float m8 = m[8], m9 = m[9], m10 = m[10];
+            const float m12 = m[12], m13 = m[13], m14 = m[14];
+
+            for (size_t i = 0; i < count * 3; i += 3)
+            {
+                const float x = points[i];
+                const float y = points[i + 1];
+                const float z = points[i + 2];
+                result[i] = m0 * x + m4 * y + m8 * z + m12;
+                result[i + 1] = m1 * x + m5 * y + m9 * z + m13;
+                result[i + 2] = m2 * x + m6 * y + m10 * z + m14;
+            }
+        }
+    };
+
+    GlSpriteBatch::~GlSpriteBatch() = default;
+
+    GlSpriteBatch::GlSpriteBatch(GlStateCache& stateCache)
+        : impl(std::make_unique<Impl>(stateCache))
+    {
+    }
+
+    GlSpriteBatch::GlSpriteBatch(GlSpriteBatch&& other) noexcept = default;
+
+    GlSpriteBatch& GlSpriteBatch::operator=(GlSpriteBatch&& rhs) noexcept = default;
+
+    bool GlSpriteBatch::IsBatchable(const MeshAsset& mesh)
+    {
+        return Impl::IsBatchable(mesh);
+    }
+
+    bool GlSpriteBatch::IsEmpty() const
+    {
+        return impl->IsEmpty();
+    }
+
+    bool GlSpriteBatch::IsFull(const MeshAsset& mesh) const
+    {
+        return impl->IsFull(mesh);
+    }
+
+    size_t GlSpriteBatch::GetMeshesCount() const
+    {
+        return impl->GetMeshesCount();
+    }
+
+    void GlSpriteBatch::Add(const MeshAsset& mesh, const Matrix4X4& worldMatrix)
+    {
+        impl->Add(mesh, worldMatrix);
+    }
+
+    void GlSpriteBatch::Draw()
+    {
+        impl->Draw();
+    }
+}
@@ -0,0 +1,492 @@
+#include "pluto/render/gl/gl_state_cache.h"
+#include "pluto/render/gl/gl_call.h"
+
+#include "pluto/service/service_collection.h"
+#include "pluto/config/config_manager.h"
+#include "pluto/log/log_manager.h"
+#include "pluto/exception.h"
+
+#include <GL/glew.h>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+
+namespace pluto
+{
+    class GlStateCache::Impl
+    {
+        // Shadow value of a state that was never set or was invalidated, the next set always reaches the driver.
+        static constexpr uint32_t UNKNOWN = UINT32_MAX;
+
+        uint32_t program;
+        uint32_t vertexArray;
+        uint32_t arrayBuffer;
+        std::unordered_map<uint32_t, uint32_t> elementArrayBuffers;
+
+        uint32_t activeTextureUnit;
+        std::array<uint32_t, TEXTURE_UNIT_COUNT> textures;
+
+        std::unordered_map<uint32_t, bool> capabilities;
+        std::array<uint32_t, 4> blendFunction;
+        std::array<uint32_t, 2> blendEquation;
+        uint32_t depthFunction;
+        uint32_t cullFace;
+
+        size_t skippedCallsCount;
+        size_t issuedCallsCount;
+
+        bool isValidating;
+        LogManager* logManager;
+
+    public:
+        ~Impl()
+        {
+            logManager->LogInfo("GlStateCache terminated!");
+        }
+
+        Impl(const bool isValidating, LogManager& logManager)
+            : skippedCallsCount(0),
+              issuedCallsCount(0),
+              isValidating(isValidating),
+              logManager(&logManager)
+        {
+            Invalidate();
+            logManager.LogInfo("GlStateCache initialized!");
+        }
+
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = delete;
+        Impl& operator=(const Impl& rhs) = delete;
+        Impl& operator=(Impl&& rhs) noexcept = delete;
+
+        void UseProgram(const uint32_t value)
+        {
+            if (program == value)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            GL_CALL(glUseProgram(value));
+            program = value;
+            OnIssued();
+        }
+
+        void BindVertexArray(const uint32_t value)
+        {
+            if (vertexArray == value)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            GL_CALL(glBindVertexArray(value));
+            vertexArray = value;
+            OnIssued();
+        }
+
+        void BindBuffer(const uint32_t target, const uint32_t buffer)
+        {
+            uint32_t* shadow = nullptr;
+            if (target == GL_ARRAY_BUFFER)
+            {
+                shadow = &arrayBuffer;
+            }
+            else if (target == GL_ELEMENT_ARRAY_BUFFER && vertexArray != UNKNOWN)
+            {
+                shadow = &elementArrayBuffers.emplace(vertexArray, UNKNOWN).first->second;
+            }
+
+            if (shadow != nullptr && *shadow == buffer)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            GL_CALL(glBindBuffer(target, buffer));
+            if (shadow != nullptr)
+            {
+                *shadow = buffer;
+            }
+            OnIssued();
+        }
+
+        void BindTexture(const uint32_t unit, const uint32_t target, const uint32_t texture)
+        {
+            const bool isTracked = unit < TEXTURE_UNIT_COUNT && target == GL_TEXTURE_2D;
+            if (isTracked && textures[unit] == texture)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            SetActiveTextureUnit(unit);
+            GL_CALL(glBindTexture(target, texture));
+            if (isTracked)
+            {
+                textures[unit] = texture;
+            }
+            OnIssued();
+        }
+
+        void SetCapability(const uint32_t capability, const bool isEnabled)
+        {
+            const auto it = capabilities.find(capability);
+            if (it != capabilities.end() && it->second == isEnabled)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            if (isEnabled)
+            {
+                GL_CALL(glEnable(capability));
+            }
+            else
+            {
+                GL_CALL(glDisable(capability));
+            }
+            capabilities[capability] = isEnabled;
+            OnIssued();
+        }
+
+        void SetBlendFunction(const uint32_t srcFactor, const uint32_t dstFactor, const uint32_t srcAlphaFactor,
+                              const uint32_t dstAlphaFactor)
+        {
+            const std::array<uint32_t, 4> value{srcFactor, dstFactor, srcAlphaFactor, dstAlphaFactor};
+            if (blendFunction == value)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            if (srcFactor == srcAlphaFactor && dstFactor == dstAlphaFactor)
+            {
+                GL_CALL(glBlendFunc(srcFactor, dstFactor));
+            }
+            else
+            {
+                GL_CALL(glBlendFuncSeparate(srcFactor, dstFactor, srcAlphaFactor, dstAlphaFactor));
+            }
+            blendFunction = value;
+            OnIssued();
+        }
+
+        void SetBlendEquation(const uint32_t equation, const uint32_t alphaEquation)
+        {
+            const std::array<uint32_t, 2> value{equation, alphaEquation};
+            if (blendEquation == value)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            if (equation == alphaEquation)
+            {
+                GL_CALL(glBlendEquation(equation));
+            }
+            else
+            {
+                GL_CALL(glBlendEquationSeparate(equation, alphaEquation));
+            }
+            blendEquation = value;
+            OnIssued();
+        }
+
+        void SetDepthFunction(const uint32_t value)
+        {
+            if (depthFunction == value)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            GL_CALL(glDepthFunc(value));
+            depthFunction = value;
+            OnIssued();
+        }
+
+        void SetCullFace(const uint32_t value)
+        {
+            if (cullFace == value)
+            {
+                ++skippedCallsCount;
+                return;
+            }
+
+            GL_CALL(glCullFace(value));
+            cullFace = value;
+            OnIssued();
+        }
+
+        void DeleteProgram(const uint32_t value)
+        {
+            // A program in use is only deleted once it is no longer used.
+            if (program == value)
+            {
+                UseProgram(0);
+            }
+            GL_CALL(glDeleteProgram(value));
+        }
+
+        void DeleteVertexArray(const uint32_t value)
+        {
+            GL_CALL(glDeleteVertexArrays(1, &value));
+            elementArrayBuffers.erase(value);
+            if (vertexArray == value)
+            {
+                vertexArray = 0;
+            }
+        }
+
+        void DeleteBuffer(const uint32_t value)
+        {
+            GL_CALL(glDeleteBuffers(1, &value));
+            if (arrayBuffer == value)
+            {
+                arrayBuffer = 0;
+            }
+
+            // Only the binding of the bound vertex array is reset, the others would still refer to the deleted name.
+            for (auto& it : elementArrayBuffers)
+            {
+                if (it.second == value)
+                {
+                    it.second = it.first == vertexArray ? 0 : UNKNOWN;
+                }
+            }
+        }
+
+        void DeleteTexture(const uint32_t value)
+        {
+            GL_CALL(glDeleteTextures(1, &value));
+            for (auto& texture : textures)
+            {
+                if (texture == value)
+                {
+                    texture = 0;
+                }
+            }
+        }
+
+        void Invalidate()
+        {
+            program = UNKNOWN;
+            vertexArray = UNKNOWN;
+            arrayBuffer = UNKNOWN;
+            elementArrayBuffers.clear();
+            activeTextureUnit = UNKNOWN;
+            textures.fill(UNKNOWN);
+            capabilities.clear();
+            blendFunction.fill(UNKNOWN);
+            blendEquation.fill(UNKNOWN);
+            depthFunction = UNKNOWN;
+            cullFace = UNKNOWN;
+        }
+
+        void Validate() const
+        {
+            Check("program", program, GetInteger(GL_CURRENT_PROGRAM));
+            Check("vertex array", vertexArray, GetInteger(GL_VERTEX_ARRAY_BINDING));
+            Check("array buffer", arrayBuffer, GetInteger(GL_ARRAY_BUFFER_BINDING));
+
+            const auto elementArrayBuffer = elementArrayBuffers.find(vertexArray);
+            if (elementArrayBuffer != elementArrayBuffers.end())
+            {
+                Check("element array buffer", elementArrayBuffer->second, GetInteger(GL_ELEMENT_ARRAY_BUFFER_BINDING));
+            }
+
+            Check("active texture unit", activeTextureUnit, GetInteger(GL_ACTIVE_TEXTURE) - GL_TEXTURE0);
+            if (activeTextureUnit != UNKNOWN && activeTextureUnit < TEXTURE_UNIT_COUNT)
+            {
+                Check("texture", textures[activeTextureUnit], GetInteger(GL_TEXTURE_BINDING_2D));
+            }
+
+            for (const auto& it : capabilities)
+            {
+                GL_CALL(const bool isEnabled = glIsEnabled(it.first));
+                Check("capability " + std::to_string(it.first), it.second, isEnabled);
+            }
+
+            Check("blend source factor", blendFunction[0], GetInteger(GL_BLEND_SRC_RGB));
+            Check("blend destination factor", blendFunction[1], GetInteger(GL_BLEND_DST_RGB));
+            Check("blend source alpha factor", blendFunction[2], GetInteger(GL_BLEND_SRC_ALPHA));
+            Check("blend destination alpha factor", blendFunction[3], GetInteger(GL_BLEND_DST_ALPHA));
+            Check("blend equation", blendEquation[0], GetInteger(GL_BLEND_EQUATION_RGB));
+            Check("blend alpha equation", blendEquation[1], GetInteger(GL_BLEND_EQUATION_ALPHA));
+            Check("depth function", depthFunction, GetInteger(GL_DEPTH_FUNC));
+            Check("cull face", cullFace, GetInteger(GL_CULL_FACE_MODE));
+        }
+
+        size_t GetSkippedCallsCount() const
+        {
+            return skippedCallsCount;
+        }
+
+        size_t GetIssuedCallsCount() const
+        {
+            return issuedCallsCount;
+        }
+
+        void ResetCallsCount()
+        {
+            skippedCallsCount = 0;
+            issuedCallsCount = 0;
+        }
+
+    private:
+        void SetActiveTextureUnit(const uint32_t unit)
+        {
+            if (activeTextureUnit == unit)
+            {
+                return;
+            }
+
+            GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
+            activeTextureUnit = unit;
+        }
+
+        void OnIssued()
+        {
+            ++issuedCallsCount;
+            if (isValidating)
+            {
+                Validate();
+            }
+        }
+
+        static uint32_t GetInteger(const GLenum name)
+        {
+            GLint value = 0;
+            GL_CALL(glGetIntegerv(name, &value));
+            return static_cast<uint32_t>(value);
+        }
+
+        static void Check(const std::string& state, const uint32_t shadowValue, const uint32_t glValue)
+        {
+            if (shadowValue != UNKNOWN && shadowValue != glValue)
+            {
+                Exception::Throw(std::runtime_error(
+                    "GlStateCache " + state + " is " + std::to_string(shadowValue) + " but OpenGL has " +
+                    std::to_string(glValue) + "."));
+            }
+        }
+    };
+
+    GlStateCache::Factory::Factory(ServiceCollection& serviceCollection)
+        : BaseFactory(serviceCollection)
+    {
+    }
+
+    std::unique_ptr<GlStateCache> GlStateCache::Factory::Create() const
+    {
+        ServiceCollection& serviceCollection = GetServiceCollection();
+        auto& logManager = serviceCollection.GetService<LogManager>();
+        const auto& configManager = serviceCollection.GetService<ConfigManager>();
+        const bool isValidating = configManager.GetBool("glStateCacheValidation", false);
+        return std::make_unique<GlStateCache>(std::make_unique<Impl>(isValidating, logManager));
+    }
+
+    GlStateCache::~GlStateCache() = default;
+
+    GlStateCache::GlStateCache(std::unique_ptr<Impl> impl)
+        : impl(std::move(impl))
+    {
+    }
+
+    GlStateCache::GlStateCache(GlStateCache&& other) noexcept = default;
+
+    GlStateCache& GlStateCache::operator=(GlStateCache&& rhs) noexcept = default;
+
+    void GlStateCache::UseProgram(const uint32_t program)
+    {
+        impl->UseProgram(program);
+    }
+
+    void GlStateCache::BindVertexArray(const uint32_t vertexArray)
+    {
+        impl->BindVertexArray(vertexArray);
+    }
+
+    void GlStateCache::BindBuffer(const uint32_t target, const uint32_t buffer)
+    {
+        impl->BindBuffer(target, buffer);
+    }
+
+    void GlStateCache::BindTexture(const uint32_t unit, const uint32_t target, const uint32_t texture)
+    {
+        impl->BindTexture(unit, target, texture);
+    }
+
+    void GlStateCache::SetCapability(const uint32_t capability, const bool isEnabled)
+    {
+        impl->SetCapability(capability, isEnabled);
+    }
+
+    void GlStateCache::SetBlendFunction(const uint32_t srcFactor, const uint32_t dstFactor,
+                                        const uint32_t srcAlphaFactor, const uint32_t dstAlphaFactor)
+    {
+        impl->SetBlendFunction(srcFactor, dstFactor, srcAlphaFactor, dstAlphaFactor);
+    }
+
+    void GlStateCache::SetBlendEquation(const uint32_t equation, const uint32_t alphaEquation)
+    {
+        impl->SetBlendEquation(equation, alphaEquation);
+    }
+
+    void GlStateCache::SetDepthFunction(const uint32_t function)
+    {
+        impl->SetDepthFunction(function);
+    }
+
+    void GlStateCache::SetCullFace(const uint32_t face)
+    {
+        impl->SetCullFace(face);
+    }
+
+    void GlStateCache::DeleteProgram(const uint32_t program)
+    {
+        impl->DeleteProgram(program);
+    }
+
+    void GlStateCache::DeleteVertexArray(const uint32_t vertexArray)
+    {
+        impl->DeleteVertexArray(vertexArray);
+    }
+
+    void GlStateCache::DeleteBuffer(const uint32_t buffer)
+    {
+        impl->DeleteBuffer(buffer);
+    }
+
+    void GlStateCache::DeleteTexture(const uint32_t texture)
+    {
+        impl->DeleteTexture(texture);
+    }
+
+    void GlStateCache::Invalidate()
+    {
+        impl->Invalidate();
+    }
+
+    void GlStateCache::Validate() const
+    {
+        impl->Validate();
+    }
+
+    size_t GlStateCache::GetSkippedCallsCount() const
+    {
+        return impl->GetSkippedCallsCount();
+    }
+
+    size_t GlStateCache::GetIssuedCallsCount() const
+    {
+        return impl->GetIssuedCallsCount();
+    }
+
+    void GlStateCache::ResetCallsCount()
+    {
+        impl->ResetCallsCount();
+    }
+}
@@ -2,8 +2,11 @@
 #include "pluto/asset/texture_asset.h"
 #include "pluto/math/vector2i.h"
 
+#include "pluto/render/gl/gl_state_cache.h"
 #include "pluto/render/gl/gl_call.h"
 
+#include "pluto/service/service_collection.h"
+
 #include <GL/glew.h>
 
 #include <array>
@@ -30,17 +33,19 @@ namespace pluto
     class GlTextureBuffer::Impl
     {
         GLuint textureBufferObjectId;
+        GlStateCache* stateCache;
 
     public:
-        explicit Impl(const GLuint textureBufferObjectId)
-            : textureBufferObjectId(textureBufferObjectId)
+        Impl(const GLuint textureBufferObjectId, GlStateCache& stateCache)
+            : textureBufferObjectId(textureBufferObjectId),
+              stateCache(&stateCache)
 
         {
         }
 
         ~Impl()
         {
-            GL_CALL(glDeleteTextures(1, &textureBufferObjectId));
+            stateCache->DeleteTexture(textureBufferObjectId);
         }
 
         Impl(const Impl& other) = delete;
@@ -53,8 +58,7 @@ namespace pluto
 
         void Update(TextureAsset& textureAsset)
         {
-            GL_CALL(glActiveTexture(GL_TEXTURE0));
-            GL_CALL(glBindTexture(GL_TEXTURE_2D, textureBufferObjectId));
+            stateCache->BindTexture(0, GL_TEXTURE_2D, textureBufferObjectId);
 
             const GLint wrap = WRAPS[static_cast<int>(textureAsset.GetWrap())];
             const GLint filter = FILTERS[static_cast<int>(textureAsset.GetFilter())];
@@ -98,14 +102,11 @@ namespace pluto
             }
 
             GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data.data()));
-
-            GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
         }
 
         void Bind(const uint8_t location)
         {
-            GL_CALL(glActiveTexture(GL_TEXTURE0 + location));
-            GL_CALL(glBindTexture(GL_TEXTURE_2D, textureBufferObjectId));
+            stateCache->BindTexture(location, GL_TEXTURE_2D, textureBufferObjectId);
         }
 
         void Unbind()
@@ -124,7 +125,8 @@ namespace pluto
     {
         GLuint textureBufferObject;
         GL_CALL(glGenTextures(1, &textureBufferObject));
-        return std::make_unique<GlTextureBuffer>(std::make_unique<Impl>(textureBufferObject));
+        auto& stateCache = GetServiceCollection().GetService<GlStateCache>();
+        return std::make_unique<GlTextureBuffer>(std::make_unique<Impl>(textureBufferObject, stateCache));
     }
 
     GlTextureBuffer::GlTextureBuffer(std::unique_ptr<Impl> impl)
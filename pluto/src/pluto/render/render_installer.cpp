@@ -5,6 +5,7 @@
 #include <pluto/render/gl/gl_mesh_buffer.h>
 #include <pluto/render/gl/gl_shader_program.h>
 #include <pluto/render/gl/gl_texture_buffer.h>
+#include <pluto/render/gl/gl_state_cache.h>
 
 #include <pluto/service/service_collection.h>
 
@@ -12,6 +13,8 @@ namespace pluto
 {
     void InstallOpenGl(ServiceCollection& serviceCollection)
     {
+        serviceCollection.AddService<GlStateCache>(GlStateCache::Factory(serviceCollection).Create());
+
         serviceCollection.AddFactory<MeshBuffer>(std::make_unique<GlMeshBuffer::Factory>(serviceCollection));
         serviceCollection.AddFactory<ShaderProgram>(std::make_unique<GlShaderProgram::Factory>(serviceCollection));
         serviceCollection.AddFactory<TextureBuffer>(std::make_unique<GlTextureBuffer::Factory>(serviceCollection));
@@ -30,5 +33,6 @@ namespace pluto
         serviceCollection.RemoveFactory<TextureBuffer>();
         serviceCollection.RemoveFactory<ShaderProgram>();
         serviceCollection.RemoveFactory<MeshBuffer>();
+        serviceCollection.RemoveService<GlStateCache>();
     }
 }
@@ -0,0 +1,161 @@
+#include "pluto/render/render_queue.h"
+
+#include "pluto/scene/components/renderer.h"
+
+#include "pluto/asset/mesh_asset.h"
+#include "pluto/asset/material_asset.h"
+#include "pluto/asset/shader_asset.h"
+
+#include "pluto/memory/resource.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
+namespace pluto
+{
+    class RenderQueue::Impl
+    {
+        static constexpr uint32_t RADIX_BITS = 8;
+        static constexpr uint32_t RADIX_SIZE = 1u << RADIX_BITS;
+        static constexpr uint32_t RADIX_PASSES = 64 / RADIX_BITS;
+
+        std::vector<Command> commands;
+        std::vector<Command> sortBuffer;
+
+        // Dense ids of the states of the frame, so they fit in the key.
+        std::unordered_map<const ShaderAsset*, uint32_t> shaderIds;
+        std::unordered_map<const MaterialAsset*, uint32_t> materialIds;
+        std::unordered_map<const MeshAsset*, uint32_t> meshIds;
+
+    public:
+        static uint64_t MakeKey(const uint8_t layer, const float depth, const uint32_t shader, const uint32_t material,
+                                const uint32_t mesh)
+        {
+            return static_cast<uint64_t>(layer) << LAYER_SHIFT |
+                static_cast<uint64_t>(GetDepthBits(depth)) << DEPTH_SHIFT |
+                static_cast<uint64_t>(Clamp(shader, SHADER_BITS)) << SHADER_SHIFT |
+                static_cast<uint64_t>(Clamp(material, MATERIAL_BITS)) << MATERIAL_SHIFT |
+                static_cast<uint64_t>(Clamp(mesh, MESH_BITS)) << MESH_SHIFT;
+        }
+
+        void Clear()
+        {
+            commands.clear();
+            shaderIds.clear();
+            materialIds.clear();
+            meshIds.clear();
+        }
+
+        void Add(Renderer& renderer, const uint8_t layer, const float depth)
+        {
+            Resource<MeshAsset> mesh = renderer.GetMesh();
+            Resource<MaterialAsset> material = renderer.GetMaterial();
+            Resource<ShaderAsset> shader = material->GetShader();
+
+            Command command{0, &renderer, mesh.Get(), material.Get(), shader.Get()};
+            command.key = MakeKey(layer, depth, GetId(shaderIds, command.shader), GetId(materialIds, command.material),
+                                  GetId(meshIds, command.mesh));
+            commands.push_back(command);
+        }
+
+        void Sort()
+        {
+            sortBuffer.resize(commands.size());
+
+            // Least significant digit first, passes whose digit is the same for every command are skipped.
+            for (uint32_t pass = 0; pass < RADIX_PASSES; ++pass)
+            {
+                const uint32_t shift = pass * RADIX_BITS;
+                std::array<size_t, RADIX_SIZE> offsets{};
+                for (const auto& command : commands)
+                {
+                    ++offsets[command.key >> shift & (RADIX_SIZE - 1)];
+                }
+
+                if (std::find(offsets.begin(), offsets.end(), commands.size()) != offsets.end())
+                {
+                    continue;
+                }
+
+                size_t offset = 0;
+                for (auto& count : offsets)
+                {
+                    const size_t digitCount = count;
+                    count = offset;
+                    offset += digitCount;
+                }
+
+                for (const auto& command : commands)
+                {
+                    sortBuffer[offsets[command.key >> shift & (RADIX_SIZE - 1)]++] = command;
+                }
+                commands.swap(sortBuffer);
+            }
+        }
+
+        const std::vector<Command>& GetCommands() const
+        {
+            return commands;
+        }
+
+    private:
+        static uint32_t GetDepthBits(const float depth)
+        {
+            // Flips the float bits so they sort as unsigned integers, the most significant ones are kept.
+            uint32_t bits;
+            std::memcpy(&bits, &depth, sizeof(float));
+            bits = (bits & 0x80000000u) != 0 ? ~bits : bits | 0x80000000u;
+            return bits >> (32 - DEPTH_BITS);
+        }
+
+        static uint32_t Clamp(const uint32_t value, const uint32_t bits)
+        {
+            return std::min(value, (1u << bits) - 1);
+        }
+
+        template <typename T>
+        static uint32_t GetId(std::unordered_map<const T*, uint32_t>& ids, const T* object)
+        {
+            return ids.emplace(object, static_cast<uint32_t>(ids.size())).first->second;
+        }
+    };
+
+    RenderQueue::~RenderQueue() = default;
+
+    RenderQueue::RenderQueue()
+        : impl(std::make_unique<Impl>())
+    {
+    }
+
+    RenderQueue::RenderQueue(RenderQueue&& other) noexcept = default;
+
+    RenderQueue& RenderQueue::operator=(RenderQueue&& rhs) noexcept = default;
+
+    uint64_t RenderQueue::MakeKey(const uint8_t layer, const float depth, const uint32_t shader,
+                                  const uint32_t material, const uint32_t mesh)
+    {
+        return Impl::MakeKey(layer, depth, shader, material, mesh);
+    }
+
+    void RenderQueue::Clear()
+    {
+        impl->Clear();
+    }
+
+    void RenderQueue::Add(Renderer& renderer, const uint8_t layer, const float depth)
+    {
+        impl->Add(renderer, layer, depth);
+    }
+
+    void RenderQueue::Sort()
+    {
+        impl->Sort();
+    }
+
+    const std::vector<RenderQueue::Command>& RenderQueue::GetCommands() const
+    {
+        return impl->GetCommands();
+    }
+}
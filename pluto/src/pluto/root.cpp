@@ -9,6 +9,7 @@
 #include <pluto/input/input_installer.h>
 #include <pluto/simulation/simulation_installer.h>
 #include <pluto/memory/memory_installer.h>
+#include <pluto/job/job_installer.h>
 #include <pluto/asset/asset_installer.h>
 #include <pluto/scene/scene_installer.h>
 #include <pluto/render/render_installer.h>
@@ -61,6 +62,7 @@ namespace pluto
             WindowInstaller::Install(*serviceCollection);
             InputInstaller::Install(*serviceCollection);
             MemoryInstaller::Install(*serviceCollection);
+            JobInstaller::Install(*serviceCollection);
             AssetInstaller::Install(*serviceCollection);
             SceneInstaller::Install(*serviceCollection);
             RenderInstaller::Install(*serviceCollection);
@@ -79,9 +81,11 @@ namespace pluto
             SimulationInstaller::Uninstall(*serviceCollection);
             SceneInstaller::Uninstall(*serviceCollection);
             Physics2DInstaller::Uninstall(*serviceCollection);
-            RenderInstaller::Uninstall(*serviceCollection);
             AssetInstaller::Uninstall(*serviceCollection);
+            JobInstaller::Uninstall(*serviceCollection);
             MemoryInstaller::Uninstall(*serviceCollection);
+            // Assets free their GPU buffers through the GL state cache when the memory is uninstalled.
+            RenderInstaller::Uninstall(*serviceCollection);
             InputInstaller::Uninstall(*serviceCollection);
             WindowInstaller::Uninstall(*serviceCollection);
             EventInstaller::Uninstall(*serviceCollection);
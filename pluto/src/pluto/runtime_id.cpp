@@ -0,0 +1,25 @@
+#include <pluto/runtime_id.h>
+
+#include <atomic>
+
+namespace pluto
+{
+    static std::atomic<uint64_t> runtimeIdCounter(0);
+
+    std::ostream& operator<<(std::ostream& os, const RuntimeId& runtimeId)
+    {
+        os << runtimeId.value;
+        return os;
+    }
+
+    std::string RuntimeId::Str() const
+    {
+        return std::to_string(value);
+    }
+
+    RuntimeId RuntimeId::New()
+    {
+        // Only uniqueness is needed, ordering with other memory operations is not.
+        return RuntimeId(runtimeIdCounter.fetch_add(1, std::memory_order_relaxed) + 1);
+    }
+}
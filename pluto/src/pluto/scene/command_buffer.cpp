@@ -0,0 +1,135 @@
+#include <pluto/scene/command_buffer.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+
+#include <pluto/memory/resource.h>
+
+#include <mutex>
+#include <vector>
+
+namespace pluto
+{
+    class CommandBuffer::Impl
+    {
+        mutable std::mutex mutex;
+        std::vector<Command> commands;
+        std::vector<Command> executing;
+
+    public:
+        void Add(Command command)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            commands.push_back(std::move(command));
+        }
+
+        bool IsEmpty() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return commands.empty();
+        }
+
+        void Execute(Scene& scene)
+        {
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (commands.empty())
+                    {
+                        return;
+                    }
+                    executing.swap(commands);
+                }
+
+                try
+                {
+                    for (auto& command : executing)
+                    {
+                        command(scene);
+                    }
+                }
+                catch (...)
+                {
+                    Clear();
+                    throw;
+                }
+                executing.clear();
+            }
+        }
+
+        void Clear()
+        {
+            executing.clear();
+            std::lock_guard<std::mutex> lock(mutex);
+            commands.clear();
+        }
+    };
+
+    CommandBuffer::~CommandBuffer() = default;
+
+    CommandBuffer::CommandBuffer()
+        : impl(std::make_unique<Impl>())
+    {
+    }
+
+    CommandBuffer::CommandBuffer(CommandBuffer&& other) noexcept = default;
+
+    CommandBuffer& CommandBuffer::operator=(CommandBuffer&& rhs) noexcept = default;
+
+    void CommandBuffer::Add(Command command)
+    {
+        impl->Add(std::move(command));
+    }
+
+    void CommandBuffer::CreateGameObject(const Resource<Transform>& parent, const std::string& name,
+                                         std::function<void(const Resource<GameObject>& gameObject)> onCreated)
+    {
+        impl->Add([parent, name, onCreated = std::move(onCreated)](Scene& scene)
+        {
+            const Resource<GameObject> gameObject = scene.CreateGameObject(parent, name);
+            if (onCreated != nullptr)
+            {
+                onCreated(gameObject);
+            }
+        });
+    }
+
+    void CommandBuffer::AddComponent(const Resource<GameObject>& gameObject, const std::type_info& type,
+                                     const Component::PhaseMask phases)
+    {
+        impl->Add([gameObject = gameObject, &type, phases](Scene&) mutable
+        {
+            if (gameObject != nullptr && !gameObject->IsDestroyed())
+            {
+                gameObject->AddComponent(type, phases);
+            }
+        });
+    }
+
+    void CommandBuffer::Destroy(const Resource<GameObject>& gameObject)
+    {
+        impl->Add([gameObject = gameObject](Scene&) mutable
+        {
+            if (gameObject != nullptr)
+            {
+                gameObject->Destroy();
+            }
+        });
+    }
+
+    bool CommandBuffer::IsEmpty() const
+    {
+        return impl->IsEmpty();
+    }
+
+    void CommandBuffer::Execute(Scene& scene)
+    {
+        impl->Execute(scene);
+    }
+
+    void CommandBuffer::Clear()
+    {
+        impl->Clear();
+    }
+}
@@ -1,17 +1,25 @@
 #include "pluto/scene/components/behaviour.h"
 #include "pluto/scene/components/component.impl.hpp"
 
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 
 namespace pluto
 {
     class Behaviour::Impl : public Component::Impl
     {
+        bool isParallelSafe;
+
     public:
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject)
-            : Component::Impl(guid, gameObject)
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject, const bool isParallelSafe)
+            : Component::Impl(runtimeId, gameObject),
+              isParallelSafe(isParallelSafe)
         {
         }
+
+        bool IsParallelSafe() const
+        {
+            return isParallelSafe;
+        }
     };
 
     Behaviour::~Behaviour() = default;
@@ -23,11 +31,21 @@ namespace pluto
     }
 
     Behaviour::Behaviour(const Resource<GameObject>& gameObject)
-        : Behaviour(std::make_unique<Impl>(Guid::New(), gameObject))
+        : Behaviour(gameObject, false)
+    {
+    }
+
+    Behaviour::Behaviour(const Resource<GameObject>& gameObject, const bool isParallelSafe)
+        : Behaviour(std::make_unique<Impl>(RuntimeId::New(), gameObject, isParallelSafe))
     {
     }
 
     Behaviour::Behaviour(Behaviour&& other) noexcept = default;
 
     Behaviour& Behaviour::operator=(Behaviour&& rhs) noexcept = default;
+
+    bool Behaviour::IsParallelSafe() const
+    {
+        return impl->IsParallelSafe();
+    }
 }
@@ -6,13 +6,14 @@
 #include "pluto/scene/components/transform.h"
 
 #include "pluto/memory/resource.h"
+#include "pluto/memory/pool_allocator.h"
 
 #include "pluto/service/service_collection.h"
 #include "pluto/window/window_manager.h"
 #include "pluto/math/matrix4x4.h"
 #include "pluto/math/vector3f.h"
 #include "pluto/math/quaternion.h"
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 
 namespace pluto
 {
@@ -34,8 +35,8 @@ namespace pluto
         const WindowManager* windowManager;
 
     public:
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject, const WindowManager& windowManager)
-            : Component::Impl(guid, gameObject),
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject, const WindowManager& windowManager)
+            : Component::Impl(runtimeId, gameObject),
               type(Type::Orthographic),
               orthographicSize(5),
               nearPlane(0.1f),
@@ -154,7 +155,8 @@ namespace pluto
     {
         ServiceCollection& serviceCollection = GetServiceCollection();
         const auto& windowManager = serviceCollection.GetService<WindowManager>();
-        return std::make_unique<Camera>(std::make_unique<Impl>(Guid::New(), gameObject, windowManager));
+        auto& poolAllocator = serviceCollection.GetService<PoolAllocator>();
+        return poolAllocator.New<Camera>(poolAllocator.New<Impl>(RuntimeId::New(), gameObject, windowManager));
     }
 
     Camera::~Camera() = default;
@@ -1,8 +1,63 @@
 #include "pluto/scene/components/component.h"
 #include "pluto/scene/components/component.impl.hpp"
 
+#include "pluto/type_registry.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace pluto
 {
+    enum class TypeMatch : uint8_t
+    {
+        Unknown = 0,
+        Yes = 1,
+        No = 2,
+    };
+
+    // Indexed by base type id and then by type id. A published table is never changed, testing a new pair of types
+    // publishes a copy with its answer, so the lookups made by parallel behaviours only load the current table.
+    using TypeMatches = std::vector<std::vector<TypeMatch>>;
+
+    static std::atomic<const TypeMatches*>& GetTypeMatches()
+    {
+        static std::atomic<const TypeMatches*> typeMatches(nullptr);
+        return typeMatches;
+    }
+
+    // Guards publishing. Every table published is kept, a lookup may still be reading an older one.
+    static std::mutex& GetTypeMatchesMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<std::unique_ptr<TypeMatches>>& GetPublishedTypeMatches()
+    {
+        static std::vector<std::unique_ptr<TypeMatches>> publishedTypeMatches;
+        return publishedTypeMatches;
+    }
+
+    static TypeMatch FindTypeMatch(const TypeMatches* typeMatches, const size_t typeId, const size_t baseTypeId)
+    {
+        if (typeMatches == nullptr || baseTypeId >= typeMatches->size())
+        {
+            return TypeMatch::Unknown;
+        }
+
+        const auto& matches = (*typeMatches)[baseTypeId];
+        return typeId < matches.size() ? matches[typeId] : TypeMatch::Unknown;
+    }
+
+    static std::unordered_map<std::string, Component::RegisteredType>& GetRegisteredTypes()
+    {
+        static std::unordered_map<std::string, Component::RegisteredType> registeredTypes;
+        return registeredTypes;
+    }
+
     Component::Factory::Factory(ServiceCollection& serviceCollection)
         : BaseFactory(serviceCollection)
     {
@@ -11,11 +66,13 @@ namespace pluto
     Component::~Component() = default;
 
     Component::Component(Impl& impl)
-        : impl(&impl)
+        : Object(impl.GetRuntimeId()),
+          impl(&impl)
     {
     }
 
     Component::Component(Component&& other) noexcept
+        : Object(std::move(other))
     {
         impl = other.impl;
         other.impl = nullptr;
@@ -23,11 +80,6 @@ namespace pluto
 
     Component& Component::operator=(Component&& rhs) noexcept = default;
 
-    const Guid& Component::GetId() const
-    {
-        return impl->GetId();
-    }
-
     const std::string& Component::GetName() const
     {
         return impl->GetName();
@@ -95,7 +147,82 @@ namespace pluto
     {
     }
 
+    void Component::OnEnable()
+    {
+    }
+
+    void Component::OnDisable()
+    {
+    }
+
+    void Component::OnSpawn()
+    {
+    }
+
+    void Component::OnDespawn()
+    {
+    }
+
     void Component::OnDestroy()
     {
     }
+
+    size_t Component::GetTypeId(const std::type_info& type)
+    {
+        return TypeRegistry::GetId(typeid(Component), type);
+    }
+
+    bool Component::IsTypeOf(const size_t typeId, const size_t baseTypeId, const Component& sample, const TypeTest test)
+    {
+        if (typeId == baseTypeId)
+        {
+            return true;
+        }
+
+        TypeMatch match = FindTypeMatch(GetTypeMatches().load(std::memory_order_acquire), typeId, baseTypeId);
+        if (match != TypeMatch::Unknown)
+        {
+            return match == TypeMatch::Yes;
+        }
+
+        std::lock_guard<std::mutex> lock(GetTypeMatchesMutex());
+        const TypeMatches* typeMatches = GetTypeMatches().load(std::memory_order_relaxed);
+        match = FindTypeMatch(typeMatches, typeId, baseTypeId);
+        if (match != TypeMatch::Unknown)
+        {
+            return match == TypeMatch::Yes;
+        }
+
+        auto nextTypeMatches = typeMatches == nullptr
+                                   ? std::make_unique<TypeMatches>()
+                                   : std::make_unique<TypeMatches>(*typeMatches);
+        if (baseTypeId >= nextTypeMatches->size())
+        {
+            nextTypeMatches->resize(baseTypeId + 1);
+        }
+
+        auto& matches = (*nextTypeMatches)[baseTypeId];
+        if (typeId >= matches.size())
+        {
+            matches.resize(typeId + 1, TypeMatch::Unknown);
+        }
+
+        match = test(sample) ? TypeMatch::Yes : TypeMatch::No;
+        matches[typeId] = match;
+        GetTypeMatches().store(nextTypeMatches.get(), std::memory_order_release);
+        GetPublishedTypeMatches().push_back(std::move(nextTypeMatches));
+        return match == TypeMatch::Yes;
+    }
+
+    void Component::RegisterType(const std::string& name, const std::type_info& type, const PhaseMask phases)
+    {
+        GetRegisteredTypes()[name] = {&type, phases};
+    }
+
+    const Component::RegisteredType* Component::FindType(const std::string& name)
+    {
+        const auto& registeredTypes = GetRegisteredTypes();
+        const auto it = registeredTypes.find(name);
+        return it == registeredTypes.end() ? nullptr : &it->second;
+    }
 }
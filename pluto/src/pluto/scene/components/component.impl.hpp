@@ -4,25 +4,26 @@
 #include "pluto/scene/components/component.h"
 #include "pluto/scene/game_object.h"
 #include "pluto/memory/resource.h"
-#include "pluto/guid.h"
+#include "pluto/memory/pool_object.h"
+#include "pluto/runtime_id.h"
 
 namespace pluto
 {
-    class Component::Impl
+    class Component::Impl : public PoolObject
     {
-        Guid guid;
+        RuntimeId runtimeId;
         Resource<GameObject> gameObject;
 
     public:
-        Impl(const Guid& guid, Resource<GameObject> gameObject)
-            : guid(guid),
+        Impl(const RuntimeId runtimeId, Resource<GameObject> gameObject)
+            : runtimeId(runtimeId),
               gameObject(std::move(gameObject))
         {
         }
 
-        const Guid& GetId() const
+        RuntimeId GetRuntimeId() const
         {
-            return guid;
+            return runtimeId;
         }
 
         const std::string& GetName() const
@@ -5,9 +5,11 @@
 #include "pluto/asset/mesh_asset.h"
 #include "pluto/asset/material_asset.h"
 #include "pluto/memory/resource.h"
+#include "pluto/memory/pool_allocator.h"
+#include "pluto/service/service_collection.h"
 
 #include "pluto/math/bounds.h"
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 
 namespace pluto
 {
@@ -17,8 +19,8 @@ namespace pluto
         Resource<MaterialAsset> materialAsset;
 
     public:
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject)
-            : Component::Impl(guid, gameObject),
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject)
+            : Component::Impl(runtimeId, gameObject),
               meshAsset(nullptr),
               materialAsset(nullptr)
         {
@@ -57,7 +59,8 @@ namespace pluto
 
     std::unique_ptr<Component> MeshRenderer::Factory::Create(const Resource<GameObject>& gameObject) const
     {
-        return std::make_unique<MeshRenderer>(std::make_unique<Impl>(Guid::New(), gameObject));
+        auto& poolAllocator = GetServiceCollection().GetService<PoolAllocator>();
+        return poolAllocator.New<MeshRenderer>(poolAllocator.New<Impl>(RuntimeId::New(), gameObject));
     }
 
     MeshRenderer::~MeshRenderer() = default;
@@ -3,6 +3,8 @@
 
 #include "pluto/memory/memory_manager.h"
 #include "pluto/memory/resource.h"
+#include "pluto/memory/pool_allocator.h"
+#include "pluto/memory/frame_allocator.h"
 
 #include "pluto/service/service_collection.h"
 
@@ -32,6 +34,7 @@ namespace pluto
         bool isDirty;
 
         MemoryManager* memoryManager;
+        FrameAllocator* frameAllocator;
 
     public:
         ~Impl()
@@ -39,13 +42,14 @@ namespace pluto
             memoryManager->Remove(*mesh.Get());
         }
 
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject, Resource<MeshAsset> mesh,
-             MemoryManager& memoryManager)
-            : Component::Impl(guid, gameObject),
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject, Resource<MeshAsset> mesh,
+             MemoryManager& memoryManager, FrameAllocator& frameAllocator)
+            : Component::Impl(runtimeId, gameObject),
               mesh(std::move(mesh)),
               anchor(Anchor::Default),
               isDirty(false),
-              memoryManager(&memoryManager)
+              memoryManager(&memoryManager),
+              frameAllocator(&frameAllocator)
         {
         }
 
@@ -126,9 +130,12 @@ namespace pluto
     private:
         void UpdateMesh()
         {
-            std::vector<Vector3F> positions;
-            std::vector<Vector2F> uvs;
-            std::vector<Vector3I> triangles;
+            FrameVector<Vector3F> positions(*frameAllocator);
+            FrameVector<Vector2F> uvs(*frameAllocator);
+            FrameVector<Vector3I> triangles(*frameAllocator);
+            positions.reserve(text.size() * 4);
+            uvs.reserve(text.size() * 4);
+            triangles.reserve(text.size() * 2);
 
             FontAsset& fontAsset = *font.Get();
             float x = 0;
@@ -199,9 +206,9 @@ namespace pluto
                 position = (position + offset) / 100;
             }
 
-            mesh->SetPositions(positions);
-            mesh->SetUVs(uvs);
-            mesh->SetTriangles(triangles);
+            mesh->SetPositions(positions.data(), positions.size());
+            mesh->SetUVs(uvs.data(), uvs.size());
+            mesh->SetTriangles(triangles.data(), triangles.size());
         }
 
         Vector3F GetAnchorOffset(const float maxX, const uint32_t lineCount)
@@ -250,8 +257,10 @@ namespace pluto
         auto& memoryManager = serviceCollection.GetService<MemoryManager>();
         Resource<MeshAsset> meshAssetResource = ResourceUtils::Cast<MeshAsset>(memoryManager.Add(std::move(meshAsset)));
 
-        return std::make_unique<TextRenderer>(
-            std::make_unique<Impl>(Guid::New(), gameObject, meshAssetResource, memoryManager));
+        auto& frameAllocator = serviceCollection.GetService<FrameAllocator>();
+        auto& poolAllocator = serviceCollection.GetService<PoolAllocator>();
+        return poolAllocator.New<TextRenderer>(
+            poolAllocator.New<Impl>(RuntimeId::New(), gameObject, meshAssetResource, memoryManager, frameAllocator));
     }
 
     TextRenderer::~TextRenderer() = default;
@@ -2,10 +2,14 @@
 #include "pluto/scene/components/component.impl.hpp"
 
 #include "pluto/scene/game_object.h"
+#include "pluto/scene/scene.h"
+#include "pluto/scene/transform_hierarchy.h"
 
 #include "pluto/memory/resource.h"
+#include "pluto/memory/pool_allocator.h"
+#include "pluto/service/service_collection.h"
 
-#include "pluto/guid.h"
+#include "pluto/runtime_id.h"
 #include "pluto/exception.h"
 
 #include "pluto/math/vector3f.h"
@@ -13,6 +17,8 @@
 #include "pluto/math/quaternion.h"
 #include "pluto/math/matrix4x4.h"
 
+#include <algorithm>
+
 namespace pluto
 {
     class Transform::Impl : public Component::Impl
@@ -20,30 +26,28 @@ namespace pluto
         Resource<Transform> parent;
         std::vector<Resource<Transform>> children;
 
-        Vector3F localPosition;
-        Quaternion localRotation;
-        Vector3F localScale;
-
-        bool isLocalMatrixDirty;
-        Matrix4X4 localMatrix;
-
-        bool isWorldMatrixDirty;
-        Matrix4X4 worldMatrix;
+        TransformHierarchy* hierarchy;
+        TransformHierarchy::NodeId node;
 
     public:
-        Impl(const Guid& guid, const Resource<GameObject>& gameObject)
-            : Component::Impl(guid, gameObject),
+        ~Impl()
+        {
+            hierarchy->DestroyNode(node);
+        }
+
+        Impl(const RuntimeId runtimeId, const Resource<GameObject>& gameObject, TransformHierarchy& hierarchy)
+            : Component::Impl(runtimeId, gameObject),
               parent(nullptr),
-              localPosition(Vector3F::ZERO),
-              localRotation(Quaternion::IDENTITY),
-              localScale(Vector3F::ONE),
-              isLocalMatrixDirty(true),
-              localMatrix(Matrix4X4::IDENTITY),
-              isWorldMatrixDirty(true),
-              worldMatrix(Matrix4X4::IDENTITY)
+              hierarchy(&hierarchy),
+              node(hierarchy.CreateNode())
         {
         }
 
+        Impl(const Impl& other) = delete;
+        Impl(Impl&& other) noexcept = delete;
+        Impl& operator=(const Impl& rhs) = delete;
+        Impl& operator=(Impl&& rhs) noexcept = delete;
+
         bool IsRoot() const
         {
             return parent == nullptr;
@@ -56,18 +60,18 @@ namespace pluto
 
         void SetParent(const Resource<Transform>& value)
         {
-            Resource<Transform> me = GetGameObject()->GetTransform();
-            if (value->impl->IsMyParent(me))
-            {
-                Exception::Throw(std::runtime_error("Can not set a transform parent if the same is it's child."));
-            }
+            // Throws before touching the children lists if the value is a child of this transform.
+            hierarchy->SetParent(node, value->impl->node);
 
+            Resource<Transform> me = GetGameObject()->GetTransform();
             if (parent != nullptr)
             {
                 parent->impl->RemoveChild(me);
             }
             value->impl->AddChild(me);
             parent = value;
+
+            GetGameObject()->OnParentChanged();
         }
 
         const std::vector<Resource<Transform>>& GetChildren() const
@@ -75,6 +79,14 @@ namespace pluto
             return children;
         }
 
+        void RemoveDestroyedChildren()
+        {
+            children.erase(std::remove_if(children.begin(), children.end(), [](const Resource<Transform>& child)
+            {
+                return child->GetGameObject()->IsDestroyed();
+            }), children.end());
+        }
+
         Resource<Transform> FindChild(const std::string& name) const
         {
             for (auto& child : children)
@@ -94,98 +106,93 @@ namespace pluto
 
         const Vector3F& GetLocalPosition() const
         {
-            return localPosition;
+            return hierarchy->GetLocalPosition(node);
         }
 
         void SetLocalPosition(const Vector3F& value)
         {
-            localPosition = value;
-            SetDirty();
+            hierarchy->SetLocalPosition(node, value);
         }
 
         const Quaternion& GetLocalRotation() const
         {
-            return localRotation;
+            return hierarchy->GetLocalRotation(node);
         }
 
-        void SetLocalRotation(const Quaternion value)
+        void SetLocalRotation(const Quaternion& value)
         {
-            localRotation = value;
-            SetDirty();
+            hierarchy->SetLocalRotation(node, value);
         }
 
         const Vector3F& GetLocalScale() const
         {
-            return localScale;
+            return hierarchy->GetLocalScale(node);
         }
 
-        void SetLocalScale(const Vector3F value)
+        void SetLocalScale(const Vector3F& value)
         {
-            localScale = value;
-            SetDirty();
+            hierarchy->SetLocalScale(node, value);
         }
 
         Vector3F GetPosition()
         {
             if (IsRoot())
             {
-                return localPosition;
+                return GetLocalPosition();
             }
 
-            return GetParent()->GetWorldMatrix().MultiplyPoint(localPosition);
+            return GetParentWorldMatrix().MultiplyPoint(GetLocalPosition());
         }
 
         void SetPosition(const Vector3F& value)
         {
             if (IsRoot())
             {
-                localPosition = value;
+                SetLocalPosition(value);
             }
             else
             {
-                localPosition = GetParent()->GetWorldMatrix().GetInverse().MultiplyPoint(value);
+                SetLocalPosition(GetParentWorldMatrix().GetInverse().MultiplyPoint(value));
             }
-            SetDirty();
         }
 
         Quaternion GetRotation()
         {
             if (IsRoot())
             {
-                return localRotation;
+                return GetLocalRotation();
             }
 
-            return GetParent()->GetRotation() * localRotation;
+            return GetParent()->GetRotation() * GetLocalRotation();
         }
 
         void SetRotation(const Quaternion& value)
         {
             if (IsRoot())
             {
-                localRotation = value;
+                SetLocalRotation(value);
             }
             else
             {
-                localRotation = GetParent()->GetRotation().GetInverse() * value;
+                SetLocalRotation(GetParent()->GetRotation().GetInverse() * value);
             }
-            SetDirty();
         }
 
         Vector3F GetScale()
         {
             if (IsRoot())
             {
-                return localScale;
+                return GetLocalScale();
             }
 
-            return Vector3F::Scale(GetParent()->GetScale(), localScale);
+            return Vector3F::Scale(GetParent()->GetScale(), GetLocalScale());
         }
 
         void SetScale(const Vector3F& value)
         {
             if (IsRoot())
             {
-                localScale = value;
+                SetLocalScale(value);
             }
             else
             {
@@ -193,9 +200,8 @@ namespace pluto
                 parentScale.x = 1 / parentScale.x;
                 parentScale.y = 1 / parentScale.y;
                 parentScale.z = 1 / parentScale.z;
-                localScale = Vector3F::Scale(parentScale, value);
+                SetLocalScale(Vector3F::Scale(parentScale, value));
             }
-            SetDirty();
         }
 
         Vector3F GetUp()
@@ -230,33 +236,18 @@ namespace pluto
 
         const Matrix4X4& GetLocalMatrix()
         {
-            if (isLocalMatrixDirty)
-            {
-                localMatrix = Matrix4X4::TSR(localPosition, localRotation, localScale);
-                isLocalMatrixDirty = false;
-            }
-
-            return localMatrix;
+            return hierarchy->GetLocalMatrix(node);
         }
 
         const Matrix4X4& GetWorldMatrix()
         {
-            if (isWorldMatrixDirty)
-            {
-                worldMatrix = IsRoot() ? GetLocalMatrix() : GetParent()->GetWorldMatrix() * GetLocalMatrix();
-                isWorldMatrixDirty = false;
-            }
-            return worldMatrix;
+            return hierarchy->GetWorldMatrix(node);
         }
 
-        bool IsMyParent(const Resource<Transform>& transform)
+    private:
+        const Matrix4X4& GetParentWorldMatrix()
         {
-            if (IsRoot())
-            {
-                return false;
-            }
-
-            return parent == transform || parent->impl->IsMyParent(transform);
+            return hierarchy->GetWorldMatrix(parent->impl->node);
         }
 
         void AddChild(const Resource<Transform>& child)
@@ -277,21 +268,6 @@ namespace pluto
                 ++it;
             }
         }
-
-        void SetDirty()
-        {
-            isLocalMatrixDirty = true;
-            SetWorldMatrixAsDirty();
-        }
-
-        void SetWorldMatrixAsDirty()
-        {
-            isWorldMatrixDirty = true;
-            for (auto& it : children)
-            {
-                it->impl->SetWorldMatrixAsDirty();
-            }
-        }
     };
 
     Transform::Factory::Factory(ServiceCollection& serviceCollection)
@@ -301,7 +277,15 @@ namespace pluto
 
     std::unique_ptr<Component> Transform::Factory::Create(const Resource<GameObject>& gameObject) const
     {
-        return std::make_unique<Transform>(std::make_unique<Impl>(Guid::New(), gameObject));
+        Scene* scene = gameObject->GetScene();
+        if (scene == nullptr)
+        {
+            Exception::Throw(std::runtime_error("Transform can only be added to game objects that belong to a scene."));
+        }
+
+        auto& poolAllocator = GetServiceCollection().GetService<PoolAllocator>();
+        return poolAllocator.New<Transform>(
+            poolAllocator.New<Impl>(RuntimeId::New(), gameObject, scene->GetTransformHierarchy()));
     }
 
     Transform::~Transform() = default;
@@ -336,6 +320,11 @@ namespace pluto
         return impl->GetChildren();
     }
 
+    void Transform::RemoveDestroyedChildren()
+    {
+        impl->RemoveDestroyedChildren();
+    }
+
     Resource<Transform> Transform::FindChild(const std::string& name) const
     {
         return impl->FindChild(name);
@@ -433,7 +422,7 @@ namespace pluto
 
     const Matrix4X4& Transform::GetLocalMatrix()
     {
-        return impl->GetWorldMatrix();
+        return impl->GetLocalMatrix();
     }
 
     const Matrix4X4& Transform::GetWorldMatrix()
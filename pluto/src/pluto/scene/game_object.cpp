@@ -1,12 +1,15 @@
 #include <pluto/scene/game_object.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/command_buffer.h>
 #include <pluto/scene/components/component.h>
 #include <pluto/scene/components/transform.h>
 
 #include <pluto/memory/resource.h>
 #include <pluto/memory/memory_manager.h>
+#include <pluto/memory/pool_allocator.h>
 
 #include <pluto/service/service_collection.h>
-#include <pluto/guid.h>
+#include <pluto/runtime_id.h>
 #include <pluto/exception.h>
 
 #include <typeindex>
@@ -14,28 +17,45 @@
 
 namespace pluto
 {
-    class GameObject::Impl
+    class GameObject::Impl : public PoolObject
     {
-        Guid guid;
+        RuntimeId runtimeId;
         std::string name;
         bool isActive;
+        bool isGloballyActive;
         Flags flags;
+        TagMask tags;
+        uint8_t layer;
 
         Resource<Transform> transform;
 
+        // Parallel arrays, typed lookups only compare the type ids and never cast the components.
         std::vector<Resource<Component>> components;
+        std::vector<size_t> componentTypes;
+        std::vector<Component::PhaseMask> componentPhases;
         bool isDestroyed;
 
+        uint32_t pool;
+        bool isDespawned;
+
+        Scene* scene;
+
         MemoryManager* memoryManager;
         ServiceCollection* serviceCollection;
 
     public:
-        Impl(const Guid& guid, MemoryManager& memoryManager, ServiceCollection& serviceCollection)
-            : guid(guid),
+        Impl(const RuntimeId runtimeId, MemoryManager& memoryManager, ServiceCollection& serviceCollection)
+            : runtimeId(runtimeId),
               isActive(true),
+              isGloballyActive(true),
               flags(Flags::None),
+              tags(0),
+              layer(0),
               transform(nullptr),
               isDestroyed(false),
+              pool(NO_POOL),
+              isDespawned(false),
+              scene(nullptr),
               memoryManager(&memoryManager),
               serviceCollection(&serviceCollection)
         {
@@ -49,9 +69,9 @@ namespace pluto
             }
         }
 
-        const Guid& GetId() const
+        RuntimeId GetRuntimeId() const
         {
-            return guid;
+            return runtimeId;
         }
 
         const std::string& GetName() const
@@ -59,19 +79,22 @@ namespace pluto
             return name;
         }
 
-        void SetName(const std::string& value)
+        void SetName(GameObject& gameObject, const std::string& value)
         {
+            if (scene == nullptr)
+            {
+                name = value;
+                return;
+            }
+
+            const std::string previousName = std::move(name);
             name = value;
+            scene->OnGameObjectRenamed(gameObject, previousName);
         }
 
         bool IsGloballyActive() const
         {
-            if (transform->IsRoot())
-            {
-                return isActive;
-            }
-
-            return isActive && transform->GetParent()->GetGameObject()->IsGloballyActive();
+            return isGloballyActive;
         }
 
         bool IsActive() const
@@ -81,7 +104,13 @@ namespace pluto
 
         void SetActive(const bool value)
         {
+            if (isActive == value)
+            {
+                return;
+            }
+
             isActive = value;
+            UpdateGloballyActive();
         }
 
         Flags GetFlags() const
@@ -94,18 +123,79 @@ namespace pluto
             return isDestroyed;
         }
 
+        TagMask GetTags() const
+        {
+            return tags;
+        }
+
+        void SetTags(GameObject& gameObject, const TagMask value)
+        {
+            const TagMask previousTags = tags;
+            tags = value;
+            if (scene != nullptr && previousTags != value)
+            {
+                scene->OnGameObjectTagsChanged(gameObject, previousTags);
+            }
+        }
+
+        uint8_t GetLayer() const
+        {
+            return layer;
+        }
+
+        void SetLayer(GameObject& gameObject, const uint8_t value)
+        {
+            if (value >= LAYER_COUNT)
+            {
+                Exception::Throw(std::runtime_error("Game object layer must be lower than the layer count."));
+            }
+
+            const uint8_t previousLayer = layer;
+            layer = value;
+            if (scene != nullptr && previousLayer != value)
+            {
+                scene->OnGameObjectLayerChanged(gameObject, previousLayer);
+            }
+        }
+
         Resource<Transform> GetTransform() const
         {
             return transform;
         }
 
-        Resource<Component> AddComponent(const std::type_info& type)
+        Scene* GetScene() const
         {
+            return scene;
+        }
+
+        void SetScene(GameObject& gameObject, Scene& value)
+        {
+            const bool wasDetached = scene == nullptr;
+            scene = &value;
+            if (!wasDetached)
+            {
+                return;
+            }
+
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                scene->RegisterComponent(components[i], gameObject, componentTypes[i], componentPhases[i]);
+            }
+        }
+
+        Resource<Component> AddComponent(const GameObject& owner, const std::type_info& type,
+                                         const Component::PhaseMask phases)
+        {
+            if (scene != nullptr && scene->IsRunningParallelPhase())
+            {
+                Exception::Throw(std::runtime_error(
+                    "Can not add a component during a parallel phase, use the scene command buffer."));
+            }
+
             const Component::Factory& factory = dynamic_cast<Component::Factory&>(serviceCollection->GetFactory(type));
 
             // TODO: FIX ME - GameObject does not exists when trying to add transform.
-            const Resource<GameObject> gameObject = ResourceUtils::Cast<GameObject>(
-                memoryManager->Get(guid));
+            Resource<GameObject> gameObject = ResourceUtils::Cast<GameObject>(memoryManager->Get(owner.GetHandle()));
 
             Resource<Component> component = ResourceUtils::Cast<Component>(
                 memoryManager->Add(factory.Create(gameObject)));
@@ -115,7 +205,19 @@ namespace pluto
                 transform = ResourceUtils::Cast<Transform>(component);
             }
 
+            const size_t typeId = Component::GetTypeId(type);
             components.push_back(component);
+            componentTypes.push_back(typeId);
+            componentPhases.push_back(phases);
+            if (scene != nullptr)
+            {
+                scene->RegisterComponent(component, *gameObject.Get(), typeId, phases);
+            }
+
+            if (isGloballyActive && !isDestroyed)
+            {
+                component->OnEnable();
+            }
             return component;
         }
 
@@ -131,6 +233,18 @@ namespace pluto
             return nullptr;
         }
 
+        Resource<Component> GetComponent(const size_t typeId, const Component::TypeTest test) const
+        {
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                if (Component::IsTypeOf(componentTypes[i], typeId, *components[i].Get(), test))
+                {
+                    return components[i];
+                }
+            }
+            return nullptr;
+        }
+
         std::vector<Resource<Component>> GetComponents(
             const std::function<bool(const Component& component)>& predicate) const
         {
@@ -145,6 +259,18 @@ namespace pluto
             return result;
         }
 
+        void ForEachComponent(const size_t typeId, const Component::TypeTest test,
+                              const std::function<void(const Resource<Component>& component)>& callback) const
+        {
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                if (Component::IsTypeOf(componentTypes[i], typeId, *components[i].Get(), test))
+                {
+                    callback(components[i]);
+                }
+            }
+        }
+
         Resource<Component> GetComponentInChildren(
             const std::function<bool(const Component& component)>& predicate) const
         {
@@ -153,61 +279,142 @@ namespace pluto
                 return nullptr;
             }
 
-            Resource<Component> result = GetComponent(predicate);
-            if (result != nullptr)
+            return FindActiveComponent([&predicate](const Impl& impl) -> Resource<Component>
             {
-                return result;
-            }
+                return impl.GetComponent(predicate);
+            });
+        }
 
-            for (auto& it : GetTransform()->GetChildren())
+        Resource<Component> GetComponentInChildren(const size_t typeId, const Component::TypeTest test) const
+        {
+            if (!IsGloballyActive())
             {
-                result = it->GetGameObject()->GetComponentInChildren(predicate);
-                if (result != nullptr)
-                {
-                    return result;
-                }
+                return nullptr;
             }
-            return nullptr;
+
+            return FindActiveComponent([typeId, test](const Impl& impl) -> Resource<Component>
+            {
+                return impl.GetComponent(typeId, test);
+            });
         }
 
         std::vector<Resource<Component>> GetComponentsInChildren(
             const std::function<bool(const Component& component)>& predicate) const
         {
             std::vector<Resource<Component>> result;
-            if (!IsGloballyActive())
+            ForEachComponentInChildren([&](const Resource<Component>& component)
             {
-                return result;
+                if (predicate(*component.Get()))
+                {
+                    result.push_back(component);
+                }
+            });
+            return result;
+        }
+
+        void ForEachComponentInChildren(const std::function<void(const Resource<Component>& component)>& callback) const
+        {
+            if (IsGloballyActive())
+            {
+                ForEachActiveComponent([&callback](const Resource<Component>& component, size_t)
+                {
+                    callback(component);
+                });
             }
+        }
 
-            result = GetComponents(predicate);
-            for (auto it : GetTransform()->GetChildren())
+        void ForEachComponentInChildren(
+            const size_t typeId, const Component::TypeTest test,
+            const std::function<void(const Resource<Component>& component)>& callback) const
+        {
+            if (IsGloballyActive())
             {
-                auto componentsFromChild = it->GetGameObject()->GetComponentsInChildren(predicate);
-                result.insert(result.end(), componentsFromChild.begin(), componentsFromChild.end());
+                ForEachActiveComponent([typeId, test, &callback](const Resource<Component>& component,
+                                                                 const size_t componentType)
+                {
+                    if (Component::IsTypeOf(componentType, typeId, *component.Get(), test))
+                    {
+                        callback(component);
+                    }
+                });
             }
-            return result;
         }
 
-        void Destroy()
+        void Destroy(const GameObject& owner)
         {
             if (isDestroyed)
             {
                 return;
             }
 
-            isDestroyed = true;
-
-            for (auto& component : components)
+            // Deferred until the parallel phase is over, the other jobs may still be reading the game object.
+            if (scene != nullptr && scene->IsRunningParallelPhase())
             {
-                component->OnDestroy();
+                const Resource<Object> gameObject = memoryManager->Get(owner.GetHandle());
+                scene->GetCommandBuffer().Destroy(ResourceUtils::Cast<GameObject>(gameObject));
+                return;
             }
 
-            for (auto& it : transform->GetChildren())
+            VisitHierarchy([](Impl& impl)
+            {
+                if (impl.isDestroyed)
+                {
+                    return false;
+                }
+
+                impl.isDestroyed = true;
+                for (auto& component : impl.components)
+                {
+                    if (impl.isGloballyActive)
+                    {
+                        component->OnDisable();
+                    }
+                    component->OnDestroy();
+                }
+                return true;
+            });
+        }
+
+        void OnParentChanged()
+        {
+            UpdateGloballyActive();
+
+            // Pool roots own their state, anything else is parked or spawned along with its parent.
+            if (pool == NO_POOL)
             {
-                it->GetGameObject()->Destroy();
+                SetDespawned(!transform->IsRoot() && transform->GetParent()->GetGameObject()->IsDespawned());
             }
         }
 
+        uint32_t GetPool() const
+        {
+            return pool;
+        }
+
+        bool IsDespawned() const
+        {
+            return isDespawned;
+        }
+
+        void OnSpawn(const uint32_t value)
+        {
+            pool = value;
+            SetDespawned(false);
+            NotifyHierarchy(&Component::OnSpawn);
+        }
+
+        void OnDespawn()
+        {
+            SetDespawned(true);
+            NotifyHierarchy(&Component::OnDespawn);
+        }
+
+        void OnPooled(const uint32_t value)
+        {
+            pool = value;
+            SetDespawned(true);
+        }
+
         void OnEarlyFixedUpdate()
         {
             EvaluateComponents(&Component::OnEarlyFixedUpdate);
@@ -274,6 +481,149 @@ namespace pluto
         }
 
     private:
+        bool IsParentGloballyActive() const
+        {
+            return transform->IsRoot() || transform->GetParent()->GetGameObject()->IsGloballyActive();
+        }
+
+        void UpdateGloballyActive()
+        {
+            VisitHierarchy([](Impl& impl)
+            {
+                // Descendants are only visited while their state changes, an inactive child keeps its subtree as is.
+                const bool value = impl.isActive && impl.IsParentGloballyActive();
+                if (impl.isGloballyActive == value)
+                {
+                    return false;
+                }
+
+                impl.isGloballyActive = value;
+                if (!impl.isDestroyed)
+                {
+                    for (size_t i = 0; i < impl.components.size(); ++i)
+                    {
+                        Component* component = impl.components[i].Get();
+                        if (value)
+                        {
+                            component->OnEnable();
+                        }
+                        else
+                        {
+                            component->OnDisable();
+                        }
+                    }
+                }
+                return true;
+            });
+        }
+
+        /*
+         * The whole hierarchy waits in the pool with its root, so the scene lookups can skip every part of it.
+         */
+        void SetDespawned(const bool value)
+        {
+            VisitHierarchy([value](Impl& impl)
+            {
+                if (impl.isDespawned == value)
+                {
+                    return false;
+                }
+
+                impl.isDespawned = value;
+                return true;
+            });
+        }
+
+        void NotifyHierarchy(void (Component::*hook)())
+        {
+            VisitHierarchy([hook](Impl& impl)
+            {
+                for (size_t i = 0; i < impl.components.size(); ++i)
+                {
+                    (impl.components[i].Get()->*hook)();
+                }
+                return true;
+            });
+        }
+
+        /*
+         * Visits the game object and then its descendants, parents before their children. The subtree of a game object
+         * is skipped when visit returns false. Walked with an explicit stack, so deep hierarchies do not overflow.
+         */
+        template <typename Visit>
+        void VisitHierarchy(const Visit& visit)
+        {
+            if (!visit(*this) || transform->GetChildren().empty())
+            {
+                return;
+            }
+
+            std::vector<Impl*> stack;
+            PushChildren(*this, stack);
+            while (!stack.empty())
+            {
+                Impl& impl = *stack.back();
+                stack.pop_back();
+                if (visit(impl))
+                {
+                    PushChildren(impl, stack);
+                }
+            }
+        }
+
+        static void PushChildren(const Impl& impl, std::vector<Impl*>& stack)
+        {
+            // Pushed in reverse, so the children are visited in order.
+            const auto& children = impl.transform->GetChildren();
+            for (size_t i = children.size(); i > 0; --i)
+            {
+                stack.push_back(children[i - 1]->GetGameObject()->impl.get());
+            }
+        }
+
+        template <typename Find>
+        Resource<Component> FindActiveComponent(const Find& find) const
+        {
+            Resource<Component> result = find(*this);
+            if (result != nullptr)
+            {
+                return result;
+            }
+
+            for (const auto& child : transform->GetChildren())
+            {
+                const Impl& childImpl = *child->GetGameObject()->impl;
+                if (childImpl.isActive)
+                {
+                    result = childImpl.FindActiveComponent(find);
+                    if (result != nullptr)
+                    {
+                        return result;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        template <typename Callback>
+        void ForEachActiveComponent(const Callback& callback) const
+        {
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                callback(components[i], componentTypes[i]);
+            }
+
+            // The parent is known to be active here, so only the local state of the children matters.
+            for (const auto& child : transform->GetChildren())
+            {
+                const Impl& childImpl = *child->GetGameObject()->impl;
+                if (childImpl.isActive)
+                {
+                    childImpl.ForEachActiveComponent(callback);
+                }
+            }
+        }
+
         template <typename ... Args>
         using ComponentFunction = void(Component::*)(Args ...);
 
@@ -302,15 +652,17 @@ namespace pluto
     {
         ServiceCollection& serviceCollection = GetServiceCollection();
         auto& memoryManager = serviceCollection.GetService<MemoryManager>();
-        auto gameObject = std::make_unique<GameObject>(
-            std::make_unique<Impl>(Guid::New(), memoryManager, serviceCollection));
+        auto& poolAllocator = serviceCollection.GetService<PoolAllocator>();
+        auto gameObject = poolAllocator.New<GameObject>(
+            poolAllocator.New<Impl>(RuntimeId::New(), memoryManager, serviceCollection));
         return gameObject;
     }
 
     GameObject::~GameObject() = default;
 
     GameObject::GameObject(std::unique_ptr<Impl> impl)
-        : impl(std::move(impl))
+        : Object(impl->GetRuntimeId()),
+          impl(std::move(impl))
     {
     }
 
@@ -318,11 +670,6 @@ namespace pluto
 
     GameObject& GameObject::operator=(GameObject&& rhs) noexcept = default;
 
-    const Guid& GameObject::GetId() const
-    {
-        return impl->GetId();
-    }
-
     const std::string& GameObject::GetName() const
     {
         return impl->GetName();
@@ -330,7 +677,12 @@ namespace pluto
 
     void GameObject::SetName(const std::string& value)
     {
-        impl->SetName(value);
+        impl->SetName(*this, value);
+    }
+
+    size_t GameObject::GetImplAllocationSize() const
+    {
+        return PoolAllocator::GetAllocationSize(impl.get());
     }
 
     bool GameObject::IsGloballyActive() const
@@ -358,14 +710,64 @@ namespace pluto
         return impl->IsDestroyed();
     }
 
+    GameObject::TagMask GameObject::GetTags() const
+    {
+        return impl->GetTags();
+    }
+
+    bool GameObject::HasTags(const TagMask tags) const
+    {
+        return (impl->GetTags() & tags) == tags;
+    }
+
+    void GameObject::SetTags(const TagMask value)
+    {
+        impl->SetTags(*this, value);
+    }
+
+    uint8_t GameObject::GetLayer() const
+    {
+        return impl->GetLayer();
+    }
+
+    void GameObject::SetLayer(const uint8_t value)
+    {
+        impl->SetLayer(*this, value);
+    }
+
     Resource<Transform> GameObject::GetTransform() const
     {
         return impl->GetTransform();
     }
 
+    Scene* GameObject::GetScene() const
+    {
+        return impl->GetScene();
+    }
+
+    uint32_t GameObject::GetPool() const
+    {
+        return impl->GetPool();
+    }
+
+    bool GameObject::IsDespawned() const
+    {
+        return impl->IsDespawned();
+    }
+
+    void GameObject::SetScene(Scene& scene)
+    {
+        impl->SetScene(*this, scene);
+    }
+
     Resource<Component> GameObject::AddComponent(const std::type_info& type)
     {
-        return impl->AddComponent(type);
+        return impl->AddComponent(*this, type, Component::ALL_PHASES);
+    }
+
+    Resource<Component> GameObject::AddComponent(const std::type_info& type, const Component::PhaseMask phases)
+    {
+        return impl->AddComponent(*this, type, phases);
     }
 
     Resource<Component> GameObject::GetComponent(const std::function<bool(const Component& component)>& predicate) const
@@ -373,27 +775,76 @@ namespace pluto
         return impl->GetComponent(predicate);
     }
 
+    Resource<Component> GameObject::GetComponent(const size_t typeId, const Component::TypeTest test) const
+    {
+        return impl->GetComponent(typeId, test);
+    }
+
     std::vector<Resource<Component>> GameObject::GetComponents(
         const std::function<bool(const Component& component)>& predicate) const
     {
         return impl->GetComponents(predicate);
     }
 
+    void GameObject::ForEachComponent(const size_t typeId, const Component::TypeTest test,
+                                      const std::function<void(const Resource<Component>& component)>& callback) const
+    {
+        impl->ForEachComponent(typeId, test, callback);
+    }
+
     Resource<Component> GameObject::GetComponentInChildren(
         const std::function<bool(const Component& component)>& predicate) const
     {
         return impl->GetComponentInChildren(predicate);
     }
 
+    Resource<Component> GameObject::GetComponentInChildren(const size_t typeId, const Component::TypeTest test) const
+    {
+        return impl->GetComponentInChildren(typeId, test);
+    }
+
     std::vector<Resource<Component>> GameObject::GetComponentsInChildren(
         const std::function<bool(const Component& component)>& predicate) const
     {
         return impl->GetComponentsInChildren(predicate);
     }
 
+    void GameObject::ForEachComponentInChildren(
+        const std::function<void(const Resource<Component>& component)>& callback) const
+    {
+        impl->ForEachComponentInChildren(callback);
+    }
+
+    void GameObject::ForEachComponentInChildren(
+        const size_t typeId, const Component::TypeTest test,
+        const std::function<void(const Resource<Component>& component)>& callback) const
+    {
+        impl->ForEachComponentInChildren(typeId, test, callback);
+    }
+
     void GameObject::Destroy()
     {
-        impl->Destroy();
+        impl->Destroy(*this);
+    }
+
+    void GameObject::OnParentChanged()
+    {
+        impl->OnParentChanged();
+    }
+
+    void GameObject::OnSpawn(const uint32_t pool)
+    {
+        impl->OnSpawn(pool);
+    }
+
+    void GameObject::OnDespawn()
+    {
+        impl->OnDespawn();
+    }
+
+    void GameObject::OnPooled(const uint32_t pool)
+    {
+        impl->OnPooled(pool);
     }
 
     void GameObject::OnEarlyFixedUpdate()
@@ -1,41 +1,119 @@
 #include <pluto/scene/scene.h>
 #include <pluto/scene/game_object.h>
+#include <pluto/scene/command_buffer.h>
+#include <pluto/scene/component_array.h>
+#include <pluto/scene/system.h>
+#include <pluto/scene/transform_hierarchy.h>
 #include <pluto/scene/components/transform.h>
+#include <pluto/scene/components/behaviour.h>
 
-#include <pluto/guid.h>
+#include <pluto/asset/prefab_asset.h>
+#include <pluto/asset/scene_asset.h>
+
+#include <pluto/runtime_id.h>
+#include <pluto/exception.h>
 
 #include <pluto/service/service_collection.h>
 #include <pluto/event/event_manager.h>
 #include <pluto/memory/memory_manager.h>
+#include <pluto/job/job_system.h>
 
+#include <algorithm>
+#include <array>
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 namespace pluto
 {
     class Scene::Impl
     {
-        Guid guid;
+        static constexpr size_t PARALLEL_UPDATE_CHUNK_SIZE = 64;
+
+        struct PhaseEntry final
+        {
+            Component* component;
+            GameObject* gameObject;
+        };
+
+        struct Pool final
+        {
+            PoolFunction create;
+            std::vector<Resource<GameObject>> available;
+        };
+
+        RuntimeId runtimeId;
         Resource<GameObject> root;
         std::list<GameObject*> gameObjects;
+        TransformHierarchy transformHierarchy;
+
+        // Indexed by component type id.
+        std::vector<std::unique_ptr<BaseComponentArray>> componentArrays;
+        std::vector<std::unique_ptr<System>> systems;
 
+        // Lookup indices of every game object but the root. Removing a game object from a bucket moves the last one
+        // into its place, so buckets do not keep the order the game objects were added in.
+        std::unordered_map<std::string, std::vector<Resource<GameObject>>> nameIndex;
+        std::array<std::vector<Resource<GameObject>>, GameObject::TAG_COUNT> tagIndex;
+        std::array<std::vector<Resource<GameObject>>, GameObject::LAYER_COUNT> layerIndex;
+
+        // Position of each game object in the buckets it is in, so it is removed without searching them.
+        std::unordered_map<ObjectHandle, uint32_t> namePositions;
+        std::unordered_map<ObjectHandle, uint32_t> layerPositions;
+        std::array<std::unordered_map<ObjectHandle, uint32_t>, GameObject::TAG_COUNT> tagPositions;
+
+        std::vector<Pool> pools;
+
+        // Indexed by the exact component type id.
+        std::vector<std::vector<Resource<Component>>> componentsByType;
+        std::vector<Resource<Component>> noComponents;
+
+        // Only the components that override the hook of a phase are in its list.
+        std::array<std::vector<PhaseEntry>, Component::PHASE_COUNT> phaseEntries;
+
+        // Parallel safe behaviours are updated by the job system instead of being in the update phase list.
+        std::vector<PhaseEntry> parallelUpdateEntries;
+        bool isRunningParallelPhase;
+        CommandBuffer commandBuffer;
+
+        Scene* owner;
         MemoryManager* memoryManager;
+        JobSystem* jobSystem;
         GameObject::Factory* gameObjectFactory;
 
     public:
-        Impl(const Guid& guid, MemoryManager& memoryManager, GameObject::Factory& gameObjectFactory)
-            : guid(guid),
+        Impl(const RuntimeId runtimeId, MemoryManager& memoryManager, JobSystem& jobSystem,
+             GameObject::Factory& gameObjectFactory)
+            : runtimeId(runtimeId),
+              isRunningParallelPhase(false),
+              owner(nullptr),
               memoryManager(&memoryManager),
+              jobSystem(&jobSystem),
               gameObjectFactory(&gameObjectFactory)
         {
-            root = ResourceUtils::Cast<GameObject>(memoryManager.Add(gameObjectFactory.Create()));
-            root->SetName("root");
-            root->AddComponent<Transform>();
-            gameObjects.push_back(root.Get());
         }
 
-        const Guid& GetId() const
+        void SetOwner(Scene& scene)
         {
-            return guid;
+            owner = &scene;
+            for (auto& gameObject : gameObjects)
+            {
+                gameObject->SetScene(scene);
+            }
+
+            if (root == nullptr)
+            {
+                root = ResourceUtils::Cast<GameObject>(memoryManager->Add(gameObjectFactory->Create()));
+                root->SetName("root");
+                root->SetScene(scene);
+                root->AddComponent<Transform>();
+                gameObjects.push_back(root.Get());
+            }
+        }
+
+        RuntimeId GetId() const
+        {
+            return runtimeId;
         }
 
         Resource<GameObject> GetRootGameObject() const
@@ -45,113 +123,561 @@ namespace pluto
 
         Resource<GameObject> CreateGameObject(const Resource<Transform>& parent, const std::string& name)
         {
+            if (isRunningParallelPhase)
+            {
+                Exception::Throw(std::runtime_error(
+                    "Can not create a game object during a parallel phase, use the scene command buffer."));
+            }
+
             Resource<GameObject> gameObjectResource = ResourceUtils::Cast<GameObject>(
                 memoryManager->Add(gameObjectFactory->Create()));
 
+            // Named before it has a scene, so it goes straight into its final bucket.
             GameObject* gameObject = gameObjectResource.Get();
+            gameObject->SetName(name);
+            gameObject->SetScene(*owner);
+            AddToIndices(gameObjectResource);
+
             gameObject->AddComponent<Transform>();
             gameObjects.push_back(gameObject);
 
-            gameObject->SetName(name);
             gameObject->GetTransform()->SetParent(parent);
             return gameObjectResource;
         }
 
+        void Instantiate(const PrefabAsset& prefab, const size_t count, const Resource<Transform>& parent,
+                         std::vector<Resource<GameObject>>& result)
+        {
+            if (isRunningParallelPhase)
+            {
+                Exception::Throw(std::runtime_error(
+                    "Can not instantiate a prefab during a parallel phase, use the scene command buffer."));
+            }
+
+            const std::vector<PrefabAsset::Node>& nodes = prefab.GetNodes();
+            if (nodes.empty() || count == 0)
+            {
+                return;
+            }
+
+            // Component names are resolved once for all the copies.
+            std::vector<std::vector<const Component::RegisteredType*>> nodeComponents(nodes.size());
+            size_t componentsCount = 0;
+            for (size_t i = 0; i < nodes.size(); ++i)
+            {
+                for (const auto& name : nodes[i].components)
+                {
+                    nodeComponents[i].push_back(&FindComponentType(name));
+                }
+                componentsCount += nodes[i].components.size();
+            }
+
+            result.reserve(result.size() + count);
+            const std::vector<Resource<Object>> resources = CreateGameObjects(count * nodes.size(),
+                                                                              count * componentsCount);
+
+            for (size_t copy = 0; copy < count; ++copy)
+            {
+                const size_t first = copy * nodes.size();
+                for (size_t i = 0; i < nodes.size(); ++i)
+                {
+                    const PrefabAsset::Node& node = nodes[i];
+                    Resource<GameObject> gameObject = ResourceUtils::Cast<GameObject>(resources[first + i]);
+
+                    Resource<Transform> parentTransform = parent;
+                    if (node.parent == PrefabAsset::NO_PARENT)
+                    {
+                        result.push_back(gameObject);
+                    }
+                    else
+                    {
+                        parentTransform = ResourceUtils::Cast<GameObject>(resources[first + node.parent])->
+                            GetTransform();
+                    }
+
+                    SetUpGameObject(gameObject, node.name, node.tags, node.layer, node.isActive, parentTransform,
+                                    node.localPosition, node.localRotation, node.localScale);
+
+                    for (const Component::RegisteredType* type : nodeComponents[i])
+                    {
+                        gameObject->AddComponent(*type->type, type->phases);
+                    }
+                }
+            }
+        }
+
+        void LoadGameObjects(const SceneAsset& sceneAsset, const size_t count,
+                             std::vector<Resource<GameObject>>& loadedGameObjects)
+        {
+            if (isRunningParallelPhase)
+            {
+                Exception::Throw(std::runtime_error(
+                    "Can not load game objects during a parallel phase, use the scene command buffer."));
+            }
+
+            const size_t begin = loadedGameObjects.size();
+            const size_t end = std::min(begin + count, sceneAsset.GetGameObjectCount());
+            if (begin >= end)
+            {
+                return;
+            }
+
+            std::vector<const Component::RegisteredType*> componentTypes;
+            componentTypes.reserve(sceneAsset.GetComponentTypeNames().size());
+            for (const auto& name : sceneAsset.GetComponentTypeNames())
+            {
+                componentTypes.push_back(&FindComponentType(name));
+            }
+
+            // Components are sorted by game object, so the ones of this batch are a contiguous range.
+            const std::vector<uint32_t>& componentGameObjects = sceneAsset.GetComponentGameObjects();
+            const std::vector<uint16_t>& componentIndices = sceneAsset.GetComponentTypes();
+            auto component = std::lower_bound(componentGameObjects.begin(), componentGameObjects.end(), begin);
+            const auto componentsEnd = std::lower_bound(component, componentGameObjects.end(), end);
+
+            loadedGameObjects.reserve(sceneAsset.GetGameObjectCount());
+            const std::vector<Resource<Object>> resources = CreateGameObjects(end - begin, componentsEnd - component);
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                Resource<GameObject> gameObject = ResourceUtils::Cast<GameObject>(resources[i - begin]);
+
+                // The parent may have been destroyed since the previous batch, then its children go with it.
+                const uint32_t parent = sceneAsset.GetParents()[i];
+                Resource<GameObject> parentGameObject = parent == SceneAsset::NO_PARENT
+                                                            ? root
+                                                            : loadedGameObjects[parent];
+                const bool isOrphan = parentGameObject == nullptr || parentGameObject->IsDestroyed();
+
+                SetUpGameObject(gameObject, sceneAsset.GetNames()[i], sceneAsset.GetTags()[i],
+                                sceneAsset.GetLayers()[i], sceneAsset.GetActiveStates()[i] != 0,
+                                isOrphan ? root->GetTransform() : parentGameObject->GetTransform(),
+                                sceneAsset.GetLocalPositions()[i], sceneAsset.GetLocalRotations()[i],
+                                sceneAsset.GetLocalScales()[i]);
+                loadedGameObjects.push_back(gameObject);
+
+                if (isOrphan)
+                {
+                    gameObject->Destroy();
+                }
+
+                for (; component != componentsEnd && *component == i; ++component)
+                {
+                    if (!isOrphan)
+                    {
+                        const size_t index = component - componentGameObjects.begin();
+                        const Component::RegisteredType& type = *componentTypes[componentIndices[index]];
+                        gameObject->AddComponent(*type.type, type.phases);
+                    }
+                }
+            }
+        }
+
         Resource<GameObject> FindGameObject(const std::string& name) const
         {
-            Resource<Transform> obj = root->GetTransform()->FindChild(name);
-            if (obj != nullptr)
+            const auto it = nameIndex.find(name);
+            if (it == nameIndex.end())
             {
-                return obj->GetGameObject();
+                return nullptr;
+            }
+
+            for (const auto& gameObject : it->second)
+            {
+                if (IsFindable(*gameObject.Get()))
+                {
+                    return gameObject;
+                }
             }
             return nullptr;
         }
 
-        void Destroy()
+        void FindGameObjects(const std::string& name, std::vector<Resource<GameObject>>& result) const
         {
-            gameObjects.front()->Destroy();
+            const auto it = nameIndex.find(name);
+            if (it != nameIndex.end())
+            {
+                AppendFindable(it->second, result);
+            }
         }
 
-        void OnEarlyFixedUpdate()
+        void FindGameObjectsWithTags(const GameObject::TagMask tags, std::vector<Resource<GameObject>>& result) const
         {
-            for (auto& gameObject : gameObjects)
+            if (tags == 0)
+            {
+                return;
+            }
+
+            // Every match is in the bucket of any of the tags, the one of the lowest tag is filtered.
+            size_t tag = 0;
+            while ((tags & (1u << tag)) == 0)
             {
-                gameObject->OnEarlyFixedUpdate();
+                ++tag;
+            }
+
+            for (const auto& gameObject : tagIndex[tag])
+            {
+                if (IsFindable(*gameObject.Get()) && gameObject->HasTags(tags))
+                {
+                    result.push_back(gameObject);
+                }
             }
         }
 
-        void OnFixedUpdate()
+        void FindGameObjectsInLayers(const GameObject::LayerMask layers,
+                                     std::vector<Resource<GameObject>>& result) const
         {
-            for (auto& gameObject : gameObjects)
+            for (size_t layer = 0; layer < GameObject::LAYER_COUNT; ++layer)
             {
-                gameObject->OnFixedUpdate();
+                if ((layers & (1u << layer)) != 0)
+                {
+                    AppendFindable(layerIndex[layer], result);
+                }
             }
         }
 
-        void OnLateFixedUpdate()
+        void OnGameObjectRenamed(GameObject& gameObject, const std::string& previousName)
         {
-            for (auto& gameObject : gameObjects)
+            if (&gameObject == root.Get())
             {
-                gameObject->OnLateFixedUpdate();
+                return;
             }
+
+            RemoveFromNameBucket(previousName, gameObject);
+            AddToBucket(nameIndex[gameObject.GetName()], GetResource(gameObject), namePositions);
         }
 
-        void OnEarlyUpdate()
+        void OnGameObjectTagsChanged(GameObject& gameObject, const GameObject::TagMask previousTags)
         {
-            for (auto& gameObject : gameObjects)
+            if (&gameObject == root.Get())
+            {
+                return;
+            }
+
+            const GameObject::TagMask tags = gameObject.GetTags();
+            const Resource<GameObject> resource = GetResource(gameObject);
+            for (size_t tag = 0; tag < GameObject::TAG_COUNT; ++tag)
+            {
+                const GameObject::TagMask bit = 1u << tag;
+                if ((previousTags & bit) != 0 && (tags & bit) == 0)
+                {
+                    RemoveFromTagBucket(tag, gameObject);
+                }
+                else if ((previousTags & bit) == 0 && (tags & bit) != 0)
+                {
+                    AddToBucket(tagIndex[tag], resource, tagPositions[tag]);
+                }
+            }
+        }
+
+        void OnGameObjectLayerChanged(GameObject& gameObject, const uint8_t previousLayer)
+        {
+            if (&gameObject == root.Get())
             {
-                gameObject->OnEarlyUpdate();
+                return;
             }
+
+            RemoveFromBucket(layerIndex[previousLayer], gameObject, layerPositions);
+            AddToBucket(layerIndex[gameObject.GetLayer()], GetResource(gameObject), layerPositions);
         }
 
-        void OnUpdate()
+        void Destroy()
         {
-            for (auto& gameObject : gameObjects)
+            gameObjects.front()->Destroy();
+        }
+
+        uint32_t CreatePool(PoolFunction create, const size_t capacity)
+        {
+            const uint32_t pool = static_cast<uint32_t>(pools.size());
+            pools.push_back({std::move(create), {}});
+            pools.back().available.reserve(capacity);
+
+            // Never spawned, so the components are not told they are despawned.
+            for (size_t i = 0; i < capacity; ++i)
             {
-                gameObject->OnUpdate();
+                Resource<GameObject> gameObject = Instantiate(pool);
+                gameObject->OnPooled(pool);
+                Park(gameObject, pool);
             }
+            return pool;
         }
 
-        void OnLateUpdate()
+        Resource<GameObject> Spawn(const uint32_t pool, const Resource<Transform>& parent)
         {
-            for (auto& gameObject : gameObjects)
+            if (isRunningParallelPhase)
+            {
+                Exception::Throw(std::runtime_error(
+                    "Can not spawn a game object during a parallel phase, use the scene command buffer."));
+            }
+
+            if (pool >= pools.size())
+            {
+                Exception::Throw(std::runtime_error("Pool does not exist in the scene."));
+            }
+
+            // Despawned game objects may have been destroyed along with the scene, they are dropped on cleanup.
+            Resource<GameObject> gameObject = nullptr;
+            auto& available = pools[pool].available;
+            while (gameObject == nullptr && !available.empty())
+            {
+                if (!available.back()->IsDestroyed())
+                {
+                    gameObject = available.back();
+                }
+                available.pop_back();
+            }
+
+            if (gameObject == nullptr)
+            {
+                gameObject = Instantiate(pool);
+            }
+
+            const Resource<Transform> transform = gameObject->GetTransform();
+            if (transform->GetParent() != parent)
             {
-                gameObject->OnLateUpdate();
+                transform->SetParent(parent);
             }
+
+            gameObject->SetActive(true);
+            gameObject->OnSpawn(pool);
+            return gameObject;
         }
 
-        void OnPreRender()
+        void Despawn(Resource<GameObject> gameObject)
         {
-            for (auto& gameObject : gameObjects)
+            const uint32_t pool = gameObject->GetPool();
+            if (pool == GameObject::NO_POOL)
             {
-                gameObject->OnPreRender();
+                gameObject->Destroy();
+                return;
+            }
+
+            if (gameObject->IsDespawned() || gameObject->IsDestroyed())
+            {
+                return;
+            }
+
+            if (isRunningParallelPhase)
+            {
+                commandBuffer.Add([gameObject](Scene& scene)
+                {
+                    scene.Despawn(gameObject);
+                });
+                return;
             }
+
+            gameObject->OnDespawn();
+            Park(gameObject, pool);
         }
 
-        void OnRender()
+        TransformHierarchy& GetTransformHierarchy()
         {
-            for (auto& gameObject : gameObjects)
+            return transformHierarchy;
+        }
+
+        bool IsRunningParallelPhase() const
+        {
+            return isRunningParallelPhase;
+        }
+
+        CommandBuffer& GetCommandBuffer()
+        {
+            return commandBuffer;
+        }
+
+        BaseComponentArray& GetComponentArray(const size_t typeId, std::unique_ptr<BaseComponentArray> (*factory)())
+        {
+            if (typeId >= componentArrays.size())
+            {
+                componentArrays.resize(typeId + 1);
+            }
+
+            auto& componentArray = componentArrays[typeId];
+            if (componentArray == nullptr)
             {
-                gameObject->OnRender();
+                componentArray = factory();
             }
+            return *componentArray;
         }
 
-        void OnPostRender()
+        System& AddSystem(std::unique_ptr<System> system)
         {
-            for (auto& gameObject : gameObjects)
+            systems.push_back(std::move(system));
+            return *systems.back();
+        }
+
+        void RegisterComponent(Resource<Component> component, GameObject& gameObject, const size_t typeId,
+                               const Component::PhaseMask phases)
+        {
+            if (typeId >= componentsByType.size())
             {
-                gameObject->OnPostRender();
+                componentsByType.resize(typeId + 1);
             }
+            componentsByType[typeId].push_back(component);
+
+            const auto behaviour = dynamic_cast<const Behaviour*>(component.Get());
+            const bool isParallelSafe = behaviour != nullptr && behaviour->IsParallelSafe();
+            for (size_t i = 0; i < Component::PHASE_COUNT; ++i)
+            {
+                if ((phases & (1u << i)) == 0)
+                {
+                    continue;
+                }
+
+                if (isParallelSafe && i == static_cast<size_t>(Component::Phase::Update))
+                {
+                    parallelUpdateEntries.push_back({component.Get(), &gameObject});
+                }
+                else
+                {
+                    phaseEntries[i].push_back({component.Get(), &gameObject});
+                }
+            }
+        }
+
+        size_t GetComponentTypeCount() const
+        {
+            return componentsByType.size();
+        }
+
+        const std::vector<Resource<Component>>& GetComponentsOfType(const size_t typeId) const
+        {
+            if (typeId >= componentsByType.size())
+            {
+                return noComponents;
+            }
+            return componentsByType[typeId];
+        }
+
+        void OnEarlyFixedUpdate()
+        {
+            RunPhase(Component::Phase::EarlyFixedUpdate, &Component::OnEarlyFixedUpdate, &System::OnEarlyFixedUpdate);
+        }
+
+        void OnFixedUpdate()
+        {
+            RunPhase(Component::Phase::FixedUpdate, &Component::OnFixedUpdate, &System::OnFixedUpdate);
+        }
+
+        void OnLateFixedUpdate()
+        {
+            RunPhase(Component::Phase::LateFixedUpdate, &Component::OnLateFixedUpdate, &System::OnLateFixedUpdate);
+        }
+
+        void OnEarlyUpdate()
+        {
+            RunPhase(Component::Phase::EarlyUpdate, &Component::OnEarlyUpdate, &System::OnEarlyUpdate);
+        }
+
+        void OnUpdate()
+        {
+            RunParallelUpdate();
+            RunPhase(Component::Phase::Update, &Component::OnUpdate, &System::OnUpdate);
+        }
+
+        void OnLateUpdate()
+        {
+            RunPhase(Component::Phase::LateUpdate, &Component::OnLateUpdate, &System::OnLateUpdate);
+        }
+
+        void OnPreRender()
+        {
+            transformHierarchy.UpdateWorldMatrices();
+            RunPhase(Component::Phase::PreRender, &Component::OnPreRender, &System::OnPreRender);
+        }
+
+        void OnRender()
+        {
+            RunPhase(Component::Phase::Render, &Component::OnRender, &System::OnRender);
+        }
+
+        void OnPostRender()
+        {
+            RunPhase(Component::Phase::PostRender, &Component::OnPostRender, &System::OnPostRender);
         }
 
         void Cleanup()
         {
+            const bool hasDestroyed = std::any_of(gameObjects.begin(), gameObjects.end(), [](const GameObject* go)
+            {
+                return go->IsDestroyed();
+            });
+
+            if (!hasDestroyed)
+            {
+                return;
+            }
+
+            const auto isEntryDestroyed = [](const PhaseEntry& entry)
+            {
+                return entry.gameObject->IsDestroyed();
+            };
+
+            for (auto& entries : phaseEntries)
+            {
+                entries.erase(std::remove_if(entries.begin(), entries.end(), isEntryDestroyed), entries.end());
+            }
+
+            parallelUpdateEntries.erase(std::remove_if(parallelUpdateEntries.begin(), parallelUpdateEntries.end(),
+                                                       isEntryDestroyed), parallelUpdateEntries.end());
+
+            const auto isDestroyed = [](const Resource<GameObject>& gameObject)
+            {
+                return gameObject->IsDestroyed();
+            };
+
+            for (auto& pool : pools)
+            {
+                auto& available = pool.available;
+                available.erase(std::remove_if(available.begin(), available.end(), isDestroyed), available.end());
+            }
+
+            // Only the live parents of destroyed game objects are pruned, and each of them once.
+            std::vector<Transform*> parents;
+            for (GameObject* go : gameObjects)
+            {
+                if (!go->IsDestroyed() || go == root.Get())
+                {
+                    continue;
+                }
+
+                Resource<Transform> parent = go->GetTransform()->GetParent();
+                if (parent != nullptr && !parent->GetGameObject()->IsDestroyed())
+                {
+                    parents.push_back(parent.Get());
+                }
+            }
+
+            std::sort(parents.begin(), parents.end());
+            parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+            for (Transform* parent : parents)
+            {
+                parent->RemoveDestroyedChildren();
+            }
+
+            for (auto& components : componentsByType)
+            {
+                components.erase(std::remove_if(components.begin(), components.end(),
+                                                [](const Resource<Component>& component)
+                                                {
+                                                    return component->GetGameObject()->IsDestroyed();
+                                                }), components.end());
+            }
+
             auto it = gameObjects.begin();
             while (it != gameObjects.end())
             {
                 GameObject* go = *it;
                 if (go->IsDestroyed())
                 {
+                    RemoveFromIndices(*go);
+                    const ObjectHandle handle = go->GetHandle();
+                    for (auto& componentArray : componentArrays)
+                    {
+                        if (componentArray != nullptr)
+                        {
+                            componentArray->Remove(handle);
+                        }
+                    }
                     memoryManager->Remove(*go);
                     gameObjects.erase(it++);
                 }
@@ -161,6 +687,259 @@ namespace pluto
                 }
             }
         }
+
+    private:
+        void Park(Resource<GameObject> gameObject, const uint32_t pool)
+        {
+            gameObject->SetActive(false);
+
+            // Parked under the root, so it is not destroyed along with the parent it was spawned under.
+            const Resource<Transform> transform = gameObject->GetTransform();
+            const Resource<Transform> rootTransform = root->GetTransform();
+            if (transform->GetParent() != rootTransform)
+            {
+                transform->SetParent(rootTransform);
+            }
+            pools[pool].available.push_back(gameObject);
+        }
+
+        Resource<GameObject> Instantiate(const uint32_t pool)
+        {
+            Resource<GameObject> gameObject = pools[pool].create(*owner);
+            if (gameObject == nullptr || gameObject->GetScene() != owner)
+            {
+                Exception::Throw(std::runtime_error("Pool function must return a game object of its scene."));
+            }
+
+            if (gameObject->GetPool() != GameObject::NO_POOL)
+            {
+                Exception::Throw(std::runtime_error("Pool function must return a new game object."));
+            }
+            return gameObject;
+        }
+
+        static const Component::RegisteredType& FindComponentType(const std::string& name)
+        {
+            const Component::RegisteredType* type = Component::FindType(name);
+            if (type == nullptr)
+            {
+                Exception::Throw(std::runtime_error("Component type \"" + name + "\" is not registered."));
+            }
+            return *type;
+        }
+
+        /*
+         * The storage is sized for the game objects, their transforms and componentsCount more components before the
+         * game objects are added in one go.
+         */
+        std::vector<Resource<Object>> CreateGameObjects(const size_t count, const size_t componentsCount)
+        {
+            memoryManager->Reserve(count * 2 + componentsCount);
+            transformHierarchy.Reserve(count);
+
+            std::vector<std::unique_ptr<Object>> newGameObjects;
+            newGameObjects.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                newGameObjects.push_back(gameObjectFactory->Create());
+            }
+            return memoryManager->AddRange(std::move(newGameObjects));
+        }
+
+        void SetUpGameObject(Resource<GameObject> gameObjectResource, const std::string& name,
+                             const GameObject::TagMask tags, const uint8_t layer, const bool isActive,
+                             const Resource<Transform>& parent, const Vector3F& localPosition,
+                             const Quaternion& localRotation, const Vector3F& localScale)
+        {
+            // Set up before it has a scene, so it goes straight into its final buckets.
+            GameObject* gameObject = gameObjectResource.Get();
+            gameObject->SetName(name);
+            gameObject->SetTags(tags);
+            gameObject->SetLayer(layer);
+            gameObject->SetScene(*owner);
+            AddToIndices(gameObjectResource);
+
+            Resource<Transform> transform = gameObject->AddComponent<Transform>();
+            gameObjects.push_back(gameObject);
+
+            transform->SetParent(parent);
+            transform->SetLocalPosition(localPosition);
+            transform->SetLocalRotation(localRotation);
+            transform->SetLocalScale(localScale);
+
+            if (!isActive)
+            {
+                gameObject->SetActive(false);
+            }
+        }
+
+        Resource<GameObject> GetResource(const GameObject& gameObject) const
+        {
+            return ResourceUtils::Cast<GameObject>(memoryManager->Get(gameObject.GetHandle()));
+        }
+
+        void AddToIndices(const Resource<GameObject>& gameObject)
+        {
+            AddToBucket(nameIndex[gameObject->GetName()], gameObject, namePositions);
+
+            const GameObject::TagMask tags = gameObject->GetTags();
+            for (size_t tag = 0; tag < GameObject::TAG_COUNT; ++tag)
+            {
+                if ((tags & (1u << tag)) != 0)
+                {
+                    AddToBucket(tagIndex[tag], gameObject, tagPositions[tag]);
+                }
+            }
+
+            AddToBucket(layerIndex[gameObject->GetLayer()], gameObject, layerPositions);
+        }
+
+        void RemoveFromIndices(const GameObject& gameObject)
+        {
+            // The root is never indexed.
+            if (namePositions.find(gameObject.GetHandle()) == namePositions.end())
+            {
+                return;
+            }
+
+            RemoveFromNameBucket(gameObject.GetName(), gameObject);
+
+            const GameObject::TagMask tags = gameObject.GetTags();
+            for (size_t tag = 0; tag < GameObject::TAG_COUNT; ++tag)
+            {
+                if ((tags & (1u << tag)) != 0)
+                {
+                    RemoveFromTagBucket(tag, gameObject);
+                }
+            }
+
+            RemoveFromBucket(layerIndex[gameObject.GetLayer()], gameObject, layerPositions);
+            namePositions.erase(gameObject.GetHandle());
+            layerPositions.erase(gameObject.GetHandle());
+        }
+
+        static void AddToBucket(std::vector<Resource<GameObject>>& bucket, const Resource<GameObject>& gameObject,
+                                std::unordered_map<ObjectHandle, uint32_t>& positions)
+        {
+            positions[gameObject.GetHandle()] = static_cast<uint32_t>(bucket.size());
+            bucket.push_back(gameObject);
+        }
+
+        /*
+         * The last game object of the bucket is moved into the place of the removed one.
+         */
+        static void RemoveFromBucket(std::vector<Resource<GameObject>>& bucket, const GameObject& gameObject,
+                                     std::unordered_map<ObjectHandle, uint32_t>& positions)
+        {
+            const uint32_t index = positions.at(gameObject.GetHandle());
+            const uint32_t lastIndex = static_cast<uint32_t>(bucket.size()) - 1;
+            if (index != lastIndex)
+            {
+                bucket[index] = bucket[lastIndex];
+                positions[bucket[index].GetHandle()] = index;
+            }
+            bucket.pop_back();
+        }
+
+        void RemoveFromNameBucket(const std::string& name, const GameObject& gameObject)
+        {
+            const auto it = nameIndex.find(name);
+            if (it == nameIndex.end())
+            {
+                return;
+            }
+
+            RemoveFromBucket(it->second, gameObject, namePositions);
+            if (it->second.empty())
+            {
+                nameIndex.erase(it);
+            }
+        }
+
+        void RemoveFromTagBucket(const size_t tag, const GameObject& gameObject)
+        {
+            RemoveFromBucket(tagIndex[tag], gameObject, tagPositions[tag]);
+            tagPositions[tag].erase(gameObject.GetHandle());
+        }
+
+        /*
+         * Despawned game objects stay in the indices, they are waiting in a pool and only skipped by the lookups.
+         */
+        static bool IsFindable(const GameObject& gameObject)
+        {
+            return !gameObject.IsDestroyed() && !gameObject.IsDespawned();
+        }
+
+        static void AppendFindable(const std::vector<Resource<GameObject>>& bucket,
+                                   std::vector<Resource<GameObject>>& result)
+        {
+            for (const auto& gameObject : bucket)
+            {
+                if (IsFindable(*gameObject.Get()))
+                {
+                    result.push_back(gameObject);
+                }
+            }
+        }
+
+        void RunParallelUpdate()
+        {
+            if (parallelUpdateEntries.empty())
+            {
+                return;
+            }
+
+            // Parallel behaviours may read their world matrix, it must not be lazily updated from several threads.
+            transformHierarchy.UpdateWorldMatrices();
+
+            isRunningParallelPhase = true;
+            try
+            {
+                jobSystem->ParallelFor(parallelUpdateEntries.size(), PARALLEL_UPDATE_CHUNK_SIZE,
+                                       [this](const size_t begin, const size_t end)
+                                       {
+                                           for (size_t i = begin; i < end; ++i)
+                                           {
+                                               const PhaseEntry& entry = parallelUpdateEntries[i];
+                                               if (!entry.gameObject->IsDestroyed() &&
+                                                   entry.gameObject->IsGloballyActive())
+                                               {
+                                                   entry.component->OnUpdate();
+                                               }
+                                           }
+                                       });
+            }
+            catch (...)
+            {
+                // What the jobs recorded belongs to an update that did not finish, it is dropped with it.
+                isRunningParallelPhase = false;
+                commandBuffer.Clear();
+                throw;
+            }
+            isRunningParallelPhase = false;
+
+            commandBuffer.Execute(*owner);
+        }
+
+        void RunPhase(const Component::Phase phase, void (Component::*hook)(), void (System::*systemHook)(Scene&))
+        {
+            auto& entries = phaseEntries[static_cast<size_t>(phase)];
+
+            // Components added by a hook are appended, they are still called in this pass.
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                const PhaseEntry entry = entries[i];
+                if (!entry.gameObject->IsDestroyed() && entry.gameObject->IsGloballyActive())
+                {
+                    (entry.component->*hook)();
+                }
+            }
+
+            for (auto& system : systems)
+            {
+                (system.get()->*systemHook)(*owner);
+            }
+        }
     };
 
     Scene::Factory::Factory(ServiceCollection& serviceCollection)
@@ -172,19 +951,23 @@ namespace pluto
     {
         ServiceCollection& serviceCollection = GetServiceCollection();
         auto& memoryManager = serviceCollection.GetService<MemoryManager>();
+        auto& jobSystem = serviceCollection.GetService<JobSystem>();
         GameObject::Factory& gameObjectFactory = serviceCollection.GetFactory<GameObject>();
 
-        return std::make_unique<Scene>(std::make_unique<Impl>(Guid::New(), memoryManager, gameObjectFactory));
+        return std::make_unique<Scene>(std::make_unique<Impl>(RuntimeId::New(), memoryManager, jobSystem,
+                                                              gameObjectFactory));
     }
 
     Scene::Scene(std::unique_ptr<Impl> impl)
         : impl(std::move(impl))
     {
+        this->impl->SetOwner(*this);
     }
 
     Scene::Scene(Scene&& other) noexcept
         : impl(std::move(other.impl))
     {
+        impl->SetOwner(*this);
     }
 
     Scene::~Scene() = default;
@@ -197,10 +980,11 @@ namespace pluto
         }
 
         impl = std::move(rhs.impl);
+        impl->SetOwner(*this);
         return *this;
     }
 
-    const Guid& Scene::GetId() const
+    RuntimeId Scene::GetId() const
     {
         return impl->GetId();
     }
@@ -235,11 +1019,127 @@ namespace pluto
         return impl->FindGameObject(name);
     }
 
+    void Scene::FindGameObjects(const std::string& name, std::vector<Resource<GameObject>>& result) const
+    {
+        impl->FindGameObjects(name, result);
+    }
+
+    void Scene::FindGameObjectsWithTags(const GameObject::TagMask tags, std::vector<Resource<GameObject>>& result) const
+    {
+        impl->FindGameObjectsWithTags(tags, result);
+    }
+
+    void Scene::FindGameObjectsInLayers(const GameObject::LayerMask layers,
+                                        std::vector<Resource<GameObject>>& result) const
+    {
+        impl->FindGameObjectsInLayers(layers, result);
+    }
+
     void Scene::Destroy()
     {
         impl->Destroy();
     }
 
+    Resource<GameObject> Scene::Instantiate(const Resource<PrefabAsset>& prefab)
+    {
+        return Instantiate(prefab, GetRootGameObject()->GetTransform());
+    }
+
+    Resource<GameObject> Scene::Instantiate(const Resource<PrefabAsset>& prefab, const Resource<Transform>& parent)
+    {
+        std::vector<Resource<GameObject>> result;
+        impl->Instantiate(*prefab.Get(), 1, parent, result);
+        return result.empty() ? nullptr : result.front();
+    }
+
+    void Scene::Instantiate(const Resource<PrefabAsset>& prefab, const size_t count, const Resource<Transform>& parent,
+                            std::vector<Resource<GameObject>>& result)
+    {
+        impl->Instantiate(*prefab.Get(), count, parent, result);
+    }
+
+    void Scene::LoadGameObjects(const SceneAsset& sceneAsset, const size_t count,
+                                std::vector<Resource<GameObject>>& loadedGameObjects)
+    {
+        impl->LoadGameObjects(sceneAsset, count, loadedGameObjects);
+    }
+
+    uint32_t Scene::CreatePool(PoolFunction create, const size_t capacity)
+    {
+        return impl->CreatePool(std::move(create), capacity);
+    }
+
+    Resource<GameObject> Scene::Spawn(const uint32_t pool)
+    {
+        return impl->Spawn(pool, GetRootGameObject()->GetTransform());
+    }
+
+    Resource<GameObject> Scene::Spawn(const uint32_t pool, const Resource<Transform>& parent)
+    {
+        return impl->Spawn(pool, parent);
+    }
+
+    void Scene::Despawn(const Resource<GameObject>& gameObject)
+    {
+        impl->Despawn(gameObject);
+    }
+
+    TransformHierarchy& Scene::GetTransformHierarchy()
+    {
+        return impl->GetTransformHierarchy();
+    }
+
+    bool Scene::IsRunningParallelPhase() const
+    {
+        return impl->IsRunningParallelPhase();
+    }
+
+    CommandBuffer& Scene::GetCommandBuffer()
+    {
+        return impl->GetCommandBuffer();
+    }
+
+    BaseComponentArray& Scene::GetComponentArray(const size_t typeId, std::unique_ptr<BaseComponentArray> (*factory)())
+    {
+        return impl->GetComponentArray(typeId, factory);
+    }
+
+    System& Scene::AddSystem(std::unique_ptr<System> system)
+    {
+        return impl->AddSystem(std::move(system));
+    }
+
+    void Scene::RegisterComponent(const Resource<Component>& component, GameObject& gameObject, const size_t typeId,
+                                  const Component::PhaseMask phases)
+    {
+        impl->RegisterComponent(component, gameObject, typeId, phases);
+    }
+
+    size_t Scene::GetComponentTypeCount() const
+    {
+        return impl->GetComponentTypeCount();
+    }
+
+    const std::vector<Resource<Component>>& Scene::GetComponentsOfType(const size_t typeId) const
+    {
+        return impl->GetComponentsOfType(typeId);
+    }
+
+    void Scene::OnGameObjectRenamed(GameObject& gameObject, const std::string& previousName)
+    {
+        impl->OnGameObjectRenamed(gameObject, previousName);
+    }
+
+    void Scene::OnGameObjectTagsChanged(GameObject& gameObject, const GameObject::TagMask previousTags)
+    {
+        impl->OnGameObjectTagsChanged(gameObject, previousTags);
+    }
+
+    void Scene::OnGameObjectLayerChanged(GameObject& gameObject, const uint8_t previousLayer)
+    {
+        impl->OnGameObjectLayerChanged(gameObject, previousLayer);
+    }
+
     void Scene::OnEarlyFixedUpdate()
     {
         impl->OnEarlyFixedUpdate();
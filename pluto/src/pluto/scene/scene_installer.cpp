@@ -21,6 +21,10 @@ namespace pluto
         serviceCollection.AddFactory<MeshRenderer>(std::make_unique<MeshRenderer::Factory>(serviceCollection));
         serviceCollection.EmplaceFactory<TextRenderer>();
         serviceCollection.AddService(SceneManager::Factory(serviceCollection).Create());
+
+        Component::RegisterType<Camera>("Camera");
+        Component::RegisterType<MeshRenderer>("MeshRenderer");
+        Component::RegisterType<TextRenderer>("TextRenderer");
     }
 
     void SceneInstaller::Uninstall(ServiceCollection& serviceCollection)
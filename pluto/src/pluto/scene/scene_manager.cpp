@@ -2,12 +2,18 @@
 
 #include <pluto/event/event_manager.h>
 #include <pluto/log/log_manager.h>
+#include <pluto/config/config_manager.h>
+#include <pluto/asset/scene_asset.h>
+#include <pluto/memory/resource.h>
 
 #include <pluto/scene/scene.h>
 #include <pluto/scene/game_object.h>
 
 #include <pluto/service/service_collection.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "pluto/physics_2d/events/on_early_fixed_update_event.h"
 #include "pluto/physics_2d/events/on_fixed_update_event.h"
 #include "pluto/physics_2d/events/on_late_fixed_update_event.h"
@@ -33,17 +39,23 @@ namespace pluto
         std::unique_ptr<Scene> activeScene;
         bool shouldLoadNewScene;
 
-        Guid onEarlyFixedUpdateEventListenerId;
-        Guid onFixedUpdateEventListenerId;
-        Guid onLateFixedUpdateEventListenerId;
-        Guid onEarlyUpdateEventListenerId;
-        Guid onUpdateEventListenerId;
-        Guid onLateUpdateEventListenerId;
-        Guid onPreRenderEventListenerId;
-        Guid onRenderEventListenerId;
-        Guid onPostRenderEventListenerId;
-        Guid onMainLoopBeginEventListenerId;
-        Guid onMainLoopEndEventListenerId;
+        // Null when the next scene is an empty one.
+        Resource<SceneAsset> nextSceneAsset;
+        Resource<SceneAsset> loadingSceneAsset;
+        std::vector<Resource<GameObject>> loadedGameObjects;
+        size_t gameObjectsLoadedPerFrame;
+
+        RuntimeId onEarlyFixedUpdateEventListenerId;
+        RuntimeId onFixedUpdateEventListenerId;
+        RuntimeId onLateFixedUpdateEventListenerId;
+        RuntimeId onEarlyUpdateEventListenerId;
+        RuntimeId onUpdateEventListenerId;
+        RuntimeId onLateUpdateEventListenerId;
+        RuntimeId onPreRenderEventListenerId;
+        RuntimeId onRenderEventListenerId;
+        RuntimeId onPostRenderEventListenerId;
+        RuntimeId onMainLoopBeginEventListenerId;
+        RuntimeId onMainLoopEndEventListenerId;
 
         const Scene::Factory* sceneFactory;
         EventManager* eventManager;
@@ -52,8 +64,11 @@ namespace pluto
     public:
         ~Impl()
         {
-            activeScene->Destroy();
-            activeScene->Cleanup();
+            if (activeScene != nullptr)
+            {
+                activeScene->Destroy();
+                activeScene->Cleanup();
+            }
 
             eventManager->Unsubscribe<OnEarlyFixedUpdateEvent>(onEarlyFixedUpdateEventListenerId);
             eventManager->Unsubscribe<OnFixedUpdateEvent>(onFixedUpdateEventListenerId);
@@ -71,8 +86,10 @@ namespace pluto
             logManager->LogInfo("SceneManager terminated!");
         }
 
-        Impl(const Scene::Factory& sceneFactory, EventManager& eventManager, LogManager& logManager)
+        Impl(const size_t gameObjectsLoadedPerFrame, const Scene::Factory& sceneFactory, EventManager& eventManager,
+             LogManager& logManager)
             : shouldLoadNewScene(true),
+              gameObjectsLoadedPerFrame(gameObjectsLoadedPerFrame),
               sceneFactory(&sceneFactory),
               eventManager(&eventManager),
               logManager(&logManager)
@@ -108,9 +125,21 @@ namespace pluto
 
         void LoadEmptyScene()
         {
+            nextSceneAsset = nullptr;
             shouldLoadNewScene = true;
         }
 
+        void LoadScene(const Resource<SceneAsset>& sceneAsset)
+        {
+            nextSceneAsset = sceneAsset;
+            shouldLoadNewScene = true;
+        }
+
+        bool IsLoadingScene() const
+        {
+            return shouldLoadNewScene || loadingSceneAsset != nullptr;
+        }
+
     private:
         void OnEarlyFixedUpdate(const OnEarlyFixedUpdateEvent& evt)
         {
@@ -190,8 +219,35 @@ namespace pluto
             {
                 activeScene = sceneFactory->Create();
                 shouldLoadNewScene = false;
-                eventManager->Dispatch<OnSceneLoadedEvent>();
+                loadingSceneAsset = nextSceneAsset;
+                nextSceneAsset = nullptr;
+                loadedGameObjects.clear();
+                if (loadingSceneAsset == nullptr)
+                {
+                    eventManager->Dispatch<OnSceneLoadedEvent>();
+                }
             }
+
+            if (loadingSceneAsset != nullptr)
+            {
+                LoadNextGameObjects();
+            }
+        }
+
+        void LoadNextGameObjects()
+        {
+            const SceneAsset& sceneAsset = *loadingSceneAsset.Get();
+            activeScene->LoadGameObjects(sceneAsset, gameObjectsLoadedPerFrame, loadedGameObjects);
+            if (loadedGameObjects.size() < sceneAsset.GetGameObjectCount())
+            {
+                return;
+            }
+
+            logManager->LogInfo("Scene " + sceneAsset.GetName() + " loaded with " +
+                std::to_string(loadedGameObjects.size()) + " game objects!");
+            loadingSceneAsset = nullptr;
+            std::vector<Resource<GameObject>>().swap(loadedGameObjects);
+            eventManager->Dispatch<OnSceneLoadedEvent>();
         }
 
         void OnMainLoopEnd(const OnMainLoopEndEvent& evt)
@@ -207,6 +263,8 @@ namespace pluto
                 return;
             }
 
+            loadingSceneAsset = nullptr;
+            loadedGameObjects.clear();
             activeScene->Destroy();
             activeScene->Cleanup();
             activeScene.reset();
@@ -225,8 +283,10 @@ namespace pluto
         Scene::Factory& sceneFactory = serviceCollection.GetFactory<Scene>();
         auto& eventManager = serviceCollection.GetService<EventManager>();
         auto& logManager = serviceCollection.GetService<LogManager>();
+        const auto& configManager = serviceCollection.GetService<ConfigManager>();
+        const int gameObjectsLoadedPerFrame = configManager.GetInt("sceneGameObjectsLoadedPerFrame", 4096);
         return std::make_unique<SceneManager>(
-            std::make_unique<Impl>(sceneFactory, eventManager, logManager));
+            std::make_unique<Impl>(std::max(gameObjectsLoadedPerFrame, 1), sceneFactory, eventManager, logManager));
     }
 
     SceneManager::SceneManager(std::unique_ptr<Impl> impl)
@@ -261,4 +321,14 @@ namespace pluto
     {
         return impl->LoadEmptyScene();
     }
+
+    void SceneManager::LoadScene(const Resource<SceneAsset>& sceneAsset)
+    {
+        impl->LoadScene(sceneAsset);
+    }
+
+    bool SceneManager::IsLoadingScene() const
+    {
+        return impl->IsLoadingScene();
+    }
 }
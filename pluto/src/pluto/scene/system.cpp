@@ -0,0 +1,48 @@
+#include "pluto/scene/system.h"
+
+namespace pluto
+{
+    System::~System() = default;
+
+    System::System() = default;
+
+    System::System(System&& other) noexcept = default;
+
+    System& System::operator=(System&& rhs) noexcept = default;
+
+    void System::OnEarlyFixedUpdate(Scene& scene)
+    {
+    }
+
+    void System::OnFixedUpdate(Scene& scene)
+    {
+    }
+
+    void System::OnLateFixedUpdate(Scene& scene)
+    {
+    }
+
+    void System::OnEarlyUpdate(Scene& scene)
+    {
+    }
+
+    void System::OnUpdate(Scene& scene)
+    {
+    }
+
+    void System::OnLateUpdate(Scene& scene)
+    {
+    }
+
+    void System::OnPreRender(Scene& scene)
+    {
+    }
+
+    void System::OnRender(Scene& scene)
+    {
+    }
+
+    void System::OnPostRender(Scene& scene)
+    {
+    }
+}
@@ -0,0 +1,497 @@
+#include "pluto/scene/transform_hierarchy.h"
+
+#include "pluto/exception.h"
+
+#include "pluto/math/vector3f.h"
+#include "pluto/math/vector4f.h"
+#include "pluto/math/quaternion.h"
+#include "pluto/math/matrix4x4.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace pluto
+{
+    class TransformHierarchy::Impl
+    {
+        enum Flags : uint8_t
+        {
+            LOCAL_MATRIX_DIRTY = 1 << 0,
+            // The node or its parent changed since the last update, the world matrix of its whole subtree is stale.
+            CHANGED = 1 << 1,
+            // Set during the update when the world matrix was recomputed, so the children know they must follow.
+            UPDATED = 1 << 2
+        };
+
+        // Dense arrays indexed by the position of the node.
+        std::vector<Vector3F> localPositions;
+        std::vector<Quaternion> localRotations;
+        std::vector<Vector3F> localScales;
+        std::vector<Matrix4X4> localMatrices;
+        std::vector<Matrix4X4> worldMatrices;
+        std::vector<uint32_t> parents;
+        std::vector<uint8_t> flags;
+        std::vector<NodeId> nodes;
+
+        // Node ids are stable, positions change when the nodes are sorted.
+        std::vector<uint32_t> indices;
+        std::vector<NodeId> freeNodes;
+
+        size_t destroyedCount;
+        bool isOrderDirty;
+
+        // Parallel behaviours move their own transforms at the same time.
+        std::atomic<bool> hasChanges;
+
+    public:
+        Impl()
+            : destroyedCount(0),
+              isOrderDirty(false),
+              hasChanges(false)
+        {
+        }
+
+        NodeId CreateNode()
+        {
+            NodeId node;
+            if (freeNodes.empty())
+            {
+                node = static_cast<NodeId>(indices.size());
+                indices.push_back(NONE);
+            }
+            else
+            {
+                node = freeNodes.back();
+                freeNodes.pop_back();
+            }
+
+            // New nodes have no parent yet, appending them keeps the order valid.
+            indices[node] = static_cast<uint32_t>(nodes.size());
+            localPositions.push_back(Vector3F::ZERO);
+            localRotations.push_back(Quaternion::IDENTITY);
+            localScales.push_back(Vector3F::ONE);
+            localMatrices.push_back(Matrix4X4::IDENTITY);
+            worldMatrices.push_back(Matrix4X4::IDENTITY);
+            parents.push_back(NONE);
+            flags.push_back(0);
+            nodes.push_back(node);
+            return node;
+        }
+
+        void DestroyNode(const NodeId node)
+        {
+            // The slot is left in place and reclaimed on the next sort, so destroying a subtree stays cheap.
+            const uint32_t index = indices[node];
+            nodes[index] = NONE;
+            indices[node] = NONE;
+            freeNodes.push_back(node);
+
+            ++destroyedCount;
+            isOrderDirty = true;
+            hasChanges = true;
+        }
+
+        size_t GetNodeCount() const
+        {
+            return nodes.size() - destroyedCount;
+        }
+
+        void Reserve(const size_t count)
+        {
+            // Grows at least twofold, so instantiating one small prefab at a time does not copy every array each time.
+            if (nodes.size() + count <= nodes.capacity())
+            {
+                return;
+            }
+
+            const size_t capacity = std::max(nodes.size() + count, nodes.capacity() * 2);
+            localPositions.reserve(capacity);
+            localRotations.reserve(capacity);
+            localScales.reserve(capacity);
+            localMatrices.reserve(capacity);
+            worldMatrices.reserve(capacity);
+            parents.reserve(capacity);
+            flags.reserve(capacity);
+            nodes.reserve(capacity);
+            indices.reserve(capacity);
+        }
+
+        NodeId GetParent(const NodeId node) const
+        {
+            const uint32_t parent = parents[indices[node]];
+            return parent == NONE ? NONE : nodes[parent];
+        }
+
+        void SetParent(const NodeId node, const NodeId parent)
+        {
+            const uint32_t index = indices[node];
+            const uint32_t parentIndex = parent == NONE ? NONE : indices[parent];
+
+            // While the order is valid the descendants of a node come after it, an earlier parent is not one of them.
+            if (isOrderDirty || (parentIndex != NONE && parentIndex >= index))
+            {
+                for (uint32_t i = parentIndex; i != NONE; i = parents[i])
+                {
+                    if (i == index)
+                    {
+                        Exception::Throw(
+                            std::runtime_error("Can not set a transform parent if the same is it's child."));
+                    }
+                }
+            }
+
+            parents[index] = parentIndex;
+            if (parentIndex != NONE && parentIndex > index)
+            {
+                isOrderDirty = true;
+            }
+            MarkChanged(index, 0);
+        }
+
+        const Vector3F& GetLocalPosition(const NodeId node) const
+        {
+            return localPositions[indices[node]];
+        }
+
+        void SetLocalPosition(const NodeId node, const Vector3F& value)
+        {
+            const uint32_t index = indices[node];
+            localPositions[index] = value;
+            MarkChanged(index, LOCAL_MATRIX_DIRTY);
+        }
+
+        const Quaternion& GetLocalRotation(const NodeId node) const
+        {
+            return localRotations[indices[node]];
+        }
+
+        void SetLocalRotation(const NodeId node, const Quaternion& value)
+        {
+            const uint32_t index = indices[node];
+            localRotations[index] = value;
+            MarkChanged(index, LOCAL_MATRIX_DIRTY);
+        }
+
+        const Vector3F& GetLocalScale(const NodeId node) const
+        {
+            return localScales[indices[node]];
+        }
+
+        void SetLocalScale(const NodeId node, const Vector3F& value)
+        {
+            const uint32_t index = indices[node];
+            localScales[index] = value;
+            MarkChanged(index, LOCAL_MATRIX_DIRTY);
+        }
+
+        const Matrix4X4& GetLocalMatrix(const NodeId node)
+        {
+            return UpdateLocalMatrix(indices[node]);
+        }
+
+        const Matrix4X4& GetWorldMatrix(const NodeId node)
+        {
+            const uint32_t index = indices[node];
+            if (!hasChanges.load(std::memory_order_relaxed))
+            {
+                return worldMatrices[index];
+            }
+
+            uint32_t top = NONE;
+            for (uint32_t i = index; i != NONE; i = parents[i])
+            {
+                if ((flags[i] & CHANGED) != 0)
+                {
+                    top = i;
+                }
+            }
+
+            if (top == NONE)
+            {
+                return worldMatrices[index];
+            }
+
+            // Only the path from the highest changed ancestor is recomputed, the flags are left for the next update.
+            // The ancestors are computed into a local, parallel behaviours under the same parent read them at once.
+            worldMatrices[index] = ComputeWorldMatrix(index, top);
+            return worldMatrices[index];
+        }
+
+        void UpdateWorldMatrices()
+        {
+            if (!hasChanges)
+            {
+                return;
+            }
+
+            if (isOrderDirty)
+            {
+                SortNodes();
+            }
+
+            const size_t count = nodes.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t parent = parents[i];
+                uint8_t& flag = flags[i];
+                if ((flag & CHANGED) != 0 || (parent != NONE && (flags[parent] & UPDATED) != 0))
+                {
+                    UpdateWorldMatrix(static_cast<uint32_t>(i));
+                    flag = static_cast<uint8_t>((flag & ~CHANGED) | UPDATED);
+                }
+                else
+                {
+                    flag = static_cast<uint8_t>(flag & ~UPDATED);
+                }
+            }
+            hasChanges = false;
+        }
+
+    private:
+        void MarkChanged(const uint32_t index, const uint8_t flag)
+        {
+            flags[index] |= CHANGED | flag;
+            hasChanges.store(true, std::memory_order_relaxed);
+        }
+
+        const Matrix4X4& UpdateLocalMatrix(const uint32_t index)
+        {
+            if ((flags[index] & LOCAL_MATRIX_DIRTY) != 0)
+            {
+                localMatrices[index] = Matrix4X4::TSR(localPositions[index], localRotations[index], localScales[index]);
+                flags[index] &= ~LOCAL_MATRIX_DIRTY;
+            }
+            return localMatrices[index];
+        }
+
+        void UpdateWorldMatrix(const uint32_t index)
+        {
+            const uint32_t parent = parents[index];
+            const Matrix4X4& localMatrix = UpdateLocalMatrix(index);
+            worldMatrices[index] = parent == NONE ? localMatrix : worldMatrices[parent] * localMatrix;
+        }
+
+        /*
+         * World matrix of the node when every node from top down to it may have changed. Nothing is written, the local
+         * matrices are folded from the node up so deep hierarchies need neither recursion nor a path buffer.
+         */
+        Matrix4X4 ComputeWorldMatrix(const uint32_t index, const uint32_t top) const
+        {
+            Matrix4X4 matrix = ComputeLocalMatrix(index);
+            for (uint32_t i = index; i != top;)
+            {
+                i = parents[i];
+                matrix = ComputeLocalMatrix(i) * matrix;
+            }
+
+            const uint32_t parent = parents[top];
+            return parent == NONE ? matrix : worldMatrices[parent] * matrix;
+        }
+
+        Matrix4X4 ComputeLocalMatrix(const uint32_t index) const
+        {
+            if ((flags[index] & LOCAL_MATRIX_DIRTY) != 0)
+            {
+                return Matrix4X4::TSR(localPositions[index], localRotations[index], localScales[index]);
+            }
+            return localMatrices[index];
+        }
+
+        /*
+         * Drops the destroyed nodes and lays the others out in depth first order.
+         */
+        void SortNodes()
+        {
+            const uint32_t count = static_cast<uint32_t>(nodes.size());
+
+            std::vector<uint32_t> roots;
+            std::vector<uint32_t> childStart(count + 1, 0);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (nodes[i] == NONE)
+                {
+                    continue;
+                }
+
+                uint32_t& parent = parents[i];
+                if (parent != NONE && nodes[parent] == NONE)
+                {
+                    parent = NONE;
+                    flags[i] |= CHANGED;
+                }
+
+                if (parent == NONE)
+                {
+                    roots.push_back(i);
+                }
+                else
+                {
+                    ++childStart[parent + 1];
+                }
+            }
+
+            for (uint32_t i = 1; i <= count; ++i)
+            {
+                childStart[i] += childStart[i - 1];
+            }
+
+            std::vector<uint32_t> children(childStart[count]);
+            std::vector<uint32_t> childEnd(childStart.begin(), childStart.end() - 1);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (nodes[i] != NONE && parents[i] != NONE)
+                {
+                    children[childEnd[parents[i]]++] = i;
+                }
+            }
+
+            std::vector<uint32_t> order;
+            order.reserve(count - destroyedCount);
+            std::vector<uint32_t> stack;
+            for (const uint32_t root : roots)
+            {
+                stack.push_back(root);
+                while (!stack.empty())
+                {
+                    const uint32_t index = stack.back();
+                    stack.pop_back();
+                    order.push_back(index);
+                    for (uint32_t i = childEnd[index]; i > childStart[index]; --i)
+                    {
+                        stack.push_back(children[i - 1]);
+                    }
+                }
+            }
+
+            std::vector<uint32_t> newIndices(count, NONE);
+            for (uint32_t i = 0; i < order.size(); ++i)
+            {
+                newIndices[order[i]] = i;
+            }
+
+            std::vector<uint32_t> newParents;
+            newParents.reserve(order.size());
+            for (const uint32_t index : order)
+            {
+                const uint32_t parent = parents[index];
+                newParents.push_back(parent == NONE ? NONE : newIndices[parent]);
+            }
+            parents.swap(newParents);
+
+            Reorder(localPositions, order);
+            Reorder(localRotations, order);
+            Reorder(localScales, order);
+            Reorder(localMatrices, order);
+            Reorder(worldMatrices, order);
+            Reorder(flags, order);
+            Reorder(nodes, order);
+
+            for (uint32_t i = 0; i < nodes.size(); ++i)
+            {
+                indices[nodes[i]] = i;
+            }
+
+            destroyedCount = 0;
+            isOrderDirty = false;
+        }
+
+        template <typename T>
+        static void Reorder(std::vector<T>& values, const std::vector<uint32_t>& order)
+        {
+            std::vector<T> result;
+            result.reserve(order.size());
+            for (const uint32_t index : order)
+            {
+                result.push_back(values[index]);
+            }
+            values.swap(result);
+        }
+    };
+
+    TransformHierarchy::~TransformHierarchy() = default;
+
+    TransformHierarchy::TransformHierarchy()
+        : impl(std::make_unique<Impl>())
+    {
+    }
+
+    TransformHierarchy::TransformHierarchy(TransformHierarchy&& other) noexcept = default;
+
+    TransformHierarchy& TransformHierarchy::operator=(TransformHierarchy&& rhs) noexcept = default;
+
+    TransformHierarchy::NodeId TransformHierarchy::CreateNode()
+    {
+        return impl->CreateNode();
+    }
+
+    void TransformHierarchy::DestroyNode(const NodeId node)
+    {
+        impl->DestroyNode(node);
+    }
+
+    size_t TransformHierarchy::GetNodeCount() const
+    {
+        return impl->GetNodeCount();
+    }
+
+    void TransformHierarchy::Reserve(const size_t count)
+    {
+        impl->Reserve(count);
+    }
+
+    TransformHierarchy::NodeId TransformHierarchy::GetParent(const NodeId node) const
+    {
+        return impl->GetParent(node);
+    }
+
+    void TransformHierarchy::SetParent(const NodeId node, const NodeId parent)
+    {
+        impl->SetParent(node, parent);
+    }
+
+    const Vector3F& TransformHierarchy::GetLocalPosition(const NodeId node) const
+    {
+        return impl->GetLocalPosition(node);
+    }
+
+    void TransformHierarchy::SetLocalPosition(const NodeId node, const Vector3F& value)
+    {
+        impl->SetLocalPosition(node, value);
+    }
+
+    const Quaternion& TransformHierarchy::GetLocalRotation(const NodeId node) const
+    {
+        return impl->GetLocalRotation(node);
+    }
+
+    void TransformHierarchy::SetLocalRotation(const NodeId node, const Quaternion& value)
+    {
+        impl->SetLocalRotation(node, value);
+    }
+
+    const Vector3F& TransformHierarchy::GetLocalScale(const NodeId node) const
+    {
+        return impl->GetLocalScale(node);
+    }
+
+    void TransformHierarchy::SetLocalScale(const NodeId node, const Vector3F& value)
+    {
+        impl->SetLocalScale(node, value);
+    }
+
+    const Matrix4X4& TransformHierarchy::GetLocalMatrix(const NodeId node)
+    {
+        return impl->GetLocalMatrix(node);
+    }
+
+    const Matrix4X4& TransformHierarchy::GetWorldMatrix(const NodeId node)
+    {
+        return impl->GetWorldMatrix(node);
+    }
+
+    void TransformHierarchy::UpdateWorldMatrices()
+    {
+        impl->UpdateWorldMatrices();
+    }
+}
@@ -81,16 +81,19 @@ namespace pluto
                     eventManager->Dispatch<OnEarlyFixedUpdateEvent>();
                     eventManager->Dispatch<OnFixedUpdateEvent>();
                     eventManager->Dispatch<OnLateFixedUpdateEvent>();
+                    eventManager->FlushEventQueues();
                 }
             }
 
             if (deltaTime >= maxPeriod)
             {
                 lastTime = time;
+                eventManager->DispatchPostedEvents();
                 eventManager->Dispatch<OnMainLoopBeginEvent>();
                 eventManager->Dispatch<OnEarlyUpdateEvent>();
                 eventManager->Dispatch<OnUpdateEvent>();
                 eventManager->Dispatch<OnLateUpdateEvent>();
+                eventManager->FlushEventQueues();
                 eventManager->Dispatch<OnPreRenderEvent>();
                 eventManager->Dispatch<OnRenderEvent>();
                 eventManager->Dispatch<OnPostRenderEvent>();
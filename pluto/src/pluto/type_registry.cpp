@@ -0,0 +1,27 @@
+#include <pluto/type_registry.h>
+
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+namespace pluto
+{
+    static std::mutex& GetMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::unordered_map<std::type_index, std::unordered_map<std::type_index, size_t>>& GetDomains()
+    {
+        static std::unordered_map<std::type_index, std::unordered_map<std::type_index, size_t>> domains;
+        return domains;
+    }
+
+    size_t TypeRegistry::GetId(const std::type_info& domain, const std::type_info& type)
+    {
+        std::lock_guard<std::mutex> lock(GetMutex());
+        auto& ids = GetDomains()[domain];
+        return ids.emplace(type, ids.size()).first->second;
+    }
+}
@@ -0,0 +1,301 @@
+#define BOOST_TEST_MODULE allocation_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/memory_manager.h>
+#include <pluto/memory/frame_allocator.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+#include <pluto/scene/components/text_renderer.h>
+#include <pluto/asset/font_asset.h>
+#include <pluto/asset/mesh_asset.h>
+#include <pluto/asset/material_asset.h>
+#include <pluto/math/vector3f.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+/*
+ * Heap allocations are counted by replacing the global operator new. The engine library binds to the replacement as
+ * long as it shares the C++ runtime of the test, which is the case for the gcc and clang builds. Every form of new and
+ * delete is replaced, so no memory is released by a different allocator than the one that returned it.
+ */
+static std::atomic<bool> isCountingAllocations(false);
+static std::atomic<size_t> allocationCount(0);
+
+static void* Allocate(const size_t size) noexcept
+{
+    if (isCountingAllocations.load(std::memory_order_relaxed))
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+static void* AllocateAligned(const size_t size, const std::align_val_t alignment) noexcept
+{
+    if (isCountingAllocations.load(std::memory_order_relaxed))
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const size_t align = static_cast<size_t>(alignment);
+    const size_t alignedSize = (size == 0 ? 1 : size + align - 1) / align * align;
+#if defined(_MSC_VER)
+    return _aligned_malloc(alignedSize, align);
+#else
+    return std::aligned_alloc(align, alignedSize);
+#endif
+}
+
+static void Free(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+static void FreeAligned(void* ptr) noexcept
+{
+#if defined(_MSC_VER)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+static void* AllocateOrThrow(const size_t size)
+{
+    void* ptr = Allocate(size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+static void* AllocateAlignedOrThrow(const size_t size, const std::align_val_t alignment)
+{
+    void* ptr = AllocateAligned(size, alignment);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(const size_t size)
+{
+    return AllocateOrThrow(size);
+}
+
+void* operator new[](const size_t size)
+{
+    return AllocateOrThrow(size);
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+    return AllocateAlignedOrThrow(size, alignment);
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment)
+{
+    return AllocateAlignedOrThrow(size, alignment);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, alignment);
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    Free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    Free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    Free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    Free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    Free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    Free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAligned(ptr);
+}
+
+namespace pluto::test
+{
+    constexpr size_t WARM_UP_FRAMES = 2;
+    constexpr size_t COUNTED_FRAMES = 16;
+
+    /*
+     * Runs the frame function a few times so every buffer reaches its steady size, then returns how many heap
+     * allocations the next frames made. The frame allocator is reset after every frame, as the main loop does.
+     */
+    size_t CountSteadyFrameAllocations(FrameAllocator& frameAllocator, const std::function<void(size_t)>& frame)
+    {
+        for (size_t i = 0; i < WARM_UP_FRAMES; ++i)
+        {
+            frame(i);
+            frameAllocator.Reset();
+        }
+
+        allocationCount = 0;
+        isCountingAllocations = true;
+        for (size_t i = 0; i < COUNTED_FRAMES; ++i)
+        {
+            frame(WARM_UP_FRAMES + i);
+            frameAllocator.Reset();
+        }
+        isCountingAllocations = false;
+        return allocationCount;
+    }
+
+    struct SceneFixture
+    {
+        Environment environment;
+        FrameAllocator& frameAllocator;
+        std::unique_ptr<Scene> scene;
+
+        SceneFixture()
+            : frameAllocator(environment.GetService<FrameAllocator>()),
+              scene(environment.GetServiceCollection().GetFactory<Scene>().Create())
+        {
+        }
+
+        ~SceneFixture()
+        {
+            scene->Destroy();
+            scene->Cleanup();
+        }
+
+        SceneFixture(const SceneFixture& other) = delete;
+        SceneFixture(SceneFixture&& other) noexcept = delete;
+        SceneFixture& operator=(const SceneFixture& rhs) = delete;
+        SceneFixture& operator=(SceneFixture&& rhs) noexcept = delete;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(steady_frames, SceneFixture)
+
+        BOOST_AUTO_TEST_CASE(get_components_in_children_into_frame_vector_does_not_allocate)
+        {
+            Resource<GameObject> parent = scene->CreateGameObject();
+            for (size_t i = 0; i < 64; ++i)
+            {
+                Resource<GameObject> child = scene->CreateGameObject(parent->GetTransform());
+                scene->CreateGameObject(child->GetTransform());
+            }
+
+            size_t found = 0;
+            const size_t allocations = CountSteadyFrameAllocations(frameAllocator, [&](size_t)
+            {
+                FrameVector<Resource<Transform>> transforms(frameAllocator);
+                parent->GetComponentsInChildren(transforms);
+                found = transforms.size();
+            });
+
+            BOOST_TEST(found == 129u);
+            BOOST_TEST(allocations == 0u);
+        }
+
+        BOOST_AUTO_TEST_CASE(text_renderer_update_mesh_does_not_allocate)
+        {
+            std::vector<FontAsset::Glyph> glyphs;
+            for (const char character : std::string("abcdefgh ?"))
+            {
+                glyphs.push_back({character, 0, 0, 10, 12, 1, 12, 11});
+            }
+
+            Resource<MaterialAsset> material;
+            auto& memoryManager = environment.GetService<MemoryManager>();
+            const auto& fontFactory = environment.GetServiceCollection().GetFactory<FontAsset>();
+            const Resource<FontAsset> font = ResourceUtils::Cast<FontAsset>(
+                memoryManager.Add(fontFactory.Create(12, glyphs, material)));
+
+            Resource<GameObject> gameObject = scene->CreateGameObject();
+            Resource<TextRenderer> textRenderer = gameObject->AddComponent<TextRenderer>();
+            textRenderer->SetFont(font);
+
+            // Texts of the same length, a score counter rebuilds its mesh like this every frame.
+            const std::string texts[] = {"abcd efgh", "hgfe dcba"};
+            const size_t allocations = CountSteadyFrameAllocations(frameAllocator, [&](const size_t frame)
+            {
+                textRenderer->SetText(texts[frame % 2]);
+                textRenderer->OnUpdate();
+            });
+
+            BOOST_TEST(textRenderer->GetMesh()->GetPositions().size() == 36u);
+            BOOST_TEST(allocations == 0u);
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <pluto/stop_watch.h>
+
+#include <fmt/format.h>
+
+#include <string>
+
+namespace pluto::test
+{
+    /*
+     * Runs the function once and returns how long it took, in nanoseconds per item.
+     */
+    template <typename Function>
+    double Measure(const size_t itemsCount, Function&& function)
+    {
+        StopWatch stopWatch;
+        stopWatch.Start();
+        function();
+        stopWatch.Stop();
+        return static_cast<double>(stopWatch.GetElapsedNanoseconds()) / static_cast<double>(itemsCount);
+    }
+
+    inline void PrintHeader(const std::string& title)
+    {
+        fmt::print("\n{0}\n{1:-<{2}}\n", title, "", title.size());
+    }
+
+    inline void PrintRow(const std::string& name, const size_t itemsCount, const double nanosecondsPerItem)
+    {
+        fmt::print("{0:<48}{1:>10}{2:>14.1f} ns/item\n", name, itemsCount, nanosecondsPerItem);
+    }
+}
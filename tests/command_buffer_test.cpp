@@ -0,0 +1,116 @@
+#define BOOST_TEST_MODULE command_buffer_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/command_buffer.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/behaviour.h>
+#include <pluto/scene/components/transform.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace pluto::test
+{
+    /*
+     * Records a game object from a parallel update and then throws, so the update never finishes.
+     */
+    class Thrower final : public Behaviour
+    {
+    public:
+        class Factory final : public Component::Factory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection)
+                : Component::Factory(serviceCollection)
+            {
+            }
+
+            std::unique_ptr<Component> Create(const Resource<GameObject>& gameObject) const override
+            {
+                return std::make_unique<Thrower>(gameObject);
+            }
+        };
+
+        explicit Thrower(const Resource<GameObject>& gameObject)
+            : Behaviour(gameObject, true)
+        {
+        }
+
+        void OnUpdate() override
+        {
+            GetGameObject()->GetScene()->GetCommandBuffer().CreateGameObject(nullptr, "recorded");
+            throw std::runtime_error("thrower");
+        }
+    };
+
+    struct CommandBufferFixture
+    {
+        Environment environment;
+        std::unique_ptr<Scene> scene;
+
+        CommandBufferFixture()
+        {
+            ServiceCollection& serviceCollection = environment.GetServiceCollection();
+            serviceCollection.AddFactory<Thrower>(std::make_unique<Thrower::Factory>(serviceCollection));
+            scene = serviceCollection.GetFactory<Scene>().Create();
+        }
+
+        ~CommandBufferFixture()
+        {
+            scene->Destroy();
+            scene->Cleanup();
+        }
+
+        CommandBufferFixture(const CommandBufferFixture& other) = delete;
+        CommandBufferFixture(CommandBufferFixture&& other) noexcept = delete;
+        CommandBufferFixture& operator=(const CommandBufferFixture& rhs) = delete;
+        CommandBufferFixture& operator=(CommandBufferFixture&& rhs) noexcept = delete;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(command_buffer, CommandBufferFixture)
+
+        BOOST_AUTO_TEST_CASE(commands_left_by_a_throwing_command_are_not_run_later)
+        {
+            size_t runs = 0;
+            CommandBuffer& commandBuffer = scene->GetCommandBuffer();
+            commandBuffer.Add([](Scene&)
+            {
+                throw std::runtime_error("command");
+            });
+            commandBuffer.Add([&runs](Scene&)
+            {
+                ++runs;
+            });
+            BOOST_CHECK_THROW(commandBuffer.Execute(*scene), std::runtime_error);
+            BOOST_TEST(commandBuffer.IsEmpty());
+
+            commandBuffer.Add([&runs](Scene&)
+            {
+                runs += 10;
+            });
+            commandBuffer.Execute(*scene);
+            BOOST_TEST(runs == 10u);
+        }
+
+        BOOST_AUTO_TEST_CASE(commands_recorded_by_a_throwing_parallel_update_are_dropped)
+        {
+            Resource<GameObject> gameObject = scene->CreateGameObject();
+            gameObject->AddComponent<Thrower>();
+
+            BOOST_CHECK_THROW(scene->OnUpdate(), std::runtime_error);
+            BOOST_TEST(!scene->IsRunningParallelPhase());
+            BOOST_TEST(scene->GetCommandBuffer().IsEmpty());
+
+            gameObject->SetActive(false);
+            scene->OnUpdate();
+            BOOST_TEST((scene->FindGameObject("recorded") == nullptr));
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
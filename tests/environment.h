@@ -0,0 +1,90 @@
+#pragma once
+
+#include <pluto/service/service_collection.h>
+
+#include <pluto/file/file_installer.h>
+#include <pluto/log/log_installer.h>
+#include <pluto/config/config_installer.h>
+#include <pluto/event/event_installer.h>
+#include <pluto/memory/memory_installer.h>
+#include <pluto/job/job_installer.h>
+#include <pluto/asset/asset_installer.h>
+#include <pluto/scene/scene_installer.h>
+
+#include <pluto/render/mesh_buffer.h>
+
+#include <pluto/file/file_stream_writer.h>
+
+#include <memory>
+
+namespace pluto::test
+{
+    /*
+     * There is no GPU without a window, meshes are never uploaded so their buffers are never built.
+     */
+    class HeadlessMeshBufferFactory final : public MeshBuffer::Factory
+    {
+    public:
+        explicit HeadlessMeshBufferFactory(ServiceCollection& serviceCollection)
+            : Factory(serviceCollection)
+        {
+        }
+
+        std::unique_ptr<MeshBuffer> Create(const MeshAsset&) const override
+        {
+            return nullptr;
+        }
+    };
+
+    /*
+     * Engine services that run without a window, installed and uninstalled in the same order as the root does.
+     */
+    class Environment
+    {
+        std::unique_ptr<ServiceCollection> serviceCollection;
+
+    public:
+        Environment()
+            : serviceCollection(std::make_unique<ServiceCollection>())
+        {
+            FileInstaller::Install(*serviceCollection);
+            LogInstaller::Install(nullptr, *serviceCollection);
+            ConfigInstaller::Install(nullptr, *serviceCollection);
+            EventInstaller::Install(*serviceCollection);
+            MemoryInstaller::Install(*serviceCollection);
+            JobInstaller::Install(*serviceCollection);
+            serviceCollection->AddFactory<MeshBuffer>(std::make_unique<HeadlessMeshBufferFactory>(*serviceCollection));
+            AssetInstaller::Install(*serviceCollection);
+            SceneInstaller::Install(*serviceCollection);
+        }
+
+        ~Environment()
+        {
+            SceneInstaller::Uninstall(*serviceCollection);
+            AssetInstaller::Uninstall(*serviceCollection);
+            serviceCollection->RemoveFactory<MeshBuffer>();
+            JobInstaller::Uninstall(*serviceCollection);
+            MemoryInstaller::Uninstall(*serviceCollection);
+            EventInstaller::Uninstall(*serviceCollection);
+            ConfigInstaller::Uninstall(*serviceCollection);
+            LogInstaller::Uninstall(*serviceCollection);
+            FileInstaller::Uninstall(*serviceCollection);
+        }
+
+        Environment(const Environment& other) = delete;
+        Environment(Environment&& other) noexcept = delete;
+        Environment& operator=(const Environment& rhs) = delete;
+        Environment& operator=(Environment&& rhs) noexcept = delete;
+
+        ServiceCollection& GetServiceCollection() const
+        {
+            return *serviceCollection;
+        }
+
+        template <typename T>
+        T& GetService() const
+        {
+            return serviceCollection->GetService<T>();
+        }
+    };
+}
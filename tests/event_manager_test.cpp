@@ -0,0 +1,187 @@
+#define BOOST_TEST_MODULE event_manager_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/event/event_manager.h>
+#include <pluto/event/base_event.h>
+#include <pluto/runtime_id.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace pluto::test
+{
+    class SequenceEvent final : public BaseEvent
+    {
+        size_t producer;
+        size_t sequence;
+
+    public:
+        SequenceEvent(const size_t producer, const size_t sequence)
+            : producer(producer),
+              sequence(sequence)
+        {
+        }
+
+        size_t GetProducer() const
+        {
+            return producer;
+        }
+
+        size_t GetSequence() const
+        {
+            return sequence;
+        }
+    };
+
+    /*
+     * Records what the main thread received from every producer. Out of order or duplicated events are counted instead
+     * of asserted, the listener runs inside the event manager.
+     */
+    struct SequenceListener
+    {
+        std::vector<size_t> nextSequences;
+        size_t received = 0;
+        size_t outOfOrder = 0;
+
+        explicit SequenceListener(const size_t producerCount)
+            : nextSequences(producerCount, 0)
+        {
+        }
+
+        void OnSequenceEvent(const SequenceEvent& evt)
+        {
+            size_t& next = nextSequences.at(evt.GetProducer());
+            if (evt.GetSequence() != next)
+            {
+                ++outOfOrder;
+            }
+            next = evt.GetSequence() + 1;
+            ++received;
+        }
+    };
+
+    struct EventFixture
+    {
+        Environment environment;
+        EventManager& eventManager;
+
+        EventFixture()
+            : eventManager(environment.GetService<EventManager>())
+        {
+        }
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(posted_events, EventFixture)
+
+        BOOST_AUTO_TEST_CASE(events_of_many_producers_keep_their_order_and_none_is_lost)
+        {
+            const size_t producerCount = std::max<size_t>(4, std::thread::hardware_concurrency());
+            constexpr size_t eventsPerProducer = 20000;
+
+            SequenceListener listener(producerCount);
+            const RuntimeId listenerId = eventManager.Subscribe(listener, &SequenceListener::OnSequenceEvent);
+
+            std::atomic<size_t> readyCount(0);
+            std::atomic<bool> isStarted(false);
+            std::vector<std::thread> producers;
+            producers.reserve(producerCount);
+            for (size_t producer = 0; producer < producerCount; ++producer)
+            {
+                producers.emplace_back([&, producer]()
+                {
+                    ++readyCount;
+                    while (!isStarted.load(std::memory_order_acquire))
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    for (size_t sequence = 0; sequence < eventsPerProducer; ++sequence)
+                    {
+                        eventManager.Post<SequenceEvent>(producer, sequence);
+                    }
+                    --readyCount;
+                });
+            }
+
+            while (readyCount.load() != producerCount)
+            {
+                std::this_thread::yield();
+            }
+
+            // The main thread drains while the producers are still posting, as it does between frames.
+            isStarted.store(true, std::memory_order_release);
+            size_t dispatchCount = 0;
+            while (readyCount.load() != 0)
+            {
+                eventManager.DispatchPostedEvents();
+                ++dispatchCount;
+            }
+
+            for (auto& producer : producers)
+            {
+                producer.join();
+            }
+
+            // Every push has completed, one more dispatch has to hand out everything that is left.
+            eventManager.DispatchPostedEvents();
+            eventManager.Unsubscribe<SequenceEvent>(listenerId);
+
+            BOOST_TEST_MESSAGE("Drained while posting " << dispatchCount << " times.");
+            BOOST_TEST(listener.outOfOrder == 0u);
+            BOOST_TEST(listener.received == producerCount * eventsPerProducer);
+            for (const size_t next : listener.nextSequences)
+            {
+                BOOST_TEST(next == eventsPerProducer);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(the_inbox_hands_out_events_posted_after_it_was_emptied)
+        {
+            SequenceListener listener(1);
+            const RuntimeId listenerId = eventManager.Subscribe(listener, &SequenceListener::OnSequenceEvent);
+
+            eventManager.Post<SequenceEvent>(0, 0);
+            eventManager.Post<SequenceEvent>(0, 1);
+            eventManager.DispatchPostedEvents();
+            BOOST_TEST(listener.received == 2u);
+
+            eventManager.DispatchPostedEvents();
+            BOOST_TEST(listener.received == 2u);
+
+            eventManager.Post<SequenceEvent>(0, 2);
+            eventManager.DispatchPostedEvents();
+            eventManager.Unsubscribe<SequenceEvent>(listenerId);
+
+            BOOST_TEST(listener.received == 3u);
+            BOOST_TEST(listener.outOfOrder == 0u);
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+
+    BOOST_FIXTURE_TEST_SUITE(listeners, EventFixture)
+
+        BOOST_AUTO_TEST_CASE(a_listener_that_throws_does_not_leave_the_channel_dispatching)
+        {
+            const RuntimeId throwingId = eventManager.Subscribe<SequenceEvent>([](const SequenceEvent&)
+            {
+                throw std::runtime_error("Listener failed.");
+            });
+            BOOST_CHECK_THROW(eventManager.Dispatch<SequenceEvent>(0, 0), std::runtime_error);
+
+            // Outside of a dispatch both changes apply right away, the next dispatch only reaches the new listener.
+            eventManager.Unsubscribe<SequenceEvent>(throwingId);
+            SequenceListener listener(1);
+            const RuntimeId listenerId = eventManager.Subscribe(listener, &SequenceListener::OnSequenceEvent);
+            eventManager.Dispatch<SequenceEvent>(0, 0);
+            eventManager.Unsubscribe<SequenceEvent>(listenerId);
+
+            BOOST_TEST(listener.received == 1u);
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,140 @@
+#define BOOST_TEST_MODULE game_object_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+
+#include <memory>
+#include <vector>
+
+namespace pluto::test
+{
+    // Deep enough to overflow the call stack if a hierarchy is walked recursively.
+    constexpr size_t CHAIN_DEPTH = 100000;
+
+    std::vector<Resource<GameObject>> CreateChain(Scene& scene, const size_t depth)
+    {
+        std::vector<Resource<GameObject>> chain;
+        chain.reserve(depth);
+        chain.push_back(scene.CreateGameObject());
+        for (size_t i = 1; i < depth; ++i)
+        {
+            chain.push_back(scene.CreateGameObject(chain.back()->GetTransform()));
+        }
+        return chain;
+    }
+
+    struct SceneFixture
+    {
+        Environment environment;
+        std::unique_ptr<Scene> scene;
+
+        SceneFixture()
+            : scene(environment.GetServiceCollection().GetFactory<Scene>().Create())
+        {
+        }
+
+        ~SceneFixture()
+        {
+            scene->Destroy();
+            scene->Cleanup();
+        }
+
+        SceneFixture(const SceneFixture& other) = delete;
+        SceneFixture(SceneFixture&& other) noexcept = delete;
+        SceneFixture& operator=(const SceneFixture& rhs) = delete;
+        SceneFixture& operator=(SceneFixture&& rhs) noexcept = delete;
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(game_object, SceneFixture)
+
+        BOOST_AUTO_TEST_CASE(deactivating_a_deep_chain_reaches_its_leaf)
+        {
+            std::vector<Resource<GameObject>> chain = CreateChain(*scene, CHAIN_DEPTH);
+
+            chain.front()->SetActive(false);
+            BOOST_TEST(!chain.back()->IsGloballyActive());
+            BOOST_TEST(chain.back()->IsActive());
+
+            chain.front()->SetActive(true);
+            BOOST_TEST(chain.back()->IsGloballyActive());
+        }
+
+        BOOST_AUTO_TEST_CASE(despawning_a_deep_chain_parks_its_leaf)
+        {
+            Resource<GameObject> leaf;
+            const uint32_t pool = scene->CreatePool([&leaf](Scene& owner)
+            {
+                const std::vector<Resource<GameObject>> chain = CreateChain(owner, CHAIN_DEPTH);
+                leaf = chain.back();
+                return chain.front();
+            }, 1);
+            BOOST_TEST(leaf->IsDespawned());
+
+            const Resource<GameObject> root = scene->Spawn(pool);
+            BOOST_TEST(!leaf->IsDespawned());
+            BOOST_TEST(leaf->IsGloballyActive());
+
+            scene->Despawn(root);
+            BOOST_TEST(leaf->IsDespawned());
+        }
+
+        BOOST_AUTO_TEST_CASE(renamed_retagged_and_destroyed_game_objects_leave_the_lookups_consistent)
+        {
+            constexpr GameObject::TagMask TAG = 1u << 2;
+            constexpr uint8_t LAYER = 3;
+
+            std::vector<Resource<GameObject>> gameObjects;
+            for (size_t i = 0; i < 64; ++i)
+            {
+                gameObjects.push_back(scene->CreateGameObject("even"));
+                gameObjects.back()->SetTags(TAG);
+            }
+
+            // Taken out of the middle of the buckets, so the last game objects are moved around.
+            for (size_t i = 1; i < gameObjects.size(); i += 2)
+            {
+                gameObjects[i]->SetName("odd");
+                gameObjects[i]->SetTags(0);
+                gameObjects[i]->SetLayer(LAYER);
+            }
+
+            for (size_t i = 0; i < gameObjects.size(); i += 4)
+            {
+                gameObjects[i]->Destroy();
+                gameObjects[i + 1]->Destroy();
+            }
+            scene->Cleanup();
+
+            std::vector<Resource<GameObject>> result;
+            scene->FindGameObjects("even", result);
+            BOOST_TEST(result.size() == 16u);
+
+            result.clear();
+            scene->FindGameObjects("odd", result);
+            BOOST_TEST(result.size() == 16u);
+
+            result.clear();
+            scene->FindGameObjectsWithTags(TAG, result);
+            BOOST_TEST(result.size() == 16u);
+            for (const auto& gameObject : result)
+            {
+                BOOST_TEST(gameObject->GetName() == "even");
+            }
+
+            result.clear();
+            scene->FindGameObjectsInLayers(1u << LAYER, result);
+            BOOST_TEST(result.size() == 16u);
+            for (const auto& gameObject : result)
+            {
+                BOOST_TEST(gameObject->GetName() == "odd");
+            }
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,242 @@
+#include "benchmark.h"
+
+#include <pluto/scene/transform_hierarchy.h>
+#include <pluto/math/vector3f.h>
+#include <pluto/math/quaternion.h>
+#include <pluto/math/matrix4x4.h>
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace pluto::test
+{
+    using NodeId = TransformHierarchy::NodeId;
+
+    /*
+     * What a transform was before the flat hierarchy: every node marks its whole subtree dirty when it moves and
+     * computes its world matrix lazily, recursing up the parent chain.
+     */
+    class LegacyTransform
+    {
+        LegacyTransform* parent;
+        std::vector<LegacyTransform*> children;
+        Vector3F localPosition;
+        Quaternion localRotation;
+        Vector3F localScale;
+        Matrix4X4 localMatrix;
+        Matrix4X4 worldMatrix;
+        bool isLocalMatrixDirty;
+        bool isWorldMatrixDirty;
+
+    public:
+        LegacyTransform()
+            : parent(nullptr),
+              localPosition(Vector3F::ZERO),
+              localRotation(Quaternion::IDENTITY),
+              localScale(Vector3F::ONE),
+              isLocalMatrixDirty(true),
+              isWorldMatrixDirty(true)
+        {
+        }
+
+        void SetParent(LegacyTransform& value)
+        {
+            parent = &value;
+            value.children.push_back(this);
+            SetWorldMatrixAsDirty();
+        }
+
+        const Vector3F& GetLocalPosition() const
+        {
+            return localPosition;
+        }
+
+        void SetLocalPosition(const Vector3F& value)
+        {
+            localPosition = value;
+            isLocalMatrixDirty = true;
+            SetWorldMatrixAsDirty();
+        }
+
+        const Matrix4X4& GetWorldMatrix()
+        {
+            if (isWorldMatrixDirty)
+            {
+                worldMatrix = parent == nullptr ? GetLocalMatrix() : parent->GetWorldMatrix() * GetLocalMatrix();
+                isWorldMatrixDirty = false;
+            }
+            return worldMatrix;
+        }
+
+    private:
+        const Matrix4X4& GetLocalMatrix()
+        {
+            if (isLocalMatrixDirty)
+            {
+                localMatrix = Matrix4X4::TSR(localPosition, localRotation, localScale);
+                isLocalMatrixDirty = false;
+            }
+            return localMatrix;
+        }
+
+        void SetWorldMatrixAsDirty()
+        {
+            isWorldMatrixDirty = true;
+            for (LegacyTransform* child : children)
+            {
+                child->SetWorldMatrixAsDirty();
+            }
+        }
+    };
+
+    /*
+     * Deep hierarchies are a single chain, wide ones a root with every other node as its child.
+     */
+    enum class Shape
+    {
+        Deep,
+        Wide
+    };
+
+    const char* GetShapeName(const Shape shape)
+    {
+        return shape == Shape::Deep ? "deep" : "wide";
+    }
+
+    void RunHierarchy(const Shape shape, const size_t count)
+    {
+        const char* shapeName = GetShapeName(shape);
+        TransformHierarchy hierarchy;
+        std::vector<NodeId> nodes;
+        nodes.reserve(count);
+
+        PrintRow(fmt::format("{0} build", shapeName), count, Measure(count, [&]()
+        {
+            hierarchy.Reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const NodeId node = hierarchy.CreateNode();
+                if (i > 0)
+                {
+                    hierarchy.SetParent(node, shape == Shape::Deep ? nodes.back() : nodes.front());
+                }
+                nodes.push_back(node);
+            }
+        }));
+
+        PrintRow(fmt::format("{0} first update", shapeName), count, Measure(count, [&]()
+        {
+            hierarchy.UpdateWorldMatrices();
+        }));
+
+        PrintRow(fmt::format("{0} update, nothing changed", shapeName), count, Measure(count, [&]()
+        {
+            hierarchy.UpdateWorldMatrices();
+        }));
+
+        float sum = 0;
+        PrintRow(fmt::format("{0} move root + update", shapeName), count, Measure(count, [&]()
+        {
+            hierarchy.SetLocalPosition(nodes.front(), hierarchy.GetLocalPosition(nodes.front()) + Vector3F(1, 0, 0));
+            hierarchy.UpdateWorldMatrices();
+        }));
+
+        PrintRow(fmt::format("{0} move every node + update", shapeName), count, Measure(count, [&]()
+        {
+            for (const NodeId node : nodes)
+            {
+                hierarchy.SetLocalPosition(node, hierarchy.GetLocalPosition(node) + Vector3F(0, 1, 0));
+            }
+            hierarchy.UpdateWorldMatrices();
+        }));
+
+        PrintRow(fmt::format("{0} move root + read every world matrix", shapeName), count, Measure(count, [&]()
+        {
+            hierarchy.SetLocalPosition(nodes.front(), hierarchy.GetLocalPosition(nodes.front()) + Vector3F(1, 0, 0));
+            hierarchy.UpdateWorldMatrices();
+            for (const NodeId node : nodes)
+            {
+                sum += hierarchy.GetWorldMatrix(node).Data()[12];
+            }
+        }));
+
+        // The last node is the deepest one, its lazy path spans the whole chain of a deep hierarchy.
+        PrintRow(fmt::format("{0} move root + lazy leaf world matrix", shapeName), 1, Measure(1, [&]()
+        {
+            hierarchy.SetLocalPosition(nodes.front(), hierarchy.GetLocalPosition(nodes.front()) + Vector3F(1, 0, 0));
+            sum += hierarchy.GetWorldMatrix(nodes.back()).Data()[12];
+        }));
+
+        PrintRow(fmt::format("{0} destroy half + update", shapeName), count, Measure(count, [&]()
+        {
+            for (size_t i = count / 2; i < count; ++i)
+            {
+                hierarchy.DestroyNode(nodes[i]);
+            }
+            hierarchy.UpdateWorldMatrices();
+        }));
+
+        if (sum == 0 || hierarchy.GetNodeCount() != count / 2)
+        {
+            fmt::print("{0} hierarchy did not move\n", shapeName);
+        }
+    }
+
+    void RunLegacyHierarchy(const Shape shape, const size_t count)
+    {
+        const char* shapeName = GetShapeName(shape);
+        std::vector<LegacyTransform> transforms(count);
+        for (size_t i = 1; i < count; ++i)
+        {
+            transforms[i].SetParent(shape == Shape::Deep ? transforms[i - 1] : transforms.front());
+        }
+
+        float sum = 0;
+        PrintRow(fmt::format("legacy {0} move root + read every world matrix", shapeName), count, Measure(count, [&]()
+        {
+            LegacyTransform& root = transforms.front();
+            root.SetLocalPosition(root.GetLocalPosition() + Vector3F(1, 0, 0));
+            for (auto& transform : transforms)
+            {
+                sum += transform.GetWorldMatrix().Data()[12];
+            }
+        }));
+
+        PrintRow(fmt::format("legacy {0} move every node + read", shapeName), count, Measure(count, [&]()
+        {
+            for (auto& transform : transforms)
+            {
+                transform.SetLocalPosition(transform.GetLocalPosition() + Vector3F(0, 1, 0));
+            }
+            for (auto& transform : transforms)
+            {
+                sum += transform.GetWorldMatrix().Data()[12];
+            }
+        }));
+
+        if (sum == 0)
+        {
+            fmt::print("legacy {0} hierarchy did not move\n", shapeName);
+        }
+    }
+}
+
+int main()
+{
+    using namespace pluto::test;
+
+    constexpr size_t count = 100000;
+
+    // The legacy transform recurses once per level, a deep chain of it overflows the stack long before 100k nodes.
+    constexpr size_t legacyDeepCount = 1000;
+
+    PrintHeader(fmt::format("deep hierarchy, {0} nodes", count));
+    RunHierarchy(Shape::Deep, count);
+    RunLegacyHierarchy(Shape::Deep, legacyDeepCount);
+
+    PrintHeader(fmt::format("wide hierarchy, {0} nodes", count));
+    RunHierarchy(Shape::Wide, count);
+    RunLegacyHierarchy(Shape::Wide, count);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+#include "environment.h"
+#include "benchmark.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/config/config_installer.h>
+#include <pluto/job/job_installer.h>
+#include <pluto/job/job_system.h>
+#include <pluto/file/file_manager.h>
+#include <pluto/file/file_stream_reader.h>
+#include <pluto/file/file_stream_writer.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/behaviour.h>
+#include <pluto/scene/components/transform.h>
+#include <pluto/math/vector3f.h>
+
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace pluto::test
+{
+    constexpr size_t AGENT_COUNT = 100000;
+    constexpr size_t FRAME_COUNT = 20;
+    constexpr size_t THREAD_COUNTS[] = {1, 2, 4, 8, 16};
+    constexpr char CONFIG_PATH[] = "job_scaling_benchmark.yml";
+
+    /*
+     * Steers towards a point that orbits the origin, enough math per update for the work to outweigh the scheduling.
+     */
+    class Agent final : public Behaviour
+    {
+        float phase;
+
+    public:
+        class Factory final : public Component::Factory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection)
+                : Component::Factory(serviceCollection)
+            {
+            }
+
+            std::unique_ptr<Component> Create(const Resource<GameObject>& gameObject) const override
+            {
+                return std::make_unique<Agent>(gameObject);
+            }
+        };
+
+        explicit Agent(const Resource<GameObject>& gameObject)
+            : Behaviour(gameObject, true),
+              phase(static_cast<float>(gameObject->GetRuntimeId().GetValue() % 1024) * 0.01f)
+        {
+        }
+
+        void OnUpdate() override
+        {
+            Resource<Transform> transform = GetGameObject()->GetTransform();
+            const Vector3F& position = transform->GetLocalPosition();
+
+            float x = 0;
+            float y = 0;
+            for (int i = 0; i < 16; ++i)
+            {
+                const float angle = phase + static_cast<float>(i) * 0.05f;
+                x += std::cos(angle) - position.x * 0.001f;
+                y += std::sin(angle) - position.y * 0.001f;
+            }
+            phase += 0.01f;
+
+            transform->SetLocalPosition(position + Vector3F(x, y, 0) * 0.001f);
+        }
+    };
+
+    /*
+     * The job system reads its worker count from the config when it is created, both are installed again.
+     */
+    void SetThreadCount(ServiceCollection& serviceCollection, const size_t threadCount)
+    {
+        const auto& fileManager = serviceCollection.GetService<FileManager>();
+        fileManager.OpenWrite(CONFIG_PATH)->Write(fmt::format("jobWorkerCount: {0}\n", threadCount - 1));
+
+        JobInstaller::Uninstall(serviceCollection);
+        ConfigInstaller::Uninstall(serviceCollection);
+        const std::unique_ptr<FileStreamReader> configFile = fileManager.OpenRead(CONFIG_PATH);
+        ConfigInstaller::Install(configFile.get(), serviceCollection);
+        JobInstaller::Install(serviceCollection);
+    }
+
+    double RunAgents(ServiceCollection& serviceCollection)
+    {
+        const std::unique_ptr<Scene> scene = serviceCollection.GetFactory<Scene>().Create();
+        for (size_t i = 0; i < AGENT_COUNT; ++i)
+        {
+            scene->CreateGameObject()->AddComponent<Agent>();
+        }
+
+        // The first frame pays for sorting the hierarchy and warming the caches.
+        scene->OnUpdate();
+        const double nanoseconds = Measure(AGENT_COUNT * FRAME_COUNT, [&]()
+        {
+            for (size_t i = 0; i < FRAME_COUNT; ++i)
+            {
+                scene->OnUpdate();
+            }
+        });
+
+        scene->Destroy();
+        scene->Cleanup();
+        return nanoseconds;
+    }
+
+    double RunKernel(JobSystem& jobSystem, std::vector<float>& values)
+    {
+        return Measure(values.size() * FRAME_COUNT, [&]()
+        {
+            for (size_t frame = 0; frame < FRAME_COUNT; ++frame)
+            {
+                jobSystem.ParallelFor(values.size(), 1024, [&values](const size_t begin, const size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        float value = values[i];
+                        for (int j = 0; j < 16; ++j)
+                        {
+                            value = std::sin(value) + 0.5f;
+                        }
+                        values[i] = value;
+                    }
+                });
+            }
+        });
+    }
+}
+
+int main()
+{
+    using namespace pluto;
+    using namespace pluto::test;
+
+    const Environment environment;
+    ServiceCollection& serviceCollection = environment.GetServiceCollection();
+    serviceCollection.AddFactory<Agent>(std::make_unique<Agent::Factory>(serviceCollection));
+
+    fmt::print("{0} hardware threads\n", std::thread::hardware_concurrency());
+
+    std::vector<float> values(AGENT_COUNT, 1.0f);
+    double agentBaseline = 0;
+    double kernelBaseline = 0;
+    for (const size_t threadCount : THREAD_COUNTS)
+    {
+        SetThreadCount(serviceCollection, threadCount);
+        PrintHeader(fmt::format("{0} threads", threadCount));
+
+        const double agent = RunAgents(serviceCollection);
+        agentBaseline = agentBaseline == 0 ? agent : agentBaseline;
+        PrintRow(fmt::format("parallel agent update, {0:.2f}x", agentBaseline / agent), AGENT_COUNT, agent);
+
+        const double kernel = RunKernel(serviceCollection.GetService<JobSystem>(), values);
+        kernelBaseline = kernelBaseline == 0 ? kernel : kernelBaseline;
+        PrintRow(fmt::format("parallel for kernel, {0:.2f}x", kernelBaseline / kernel), AGENT_COUNT, kernel);
+    }
+
+    serviceCollection.GetService<FileManager>().Delete(CONFIG_PATH);
+    serviceCollection.RemoveFactory<Agent>();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,52 @@
+#define BOOST_TEST_MODULE material_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/resource.h>
+#include <pluto/asset/material_asset.h>
+#include <pluto/asset/shader_asset.h>
+#include <pluto/math/vector4f.h>
+#include <pluto/math/matrix4x4.h>
+
+#include <memory>
+
+namespace pluto::test
+{
+    struct MaterialFixture
+    {
+        Environment environment;
+        const MaterialAsset::Factory& materialFactory;
+
+        MaterialFixture()
+            : materialFactory(environment.GetServiceCollection().GetFactory<MaterialAsset>())
+        {
+        }
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(material, MaterialFixture)
+
+        /*
+         * The asset manager compiles materials before their shader is loaded.
+         */
+        BOOST_AUTO_TEST_CASE(properties_are_kept_without_a_shader)
+        {
+            const std::unique_ptr<MaterialAsset> material = materialFactory.Create(Resource<ShaderAsset>(nullptr));
+            BOOST_TEST(material->FindSlot("u_mat.color") == MaterialAsset::NO_SLOT);
+
+            material->SetFloat("u_mat.alpha", 0.5f);
+            material->SetVector4F("u_mat.color", Vector4F(1, 0, 0, 1));
+            material->SetMatrix4X4("u_mat.offset", Matrix4X4::IDENTITY);
+
+            BOOST_TEST(material->FindSlot("u_mat.color") != MaterialAsset::NO_SLOT);
+            BOOST_TEST(material->GetFloat("u_mat.alpha") == 0.5f);
+            BOOST_TEST((material->GetVector4F("u_mat.color") == Vector4F(1, 0, 0, 1)));
+            BOOST_TEST(material->GetMatrix4X4("u_mat.offset")[15] == 1.0f);
+
+            material->SetVector4F("u_mat.color", Vector4F(0, 1, 0, 1));
+            BOOST_TEST((material->GetVector4F("u_mat.color") == Vector4F(0, 1, 0, 1)));
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
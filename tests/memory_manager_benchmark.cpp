@@ -0,0 +1,217 @@
+#include "environment.h"
+#include "benchmark.h"
+
+#include <pluto/memory/memory_manager.h>
+#include <pluto/memory/object.h>
+#include <pluto/guid.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace pluto::test
+{
+    class BenchmarkObject final : public Object
+    {
+        Guid guid;
+        std::string name;
+
+    public:
+        explicit BenchmarkObject(const Guid& guid)
+            : guid(guid)
+        {
+        }
+
+        const Guid& GetId() const override
+        {
+            return guid;
+        }
+
+        const std::string& GetName() const override
+        {
+            return name;
+        }
+
+        void SetName(const std::string& value) override
+        {
+            name = value;
+        }
+    };
+
+    /*
+     * What the MemoryManager did before the slot map: objects in a guid keyed map, and every resource backed by a
+     * control block that holds a weak pointer to its object.
+     */
+    class LegacyObjectMap
+    {
+        struct ControlImpl
+        {
+            Guid objectId;
+            std::weak_ptr<Object> object;
+        };
+
+        struct Control
+        {
+            std::unique_ptr<ControlImpl> impl;
+        };
+
+        std::unordered_map<Guid, std::shared_ptr<Object>> objects;
+
+    public:
+        std::shared_ptr<Control> Add(std::unique_ptr<Object> object)
+        {
+            std::shared_ptr<Object> ptr(object.release());
+            objects.emplace(ptr->GetId(), ptr);
+            return CreateControl(ptr->GetId(), ptr);
+        }
+
+        std::shared_ptr<Control> Get(const Guid& objectId) const
+        {
+            const auto it = objects.find(objectId);
+            if (it == objects.end())
+            {
+                return nullptr;
+            }
+            return CreateControl(objectId, it->second);
+        }
+
+        static Object* Dereference(const Control& control)
+        {
+            if (control.impl->object.expired())
+            {
+                return nullptr;
+            }
+            return control.impl->object.lock().get();
+        }
+
+        void Remove(const Guid& objectId)
+        {
+            objects.erase(objectId);
+        }
+
+    private:
+        static std::shared_ptr<Control> CreateControl(const Guid& objectId, const std::shared_ptr<Object>& object)
+        {
+            auto control = std::make_shared<Control>();
+            control->impl = std::make_unique<ControlImpl>(ControlImpl{objectId, object});
+            return control;
+        }
+    };
+
+    std::vector<std::unique_ptr<Object>> CreateObjects(const std::vector<Guid>& ids)
+    {
+        std::vector<std::unique_ptr<Object>> objects;
+        objects.reserve(ids.size());
+        for (const Guid& id : ids)
+        {
+            objects.push_back(std::make_unique<BenchmarkObject>(id));
+        }
+        return objects;
+    }
+
+    void RunLegacy(const std::vector<Guid>& ids)
+    {
+        LegacyObjectMap map;
+        std::vector<std::unique_ptr<Object>> objects = CreateObjects(ids);
+
+        PrintRow("legacy map add", ids.size(), Measure(ids.size(), [&]()
+        {
+            for (auto& object : objects)
+            {
+                map.Add(std::move(object));
+            }
+        }));
+
+        size_t found = 0;
+        PrintRow("legacy map get + dereference", ids.size(), Measure(ids.size(), [&]()
+        {
+            for (const Guid& id : ids)
+            {
+                found += LegacyObjectMap::Dereference(*map.Get(id)) != nullptr;
+            }
+        }));
+
+        PrintRow("legacy map remove", ids.size(), Measure(ids.size(), [&]()
+        {
+            for (const Guid& id : ids)
+            {
+                map.Remove(id);
+            }
+        }));
+
+        if (found != ids.size())
+        {
+            fmt::print("legacy map lost {0} objects\n", ids.size() - found);
+        }
+    }
+
+    void RunMemoryManager(MemoryManager& memoryManager, const std::vector<Guid>& ids)
+    {
+        std::vector<std::unique_ptr<Object>> objects = CreateObjects(ids);
+        std::vector<ObjectHandle> handles;
+        handles.reserve(ids.size());
+
+        PrintRow("memory manager add", ids.size(), Measure(ids.size(), [&]()
+        {
+            for (auto& object : objects)
+            {
+                handles.push_back(memoryManager.Add(std::move(object)).GetHandle());
+            }
+        }));
+
+        size_t found = 0;
+        PrintRow("memory manager get by handle + dereference", ids.size(), Measure(ids.size(), [&]()
+        {
+            for (const ObjectHandle handle : handles)
+            {
+                found += memoryManager.Get(handle).Get() != nullptr;
+            }
+        }));
+
+        PrintRow("memory manager get by guid + dereference", ids.size(), Measure(ids.size(), [&]()
+        {
+            for (const Guid& id : ids)
+            {
+                found += memoryManager.Get(id).Get() != nullptr;
+            }
+        }));
+
+        PrintRow("memory manager remove", ids.size(), Measure(ids.size(), [&]()
+        {
+            for (const ObjectHandle handle : handles)
+            {
+                memoryManager.Remove(handle);
+            }
+        }));
+
+        if (found != ids.size() * 2)
+        {
+            fmt::print("memory manager lost {0} objects\n", ids.size() * 2 - found);
+        }
+    }
+}
+
+int main()
+{
+    using namespace pluto;
+    using namespace pluto::test;
+
+    const Environment environment;
+    auto& memoryManager = environment.GetService<MemoryManager>();
+
+    for (const size_t count : {10000, 100000, 1000000})
+    {
+        std::vector<Guid> ids;
+        ids.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ids.push_back(Guid::New());
+        }
+
+        PrintHeader(fmt::format("{0} objects", count));
+        RunLegacy(ids);
+        RunMemoryManager(memoryManager, ids);
+    }
+    return EXIT_SUCCESS;
+}
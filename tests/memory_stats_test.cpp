@@ -0,0 +1,115 @@
+#define BOOST_TEST_MODULE memory_stats_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/memory_manager.h>
+#include <pluto/memory/pool_allocator.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/asset/mesh_asset.h>
+
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+namespace pluto::test
+{
+    MemoryManager::TypeStats GetTypeStats(const MemoryManager& memoryManager, const std::type_info& type)
+    {
+        for (const auto& stats : memoryManager.GetTypeStats())
+        {
+            if (stats.typeName == type.name())
+            {
+                return stats;
+            }
+        }
+
+        BOOST_FAIL("Type is not tracked by the memory manager.");
+        return {};
+    }
+
+    struct MemoryFixture
+    {
+        Environment environment;
+        MemoryManager& memoryManager;
+
+        MemoryFixture()
+            : memoryManager(environment.GetService<MemoryManager>())
+        {
+        }
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(type_stats, MemoryFixture)
+
+        BOOST_AUTO_TEST_CASE(game_object_live_bytes_include_the_pooled_impl)
+        {
+            const std::unique_ptr<Scene> scene = environment.GetServiceCollection().GetFactory<Scene>().Create();
+            const Resource<GameObject> gameObject = scene->CreateGameObject();
+
+            const size_t objectSize = PoolAllocator::GetAllocationSize(dynamic_cast<const void*>(gameObject.Get()));
+            const size_t implSize = gameObject->GetImplAllocationSize();
+            const MemoryManager::TypeStats stats = GetTypeStats(memoryManager, typeid(GameObject));
+
+            BOOST_TEST(implSize > 0u);
+            BOOST_TEST(stats.liveBytes == stats.liveCount * (objectSize + implSize));
+
+            scene->Destroy();
+            scene->Cleanup();
+            BOOST_TEST(GetTypeStats(memoryManager, typeid(GameObject)).liveBytes == 0u);
+        }
+
+        BOOST_AUTO_TEST_CASE(reads_of_removed_objects_are_counted_against_their_type)
+        {
+            const auto& meshFactory = environment.GetServiceCollection().GetFactory<MeshAsset>();
+            const Resource<MeshAsset> live = ResourceUtils::Cast<MeshAsset>(memoryManager.Add(meshFactory.Create()));
+            const Resource<MeshAsset> removed = ResourceUtils::Cast<MeshAsset>(memoryManager.Add(meshFactory.Create()));
+
+            memoryManager.Remove(removed.GetHandle());
+            BOOST_TEST(live.operator->() != nullptr);
+            BOOST_TEST(removed.operator->() == nullptr);
+            BOOST_TEST(removed.operator->() == nullptr);
+
+            BOOST_TEST(GetTypeStats(memoryManager, typeid(MeshAsset)).staleReadCount == 2u);
+        }
+
+        BOOST_AUTO_TEST_CASE(null_checks_of_removed_objects_are_not_counted)
+        {
+            const auto& meshFactory = environment.GetServiceCollection().GetFactory<MeshAsset>();
+            const Resource<MeshAsset> removed = ResourceUtils::Cast<MeshAsset>(memoryManager.Add(meshFactory.Create()));
+
+            memoryManager.Remove(removed.GetHandle());
+            BOOST_TEST((removed == nullptr));
+            BOOST_TEST(!(removed != nullptr));
+            BOOST_TEST(removed.Get() == nullptr);
+            BOOST_TEST((ResourceUtils::Cast<MeshAsset>(removed) == nullptr));
+
+            BOOST_TEST(GetTypeStats(memoryManager, typeid(MeshAsset)).staleReadCount == 0u);
+        }
+
+        BOOST_AUTO_TEST_CASE(reads_through_a_recycled_slot_are_counted_against_the_removed_type)
+        {
+            const auto& meshFactory = environment.GetServiceCollection().GetFactory<MeshAsset>();
+            const std::unique_ptr<Scene> scene = environment.GetServiceCollection().GetFactory<Scene>().Create();
+
+            // Runtime objects reuse slots, the stale resource shares its slot with whatever is added next.
+            const Resource<MeshAsset> removed = ResourceUtils::Cast<MeshAsset>(memoryManager.Add(meshFactory.Create()));
+            memoryManager.Remove(removed.GetHandle());
+            std::vector<Resource<GameObject>> gameObjects;
+            for (size_t i = 0; i < 8; ++i)
+            {
+                gameObjects.push_back(scene->CreateGameObject());
+            }
+
+            BOOST_TEST(removed.operator->() == nullptr);
+            BOOST_TEST(GetTypeStats(memoryManager, typeid(MeshAsset)).staleReadCount == 1u);
+            BOOST_TEST(GetTypeStats(memoryManager, typeid(GameObject)).staleReadCount == 0u);
+
+            scene->Destroy();
+            scene->Cleanup();
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,121 @@
+#include "environment.h"
+#include "benchmark.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/memory_manager.h>
+#include <pluto/memory/resource.h>
+#include <pluto/asset/prefab_asset.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+#include <pluto/scene/components/mesh_renderer.h>
+#include <pluto/math/vector3f.h>
+#include <pluto/math/quaternion.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pluto::test
+{
+    constexpr size_t ENEMY_COUNT = 10000;
+    constexpr GameObject::TagMask ENEMY_TAG = 1u << 2;
+    constexpr uint8_t ENEMY_LAYER = 4;
+
+    /*
+     * An enemy with a mesh on its root, a weapon and a shield.
+     */
+    Resource<PrefabAsset> CreateEnemyPrefab(ServiceCollection& serviceCollection)
+    {
+        std::unique_ptr<PrefabAsset> prefab = serviceCollection.GetFactory<PrefabAsset>().Create();
+        prefab->SetName("enemy");
+
+        const uint32_t root = prefab->AddNode({
+            "enemy", PrefabAsset::NO_PARENT, true, ENEMY_TAG, ENEMY_LAYER, Vector3F(1, 2, 3), Quaternion::IDENTITY,
+            Vector3F::ONE, {"MeshRenderer"}
+        });
+        prefab->AddNode({
+            "weapon", root, true, ENEMY_TAG, ENEMY_LAYER, Vector3F(0, 1, 0), Quaternion::IDENTITY, Vector3F::ONE, {}
+        });
+        prefab->AddNode({
+            "shield", root, true, ENEMY_TAG, ENEMY_LAYER, Vector3F(-1, 0, 0), Quaternion::IDENTITY, Vector3F::ONE, {}
+        });
+        return ResourceUtils::Cast<PrefabAsset>(serviceCollection.GetService<MemoryManager>().Add(std::move(prefab)));
+    }
+
+    Resource<GameObject> CreateChild(Scene& scene, const Resource<GameObject>& parent, const std::string& name,
+                                     const Vector3F& localPosition)
+    {
+        Resource<GameObject> child = scene.CreateGameObject(parent->GetTransform(), name);
+        child->SetTags(ENEMY_TAG);
+        child->SetLayer(ENEMY_LAYER);
+        child->GetTransform()->SetLocalPosition(localPosition);
+        return child;
+    }
+
+    /*
+     * What a game does without prefabs, every object and component created and set up one call at a time.
+     */
+    void CreateEnemyByHand(Scene& scene)
+    {
+        Resource<GameObject> enemy = scene.CreateGameObject("enemy");
+        enemy->SetTags(ENEMY_TAG);
+        enemy->SetLayer(ENEMY_LAYER);
+        enemy->GetTransform()->SetLocalPosition(Vector3F(1, 2, 3));
+        enemy->AddComponent<MeshRenderer>();
+        CreateChild(scene, enemy, "weapon", Vector3F(0, 1, 0));
+        CreateChild(scene, enemy, "shield", Vector3F(-1, 0, 0));
+    }
+
+    template <typename Function>
+    void Run(const Scene::Factory& sceneFactory, const std::string& name, Function&& function)
+    {
+        const std::unique_ptr<Scene> scene = sceneFactory.Create();
+        const double nanoseconds = Measure(ENEMY_COUNT, [&]()
+        {
+            function(*scene);
+        });
+        PrintRow(fmt::format("{0}, {1:.2f} ms", name, nanoseconds * ENEMY_COUNT / 1000000.0), ENEMY_COUNT,
+                 nanoseconds);
+
+        scene->Destroy();
+        scene->Cleanup();
+    }
+}
+
+int main()
+{
+    using namespace pluto;
+    using namespace pluto::test;
+
+    const Environment environment;
+    ServiceCollection& serviceCollection = environment.GetServiceCollection();
+    const auto& sceneFactory = serviceCollection.GetFactory<Scene>();
+    const Resource<PrefabAsset> prefab = CreateEnemyPrefab(serviceCollection);
+
+    PrintHeader(fmt::format("{0} enemies of {1} game objects", ENEMY_COUNT, prefab->GetNodes().size()));
+    Run(sceneFactory, "by hand", [](Scene& scene)
+    {
+        for (size_t i = 0; i < ENEMY_COUNT; ++i)
+        {
+            CreateEnemyByHand(scene);
+        }
+    });
+
+    Run(sceneFactory, "instantiate one at a time", [&prefab](Scene& scene)
+    {
+        for (size_t i = 0; i < ENEMY_COUNT; ++i)
+        {
+            scene.Instantiate(prefab);
+        }
+    });
+
+    Run(sceneFactory, "instantiate in bulk", [&prefab](Scene& scene)
+    {
+        std::vector<Resource<GameObject>> enemies;
+        scene.Instantiate(prefab, ENEMY_COUNT, scene.GetRootGameObject()->GetTransform(), enemies);
+    });
+
+    serviceCollection.GetService<MemoryManager>().Remove(prefab.GetHandle());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+#define BOOST_TEST_MODULE prefab_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/memory_manager.h>
+#include <pluto/memory/resource.h>
+#include <pluto/file/file_manager.h>
+#include <pluto/file/file_stream_reader.h>
+#include <pluto/file/file_stream_writer.h>
+#include <pluto/asset/prefab_asset.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+#include <pluto/scene/components/mesh_renderer.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pluto::test
+{
+    constexpr char PREFAB_PATH[] = "prefab_test.prefab";
+
+    PrefabAsset::Node MakeNode(const std::string& name, const uint32_t parent, const Vector3F& localPosition)
+    {
+        return {name, parent, true, 0, 0, localPosition, Quaternion::IDENTITY, Vector3F::ONE, {}};
+    }
+
+    /*
+     * An enemy with a mesh on its root, a weapon and a shield that starts inactive.
+     */
+    std::unique_ptr<PrefabAsset> CreateEnemyPrefab(const PrefabAsset::Factory& factory)
+    {
+        std::unique_ptr<PrefabAsset> prefab = factory.Create();
+        prefab->SetName("enemy");
+
+        PrefabAsset::Node root = MakeNode("enemy", PrefabAsset::NO_PARENT, Vector3F(1, 2, 3));
+        root.tags = 1u << 2;
+        root.layer = 4;
+        root.components.emplace_back("MeshRenderer");
+        const uint32_t rootIndex = prefab->AddNode(root);
+
+        prefab->AddNode(MakeNode("weapon", rootIndex, Vector3F(0, 1, 0)));
+
+        PrefabAsset::Node shield = MakeNode("shield", rootIndex, Vector3F(-1, 0, 0));
+        shield.isActive = false;
+        prefab->AddNode(shield);
+        return prefab;
+    }
+
+    struct PrefabFixture
+    {
+        Environment environment;
+        MemoryManager& memoryManager;
+        const PrefabAsset::Factory& prefabFactory;
+
+        PrefabFixture()
+            : memoryManager(environment.GetService<MemoryManager>()),
+              prefabFactory(environment.GetServiceCollection().GetFactory<PrefabAsset>())
+        {
+        }
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(prefab, PrefabFixture)
+
+        BOOST_AUTO_TEST_CASE(nodes_survive_a_dump_and_load)
+        {
+            const std::unique_ptr<PrefabAsset> original = CreateEnemyPrefab(prefabFactory);
+            const auto& fileManager = environment.GetService<FileManager>();
+            original->Dump(*fileManager.OpenWrite(PREFAB_PATH));
+
+            std::unique_ptr<Asset> asset = prefabFactory.Create(*fileManager.OpenRead(PREFAB_PATH));
+            fileManager.Delete(PREFAB_PATH);
+            const auto* loaded = dynamic_cast<PrefabAsset*>(asset.get());
+
+            BOOST_REQUIRE(loaded != nullptr);
+            BOOST_TEST(loaded->GetId() == original->GetId());
+            BOOST_TEST(loaded->GetName() == "enemy");
+            BOOST_REQUIRE(loaded->GetNodes().size() == original->GetNodes().size());
+            for (size_t i = 0; i < original->GetNodes().size(); ++i)
+            {
+                const PrefabAsset::Node& expected = original->GetNodes()[i];
+                const PrefabAsset::Node& actual = loaded->GetNodes()[i];
+                BOOST_TEST(actual.name == expected.name);
+                BOOST_TEST(actual.parent == expected.parent);
+                BOOST_TEST(actual.isActive == expected.isActive);
+                BOOST_TEST(actual.tags == expected.tags);
+                BOOST_TEST(actual.layer == expected.layer);
+                BOOST_TEST((actual.localPosition == expected.localPosition));
+                BOOST_TEST(actual.components == expected.components, boost::test_tools::per_element());
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(nodes_must_come_after_their_parent)
+        {
+            const std::unique_ptr<PrefabAsset> prefab = prefabFactory.Create();
+            prefab->AddNode(MakeNode("root", PrefabAsset::NO_PARENT, Vector3F::ZERO));
+            BOOST_CHECK_THROW(prefab->AddNode(MakeNode("orphan", 1, Vector3F::ZERO)), Exception);
+        }
+
+        BOOST_AUTO_TEST_CASE(bulk_instantiate_builds_every_copy)
+        {
+            const Resource<PrefabAsset> prefab = ResourceUtils::Cast<PrefabAsset>(
+                memoryManager.Add(CreateEnemyPrefab(prefabFactory)));
+            const std::unique_ptr<Scene> scene = environment.GetServiceCollection().GetFactory<Scene>().Create();
+
+            constexpr size_t count = 100;
+            const size_t objectCount = memoryManager.GetObjectCount();
+            std::vector<Resource<GameObject>> enemies;
+            scene->Instantiate(prefab, count, scene->GetRootGameObject()->GetTransform(), enemies);
+
+            // Three game objects with a transform each and a mesh renderer on the root.
+            BOOST_TEST(memoryManager.GetObjectCount() - objectCount == count * 7);
+            BOOST_REQUIRE(enemies.size() == count);
+            for (const auto& enemy : enemies)
+            {
+                BOOST_TEST(enemy->GetName() == "enemy");
+                BOOST_TEST(enemy->GetTags() == (1u << 2));
+                BOOST_TEST(enemy->GetLayer() == 4u);
+                BOOST_TEST((enemy->GetTransform()->GetLocalPosition() == Vector3F(1, 2, 3)));
+                BOOST_TEST((enemy->GetComponent<MeshRenderer>() != nullptr));
+
+                std::vector<Resource<Transform>> children = enemy->GetTransform()->GetChildren();
+                BOOST_REQUIRE(children.size() == 2u);
+                BOOST_TEST(children[0]->GetGameObject()->GetName() == "weapon");
+                BOOST_TEST(children[0]->GetGameObject()->IsActive());
+                BOOST_TEST(children[1]->GetGameObject()->GetName() == "shield");
+                BOOST_TEST(!children[1]->GetGameObject()->IsActive());
+                BOOST_TEST((children[0]->GetPosition() == Vector3F(1, 3, 3)));
+            }
+
+            std::vector<Resource<GameObject>> weapons;
+            scene->FindGameObjects("weapon", weapons);
+            BOOST_TEST(weapons.size() == count);
+
+            scene->Destroy();
+            scene->Cleanup();
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,173 @@
+#include "environment.h"
+#include "benchmark.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/memory_manager.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+#include <pluto/scene/components/mesh_renderer.h>
+#include <pluto/asset/mesh_asset.h>
+#include <pluto/asset/material_asset.h>
+#include <pluto/math/vector3f.h>
+#include <pluto/math/matrix4x4.h>
+
+#include <memory>
+#include <vector>
+
+namespace pluto::test
+{
+    /*
+     * What a resource was before it became a handle: a shared control block that holds a weak pointer to its object.
+     * The objects are not owned here, the weak pointers observe aliasing shared pointers with no deleter.
+     */
+    template <typename T>
+    class LegacyResource
+    {
+        struct ControlImpl
+        {
+            std::weak_ptr<T> object;
+        };
+
+        struct Control
+        {
+            std::unique_ptr<ControlImpl> impl;
+        };
+
+        std::shared_ptr<Control> control;
+
+    public:
+        explicit LegacyResource(const std::weak_ptr<T>& object)
+            : control(std::make_shared<Control>())
+        {
+            control->impl = std::make_unique<ControlImpl>(ControlImpl{object});
+        }
+
+        T* operator->() const
+        {
+            if (control->impl->object.expired())
+            {
+                return nullptr;
+            }
+            return control->impl->object.lock().get();
+        }
+    };
+
+    void RunTransforms(const std::vector<Resource<Transform>>& transforms)
+    {
+        std::vector<std::shared_ptr<Transform>> owners;
+        std::vector<LegacyResource<Transform>> legacyTransforms;
+        owners.reserve(transforms.size());
+        legacyTransforms.reserve(transforms.size());
+        for (const auto& transform : transforms)
+        {
+            owners.emplace_back(const_cast<Transform*>(transform.Get()), [](Transform*)
+            {
+            });
+            legacyTransforms.emplace_back(owners.back());
+        }
+
+        float sum = 0;
+        PrintRow("legacy resource dereference", transforms.size(), Measure(transforms.size(), [&]()
+        {
+            for (const auto& transform : legacyTransforms)
+            {
+                sum += transform->GetLocalPosition().x;
+            }
+        }));
+
+        PrintRow("resource dereference", transforms.size(), Measure(transforms.size(), [&]()
+        {
+            for (const auto& transform : transforms)
+            {
+                sum += transform->GetLocalPosition().x;
+            }
+        }));
+
+        std::vector<Resource<Transform>> movedTransforms = transforms;
+        PrintRow("transform move + world matrix", transforms.size(), Measure(transforms.size(), [&]()
+        {
+            for (auto& transform : movedTransforms)
+            {
+                transform->SetLocalPosition(transform->GetLocalPosition() + Vector3F(1, 0, 0));
+                sum += transform->GetWorldMatrix().Data()[12];
+            }
+        }));
+
+        if (sum == 0)
+        {
+            fmt::print("transforms did not move\n");
+        }
+    }
+
+    void RunRenderers(const Scene& scene, const size_t count)
+    {
+        std::vector<Resource<Renderer>> renderers;
+        renderers.reserve(count);
+
+        PrintRow("find renderers", count, Measure(count, [&]()
+        {
+            scene.FindComponents(renderers);
+        }));
+
+        // The per renderer work of the render manager before a draw: layer, assets and world matrix.
+        size_t vertices = 0;
+        float sum = 0;
+        PrintRow("renderer layer + mesh + world matrix", count, Measure(count, [&]()
+        {
+            for (auto& renderer : renderers)
+            {
+                const Resource<GameObject> gameObject = renderer->GetGameObject();
+                if (gameObject->GetLayer() != 0 || renderer->GetMaterial() != nullptr)
+                {
+                    continue;
+                }
+
+                const Resource<MeshAsset> mesh = renderer->GetMesh();
+                vertices += mesh->GetPositions().size();
+                sum += gameObject->GetTransform()->GetWorldMatrix().Data()[0];
+            }
+        }));
+
+        if (vertices != count * 4 || sum == 0)
+        {
+            fmt::print("renderers lost {0} vertices\n", count * 4 - vertices);
+        }
+    }
+}
+
+int main()
+{
+    using namespace pluto;
+    using namespace pluto::test;
+
+    const Environment environment;
+    ServiceCollection& serviceCollection = environment.GetServiceCollection();
+    auto& memoryManager = environment.GetService<MemoryManager>();
+
+    std::unique_ptr<MeshAsset> quad = serviceCollection.GetFactory<MeshAsset>().Create();
+    quad->SetPositions({Vector3F(-1, -1, 0), Vector3F(1, -1, 0), Vector3F(1, 1, 0), Vector3F(-1, 1, 0)});
+    const Resource<MeshAsset> mesh = ResourceUtils::Cast<MeshAsset>(memoryManager.Add(std::move(quad)));
+
+    for (const size_t count : {10000, 100000})
+    {
+        const std::unique_ptr<Scene> scene = serviceCollection.GetFactory<Scene>().Create();
+        std::vector<Resource<Transform>> transforms;
+        transforms.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Resource<GameObject> gameObject = scene->CreateGameObject();
+            gameObject->AddComponent<MeshRenderer>()->SetMesh(mesh);
+            transforms.push_back(gameObject->GetTransform());
+        }
+
+        PrintHeader(fmt::format("{0} game objects", count));
+        RunTransforms(transforms);
+        RunRenderers(*scene, count);
+
+        scene->Destroy();
+        scene->Cleanup();
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,162 @@
+#include "environment.h"
+#include "benchmark.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/resource.h>
+#include <pluto/file/file_manager.h>
+#include <pluto/file/file_stream_reader.h>
+#include <pluto/file/file_stream_writer.h>
+#include <pluto/asset/scene_asset.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+#include <pluto/scene/components/mesh_renderer.h>
+#include <pluto/math/vector3f.h>
+#include <pluto/math/quaternion.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pluto::test
+{
+    constexpr size_t GAME_OBJECT_COUNT = 100000;
+    constexpr size_t CHILDREN_PER_ROOT = 9;
+    constexpr size_t BATCH_SIZE = 4096;
+    constexpr char SCENE_PATH[] = "scene_load_benchmark.scene";
+
+    /*
+     * Roots with a mesh and nine children each, the shape of a level made of props.
+     */
+    std::unique_ptr<SceneAsset> CreateSceneAsset(const SceneAsset::Factory& factory)
+    {
+        std::unique_ptr<SceneAsset> sceneAsset = factory.Create();
+        sceneAsset->SetName("level");
+
+        uint32_t root = SceneAsset::NO_PARENT;
+        for (size_t i = 0; i < GAME_OBJECT_COUNT; ++i)
+        {
+            const bool isRoot = i % (CHILDREN_PER_ROOT + 1) == 0;
+            const Vector3F position(static_cast<float>(i % 100), static_cast<float>(i / 100), 0);
+            PrefabAsset::Node node{
+                isRoot ? "prop" : "part", isRoot ? SceneAsset::NO_PARENT : root, true, 1, 0, position,
+                Quaternion::IDENTITY, Vector3F::ONE, {}
+            };
+            if (isRoot)
+            {
+                node.components.emplace_back("MeshRenderer");
+            }
+
+            const uint32_t index = sceneAsset->AddGameObject(node);
+            root = isRoot ? index : root;
+        }
+        return sceneAsset;
+    }
+
+    /*
+     * The same scene written as setup code, one call at a time.
+     */
+    void CreateByHand(Scene& scene)
+    {
+        Resource<GameObject> root;
+        for (size_t i = 0; i < GAME_OBJECT_COUNT; ++i)
+        {
+            const bool isRoot = i % (CHILDREN_PER_ROOT + 1) == 0;
+            Resource<GameObject> gameObject = isRoot
+                                                  ? scene.CreateGameObject("prop")
+                                                  : scene.CreateGameObject(root->GetTransform(), "part");
+            gameObject->SetTags(1);
+            gameObject->GetTransform()->SetLocalPosition(
+                Vector3F(static_cast<float>(i % 100), static_cast<float>(i / 100), 0));
+            if (isRoot)
+            {
+                gameObject->AddComponent<MeshRenderer>();
+                root = gameObject;
+            }
+        }
+    }
+
+    void PrintMilliseconds(const std::string& name, const double nanosecondsPerItem)
+    {
+        PrintRow(fmt::format("{0}, {1:.2f} ms", name, nanosecondsPerItem * GAME_OBJECT_COUNT / 1000000.0),
+                 GAME_OBJECT_COUNT, nanosecondsPerItem);
+    }
+
+    void CheckLoaded(const std::vector<Resource<GameObject>>& loadedGameObjects)
+    {
+        if (loadedGameObjects.size() != GAME_OBJECT_COUNT)
+        {
+            fmt::print("loaded {0} of {1} game objects\n", loadedGameObjects.size(), GAME_OBJECT_COUNT);
+        }
+    }
+}
+
+int main()
+{
+    using namespace pluto;
+    using namespace pluto::test;
+
+    const Environment environment;
+    ServiceCollection& serviceCollection = environment.GetServiceCollection();
+    const auto& sceneFactory = serviceCollection.GetFactory<Scene>();
+    const auto& sceneAssetFactory = serviceCollection.GetFactory<SceneAsset>();
+    const auto& fileManager = serviceCollection.GetService<FileManager>();
+
+    PrintHeader(fmt::format("{0} game objects", GAME_OBJECT_COUNT));
+    CreateSceneAsset(sceneAssetFactory)->Dump(*fileManager.OpenWrite(SCENE_PATH));
+
+    std::unique_ptr<Asset> asset;
+    PrintMilliseconds("read scene asset", Measure(GAME_OBJECT_COUNT, [&]()
+    {
+        asset = sceneAssetFactory.Create(*fileManager.OpenRead(SCENE_PATH));
+    }));
+    fileManager.Delete(SCENE_PATH);
+    const auto& sceneAsset = dynamic_cast<const SceneAsset&>(*asset);
+
+    {
+        const std::unique_ptr<Scene> scene = sceneFactory.Create();
+        PrintMilliseconds("create by hand", Measure(GAME_OBJECT_COUNT, [&]()
+        {
+            CreateByHand(*scene);
+        }));
+        scene->Destroy();
+        scene->Cleanup();
+    }
+
+    {
+        const std::unique_ptr<Scene> scene = sceneFactory.Create();
+        std::vector<Resource<GameObject>> loadedGameObjects;
+        PrintMilliseconds("load at once", Measure(GAME_OBJECT_COUNT, [&]()
+        {
+            scene->LoadGameObjects(sceneAsset, GAME_OBJECT_COUNT, loadedGameObjects);
+        }));
+        CheckLoaded(loadedGameObjects);
+        scene->Destroy();
+        scene->Cleanup();
+    }
+
+    {
+        // One batch a frame, the slowest one is the stall the main loop sees.
+        const std::unique_ptr<Scene> scene = sceneFactory.Create();
+        std::vector<Resource<GameObject>> loadedGameObjects;
+        double slowestBatch = 0;
+        const double total = Measure(GAME_OBJECT_COUNT, [&]()
+        {
+            while (loadedGameObjects.size() < GAME_OBJECT_COUNT)
+            {
+                slowestBatch = std::max(slowestBatch, Measure(BATCH_SIZE, [&]()
+                {
+                    scene->LoadGameObjects(sceneAsset, BATCH_SIZE, loadedGameObjects);
+                }));
+            }
+        });
+        PrintMilliseconds(fmt::format("load in batches of {0}", BATCH_SIZE), total);
+        PrintRow(fmt::format("slowest batch, {0:.2f} ms", slowestBatch * BATCH_SIZE / 1000000.0), BATCH_SIZE,
+                 slowestBatch);
+        CheckLoaded(loadedGameObjects);
+        scene->Destroy();
+        scene->Cleanup();
+    }
+    return EXIT_SUCCESS;
+}
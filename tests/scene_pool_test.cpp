@@ -0,0 +1,182 @@
+#define BOOST_TEST_MODULE scene_pool_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "environment.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/behaviour.h>
+#include <pluto/scene/components/transform.h>
+
+#include <memory>
+#include <vector>
+
+namespace pluto::test
+{
+    constexpr GameObject::TagMask ENEMY_TAG = 1u << 3;
+    constexpr uint8_t ENEMY_LAYER = 5;
+
+    /*
+     * Counts the pool hooks of every instance.
+     */
+    class PoolHooks final : public Behaviour
+    {
+    public:
+        inline static size_t spawnCount = 0;
+        inline static size_t despawnCount = 0;
+
+        class Factory final : public Component::Factory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection)
+                : Component::Factory(serviceCollection)
+            {
+            }
+
+            std::unique_ptr<Component> Create(const Resource<GameObject>& gameObject) const override
+            {
+                return std::make_unique<PoolHooks>(gameObject);
+            }
+        };
+
+        explicit PoolHooks(const Resource<GameObject>& gameObject)
+            : Behaviour(gameObject)
+        {
+        }
+
+        void OnSpawn() override
+        {
+            ++spawnCount;
+        }
+
+        void OnDespawn() override
+        {
+            ++despawnCount;
+        }
+    };
+
+    struct PoolFixture
+    {
+        Environment environment;
+        std::unique_ptr<Scene> scene;
+        uint32_t pool;
+
+        PoolFixture()
+            : scene(environment.GetServiceCollection().GetFactory<Scene>().Create()),
+              pool(scene->CreatePool([](Scene& owner)
+              {
+                  Resource<GameObject> enemy = owner.CreateGameObject("enemy");
+                  enemy->SetTags(ENEMY_TAG);
+                  enemy->SetLayer(ENEMY_LAYER);
+
+                  Resource<GameObject> weapon = owner.CreateGameObject(enemy->GetTransform(), "weapon");
+                  weapon->SetTags(ENEMY_TAG);
+                  return enemy;
+              }, 2))
+        {
+        }
+
+        ~PoolFixture()
+        {
+            scene->Destroy();
+            scene->Cleanup();
+        }
+
+        PoolFixture(const PoolFixture& other) = delete;
+        PoolFixture(PoolFixture&& other) noexcept = delete;
+        PoolFixture& operator=(const PoolFixture& rhs) = delete;
+        PoolFixture& operator=(PoolFixture&& rhs) noexcept = delete;
+
+        size_t CountWithTags() const
+        {
+            std::vector<Resource<GameObject>> result;
+            scene->FindGameObjectsWithTags(ENEMY_TAG, result);
+            return result.size();
+        }
+
+        size_t CountInLayer() const
+        {
+            std::vector<Resource<GameObject>> result;
+            scene->FindGameObjectsInLayers(1u << ENEMY_LAYER, result);
+            return result.size();
+        }
+
+        size_t CountNamed(const std::string& name) const
+        {
+            std::vector<Resource<GameObject>> result;
+            scene->FindGameObjects(name, result);
+            return result.size();
+        }
+    };
+
+    BOOST_FIXTURE_TEST_SUITE(scene_pool, PoolFixture)
+
+        BOOST_AUTO_TEST_CASE(lookups_skip_despawned_hierarchies)
+        {
+            BOOST_TEST((scene->FindGameObject("enemy") == nullptr));
+            BOOST_TEST((scene->FindGameObject("weapon") == nullptr));
+            BOOST_TEST(CountWithTags() == 0u);
+            BOOST_TEST(CountInLayer() == 0u);
+
+            const Resource<GameObject> enemy = scene->Spawn(pool);
+            BOOST_TEST((scene->FindGameObject("enemy") == enemy));
+            BOOST_TEST((scene->FindGameObject("weapon") != nullptr));
+            BOOST_TEST(CountWithTags() == 2u);
+            BOOST_TEST(CountInLayer() == 1u);
+
+            scene->Despawn(enemy);
+            BOOST_TEST((scene->FindGameObject("enemy") == nullptr));
+            BOOST_TEST(CountNamed("weapon") == 0u);
+            BOOST_TEST(CountWithTags() == 0u);
+            BOOST_TEST(CountInLayer() == 0u);
+
+            BOOST_TEST((scene->Spawn(pool) == enemy));
+            BOOST_TEST(CountNamed("enemy") == 1u);
+            BOOST_TEST(CountNamed("weapon") == 1u);
+        }
+
+        BOOST_AUTO_TEST_CASE(game_objects_moved_into_a_despawned_hierarchy_follow_it)
+        {
+            const Resource<GameObject> enemy = scene->Spawn(pool);
+            const Resource<GameObject> shield = scene->CreateGameObject("shield");
+            shield->GetTransform()->SetParent(enemy->GetTransform());
+
+            scene->Despawn(enemy);
+            BOOST_TEST(shield->IsDespawned());
+            BOOST_TEST((scene->FindGameObject("shield") == nullptr));
+
+            shield->GetTransform()->SetParent(scene->GetRootGameObject()->GetTransform());
+            BOOST_TEST(!shield->IsDespawned());
+            BOOST_TEST((scene->FindGameObject("shield") == shield));
+        }
+
+        BOOST_AUTO_TEST_CASE(filling_a_pool_does_not_call_the_pool_hooks)
+        {
+            ServiceCollection& serviceCollection = environment.GetServiceCollection();
+            serviceCollection.AddFactory<PoolHooks>(std::make_unique<PoolHooks::Factory>(serviceCollection));
+            PoolHooks::spawnCount = 0;
+            PoolHooks::despawnCount = 0;
+
+            const uint32_t hooksPool = scene->CreatePool([](Scene& owner)
+            {
+                Resource<GameObject> gameObject = owner.CreateGameObject("hooks");
+                gameObject->AddComponent<PoolHooks>();
+                owner.CreateGameObject(gameObject->GetTransform())->AddComponent<PoolHooks>();
+                return gameObject;
+            }, 3);
+            BOOST_TEST(PoolHooks::spawnCount == 0u);
+            BOOST_TEST(PoolHooks::despawnCount == 0u);
+            BOOST_TEST((scene->FindGameObject("hooks") == nullptr));
+
+            const Resource<GameObject> gameObject = scene->Spawn(hooksPool);
+            BOOST_TEST(PoolHooks::spawnCount == 2u);
+            BOOST_TEST((scene->FindGameObject("hooks") == gameObject));
+
+            scene->Despawn(gameObject);
+            BOOST_TEST(PoolHooks::despawnCount == 2u);
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,124 @@
+#include "environment.h"
+#include "benchmark.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/memory/resource.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/guid.h>
+#include <pluto/runtime_id.h>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace pluto::test
+{
+    /*
+     * The id work done for every spawned object: a new id and an insert into, then a lookup in, an id keyed map.
+     * Runtime objects used to take a 16 bytes guid, they take an 8 bytes runtime id now.
+     */
+    template <typename Id, typename NewId>
+    void RunIds(const char* name, const size_t count, NewId&& newId)
+    {
+        std::unordered_map<Id, uint32_t> index;
+        index.reserve(count);
+        std::vector<Id> ids;
+        ids.reserve(count);
+
+        PrintRow(fmt::format("{0} new + insert", name), count, Measure(count, [&]()
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Id id = newId();
+                index.emplace(id, static_cast<uint32_t>(i));
+                ids.push_back(id);
+            }
+        }));
+
+        size_t found = 0;
+        PrintRow(fmt::format("{0} find", name), count, Measure(count, [&]()
+        {
+            for (const Id& id : ids)
+            {
+                found += index.find(id) != index.end();
+            }
+        }));
+
+        if (found != count)
+        {
+            fmt::print("{0} lost {1} ids\n", name, count - found);
+        }
+    }
+
+    void RunScene(const Scene::Factory& sceneFactory, const size_t count)
+    {
+        const std::unique_ptr<Scene> scene = sceneFactory.Create();
+
+        std::vector<Resource<GameObject>> gameObjects;
+        gameObjects.reserve(count);
+        PrintRow("scene create game object", count, Measure(count, [&]()
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                gameObjects.push_back(scene->CreateGameObject());
+            }
+        }));
+
+        PrintRow("scene destroy game object", count, Measure(count, [&]()
+        {
+            for (auto& gameObject : gameObjects)
+            {
+                gameObject->Destroy();
+            }
+            scene->Cleanup();
+        }));
+        gameObjects.clear();
+
+        const uint32_t pool = scene->CreatePool([](Scene& owner)
+        {
+            return owner.CreateGameObject();
+        }, count);
+
+        PrintRow("pool spawn", count, Measure(count, [&]()
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                gameObjects.push_back(scene->Spawn(pool));
+            }
+        }));
+
+        PrintRow("pool despawn", count, Measure(count, [&]()
+        {
+            for (const auto& gameObject : gameObjects)
+            {
+                scene->Despawn(gameObject);
+            }
+        }));
+
+        scene->Destroy();
+        scene->Cleanup();
+    }
+}
+
+int main()
+{
+    using namespace pluto;
+    using namespace pluto::test;
+
+    const Environment environment;
+    const auto& sceneFactory = environment.GetServiceCollection().GetFactory<Scene>();
+
+    for (const size_t count : {10000, 100000, 1000000})
+    {
+        PrintHeader(fmt::format("{0} objects", count));
+        RunIds<Guid>("guid", count, []() { return Guid::New(); });
+        RunIds<RuntimeId>("runtime id", count, []() { return RuntimeId::New(); });
+        if (count <= 100000)
+        {
+            RunScene(sceneFactory, count);
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,415 @@
+#include "benchmark.h"
+
+#include <pluto/service/service_collection.h>
+#include <pluto/file/file_installer.h>
+#include <pluto/file/file_manager.h>
+#include <pluto/file/file_stream_reader.h>
+#include <pluto/file/file_stream_writer.h>
+#include <pluto/log/log_installer.h>
+#include <pluto/config/config_installer.h>
+#include <pluto/event/event_installer.h>
+#include <pluto/event/event_manager.h>
+#include <pluto/window/window_installer.h>
+#include <pluto/memory/memory_installer.h>
+#include <pluto/memory/memory_manager.h>
+#include <pluto/memory/resource.h>
+#include <pluto/job/job_installer.h>
+#include <pluto/asset/asset_installer.h>
+#include <pluto/asset/asset_manager.h>
+#include <pluto/asset/mesh_asset.h>
+#include <pluto/asset/material_asset.h>
+#include <pluto/asset/shader_asset.h>
+#include <pluto/asset/texture_asset.h>
+#include <pluto/scene/scene_installer.h>
+#include <pluto/scene/scene_manager.h>
+#include <pluto/scene/scene.h>
+#include <pluto/scene/game_object.h>
+#include <pluto/scene/components/transform.h>
+#include <pluto/scene/components/camera.h>
+#include <pluto/scene/components/mesh_renderer.h>
+#include <pluto/scene/components/behaviour.h>
+#include <pluto/scene/events/on_early_update_event.h>
+#include <pluto/scene/events/on_update_event.h>
+#include <pluto/scene/events/on_late_update_event.h>
+#include <pluto/render/render_installer.h>
+#include <pluto/render/render_manager.h>
+#include <pluto/render/events/on_pre_render_event.h>
+#include <pluto/render/events/on_render_event.h>
+#include <pluto/render/events/on_post_render_event.h>
+#include <pluto/simulation/events/on_main_loop_begin.h>
+#include <pluto/simulation/events/on_main_loop_end.h>
+#include <pluto/math/vector3f.h>
+#include <pluto/math/vector4f.h>
+#include <pluto/stop_watch.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pluto::test
+{
+    constexpr size_t SPRITE_COUNT = 10000;
+    constexpr size_t FRAME_COUNT = 60;
+    constexpr size_t DEPTH_PLANES_COUNT = 4;
+    constexpr size_t MOVING_SPRITE_COUNT = 50000;
+    constexpr double TARGET_FRAME_MILLISECONDS = 1000.0 / 60.0;
+    constexpr char CONFIG_PATH[] = "sprite_render_benchmark.yml";
+
+    /*
+     * The services the root installs, window and renderer included, in the same order. The built-in package is read
+     * from the packages directory under the data directory, as the asset manager compiles it, and the config from
+     * there when it has one. A 1x1 screen leaves out most of the rasterization.
+     */
+    class RenderEnvironment
+    {
+        std::unique_ptr<ServiceCollection> serviceCollection;
+
+    public:
+        explicit RenderEnvironment(const std::string& dataDirectoryName)
+            : serviceCollection(std::make_unique<ServiceCollection>())
+        {
+            FileInstaller::Install(*serviceCollection);
+            auto& fileManager = serviceCollection->GetService<FileManager>();
+            fileManager.SetRootPath(dataDirectoryName);
+            LogInstaller::Install(nullptr, *serviceCollection);
+
+            if (fileManager.IsFile(CONFIG_PATH))
+            {
+                const std::unique_ptr<FileStreamReader> configFile = fileManager.OpenRead(CONFIG_PATH);
+                ConfigInstaller::Install(configFile.get(), *serviceCollection);
+            }
+            else
+            {
+                ConfigInstaller::Install(nullptr, *serviceCollection);
+            }
+
+            EventInstaller::Install(*serviceCollection);
+            WindowInstaller::Install(*serviceCollection);
+            MemoryInstaller::Install(*serviceCollection);
+            JobInstaller::Install(*serviceCollection);
+            AssetInstaller::Install(*serviceCollection);
+            SceneInstaller::Install(*serviceCollection);
+            RenderInstaller::Install(*serviceCollection);
+            serviceCollection->GetService<AssetManager>().LoadPackage("built-in");
+        }
+
+        ~RenderEnvironment()
+        {
+            SceneInstaller::Uninstall(*serviceCollection);
+            AssetInstaller::Uninstall(*serviceCollection);
+            JobInstaller::Uninstall(*serviceCollection);
+            MemoryInstaller::Uninstall(*serviceCollection);
+            RenderInstaller::Uninstall(*serviceCollection);
+            WindowInstaller::Uninstall(*serviceCollection);
+            EventInstaller::Uninstall(*serviceCollection);
+            ConfigInstaller::Uninstall(*serviceCollection);
+            LogInstaller::Uninstall(*serviceCollection);
+            FileInstaller::Uninstall(*serviceCollection);
+        }
+
+        RenderEnvironment(const RenderEnvironment& other) = delete;
+        RenderEnvironment(RenderEnvironment&& other) noexcept = delete;
+        RenderEnvironment& operator=(const RenderEnvironment& rhs) = delete;
+        RenderEnvironment& operator=(RenderEnvironment&& rhs) noexcept = delete;
+
+        ServiceCollection& GetServiceCollection() const
+        {
+            return *serviceCollection;
+        }
+
+        template <typename T>
+        T& GetService() const
+        {
+            return serviceCollection->GetService<T>();
+        }
+    };
+
+    /*
+     * Drifts across the view and comes back from the other side, moved by the job system workers.
+     */
+    class Mover final : public Behaviour
+    {
+        Vector3F velocity;
+
+    public:
+        class Factory final : public Component::Factory
+        {
+        public:
+            explicit Factory(ServiceCollection& serviceCollection)
+                : Component::Factory(serviceCollection)
+            {
+            }
+
+            std::unique_ptr<Component> Create(const Resource<GameObject>& gameObject) const override
+            {
+                return std::make_unique<Mover>(gameObject);
+            }
+        };
+
+        explicit Mover(const Resource<GameObject>& gameObject)
+            : Behaviour(gameObject, true),
+              velocity(0, 0, 0)
+        {
+            const float angle = static_cast<float>(gameObject->GetRuntimeId().GetValue() % 360) * 0.0174533f;
+            velocity = Vector3F(std::cos(angle), std::sin(angle), 0) * 0.005f;
+        }
+
+        void OnUpdate() override
+        {
+            Resource<Transform> transform = GetGameObject()->GetTransform();
+            Vector3F position = transform->GetLocalPosition() + velocity;
+            position.x = position.x > 1.3f ? position.x - 2.6f : position.x < -1.3f ? position.x + 2.6f : position.x;
+            position.y = position.y > 1.0f ? position.y - 2.0f : position.y < -1.0f ? position.y + 2.0f : position.y;
+            transform->SetLocalPosition(position);
+        }
+    };
+
+    /*
+     * The update events of a frame of the simulation main loop, without its frame rate cap and fixed updates.
+     */
+    void RunUpdate(EventManager& eventManager)
+    {
+        eventManager.DispatchPostedEvents();
+        eventManager.Dispatch<OnMainLoopBeginEvent>();
+        eventManager.Dispatch<OnEarlyUpdateEvent>();
+        eventManager.Dispatch<OnUpdateEvent>();
+        eventManager.Dispatch<OnLateUpdateEvent>();
+        eventManager.FlushEventQueues();
+    }
+
+    void RunRender(EventManager& eventManager)
+    {
+        eventManager.Dispatch<OnPreRenderEvent>();
+        eventManager.Dispatch<OnRenderEvent>();
+        eventManager.Dispatch<OnPostRenderEvent>();
+        eventManager.Dispatch<OnMainLoopEndEvent>();
+    }
+
+    void RunFrame(EventManager& eventManager)
+    {
+        RunUpdate(eventManager);
+        RunRender(eventManager);
+    }
+
+    /*
+     * The scene the first frame creates, with an orthographic camera that sees the area from -1 to 1 vertically.
+     */
+    Scene& CreateScene(const RenderEnvironment& environment)
+    {
+        RunFrame(environment.GetService<EventManager>());
+
+        Scene& scene = environment.GetService<SceneManager>().GetActiveScene();
+        Resource<GameObject> cameraGo = scene.CreateGameObject("camera");
+        cameraGo->GetTransform()->SetLocalPosition({0, 0, 10});
+        cameraGo->AddComponent<Camera>()->SetOrthographicSize(1);
+        return scene;
+    }
+
+    /*
+     * Sprites spread over the view on a few depth planes, the way 2D games layer backgrounds, props and characters.
+     * Consecutive sprites go to the next plane and every plane has sprites of each material, so neither the hierarchy
+     * nor the depth keeps the sprites of a material together.
+     */
+    void CreateSprites(Scene& scene, const size_t count, const Resource<MeshAsset>& quad,
+                       const std::vector<Resource<MaterialAsset>>& materials, std::vector<Resource<GameObject>>& sprites)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float x = std::fmod(static_cast<float>(i) * 0.618034f, 1.0f) * 2.6f - 1.3f;
+            const float y = std::fmod(static_cast<float>(i) * 0.381966f, 1.0f) * 2.0f - 1.0f;
+            const auto z = static_cast<float>(i % DEPTH_PLANES_COUNT);
+
+            Resource<GameObject> sprite = scene.CreateGameObject("sprite");
+            Resource<Transform> transform = sprite->GetTransform();
+            transform->SetLocalPosition({x, y, z});
+            transform->SetLocalScale({0.05f, 0.05f, 1});
+
+            Resource<MeshRenderer> renderer = sprite->AddComponent<MeshRenderer>();
+            renderer->SetMesh(quad);
+            renderer->SetMaterial(materials[i / DEPTH_PLANES_COUNT % materials.size()]);
+            sprites.push_back(sprite);
+        }
+    }
+
+    /*
+     * Copies of the material with their own texture, each a separate material to the renderer.
+     */
+    std::vector<Resource<MaterialAsset>> CreateMaterials(const RenderEnvironment& environment, const size_t count)
+    {
+        auto& assetManager = environment.GetService<AssetManager>();
+        auto& memoryManager = environment.GetService<MemoryManager>();
+        const auto& materialFactory = environment.GetServiceCollection().GetFactory<MaterialAsset>();
+
+        const auto original = assetManager.Load<MaterialAsset>("materials/pluto-logo.mat");
+        const Resource<TextureAsset> textures[] = {
+            assetManager.Load<TextureAsset>("textures/pluto-logo.png"),
+            assetManager.Load<TextureAsset>("textures/rgb.png")
+        };
+
+        std::vector<Resource<MaterialAsset>> materials;
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::unique_ptr<MaterialAsset> material = materialFactory.Create(*original.Get());
+            material->SetTexture("u_mat.mainTex", textures[i % 2]);
+            materials.push_back(ResourceUtils::Cast<MaterialAsset>(memoryManager.Add(std::move(material))));
+        }
+        return materials;
+    }
+
+    void PrintStats(const std::string& name, const RenderManager::FrameStats& stats, const std::string& stateCalls,
+                    const std::string& milliseconds)
+    {
+        fmt::print("{0:<40}{1:>10}{2:>9}{3:>9}{4:>9}{5:>9}{6:>10}{7:>11}\n", name, stats.commandsCount,
+                   stats.drawCalls, stats.shaderChanges, stats.materialChanges, stats.meshChanges, stateCalls,
+                   milliseconds);
+    }
+
+    void DestroySprites(const RenderEnvironment& environment, std::vector<Resource<GameObject>>& sprites,
+                        const std::vector<Resource<MaterialAsset>>& materials)
+    {
+        for (Resource<GameObject>& sprite : sprites)
+        {
+            sprite->Destroy();
+        }
+        RunFrame(environment.GetService<EventManager>());
+
+        auto& memoryManager = environment.GetService<MemoryManager>();
+        for (const Resource<MaterialAsset>& material : materials)
+        {
+            memoryManager.Remove(material.GetHandle());
+        }
+    }
+
+    /*
+     * Frame counters of the sorted queue next to what drawing the same frame one renderer at a time costs. That
+     * loop issued a draw call per renderer and bound the shader, the material and the mesh before each one.
+     */
+    void CompareSprites(const RenderEnvironment& environment, Scene& scene, const std::string& name,
+                        const size_t materialsCount)
+    {
+        const std::vector<Resource<MaterialAsset>> materials = CreateMaterials(environment, materialsCount);
+        const auto quad = environment.GetService<AssetManager>().Load<MeshAsset>("meshes/quad.obj");
+
+        std::vector<Resource<GameObject>> sprites;
+        CreateSprites(scene, SPRITE_COUNT, quad, materials, sprites);
+
+        // The first frame uploads the meshes and textures.
+        auto& eventManager = environment.GetService<EventManager>();
+        RunFrame(eventManager);
+        const double nanoseconds = Measure(FRAME_COUNT, [&]()
+        {
+            for (size_t i = 0; i < FRAME_COUNT; ++i)
+            {
+                RunFrame(eventManager);
+            }
+        });
+
+        const RenderManager::FrameStats stats = environment.GetService<RenderManager>().GetFrameStats();
+        RenderManager::FrameStats perRenderer{};
+        perRenderer.commandsCount = stats.commandsCount;
+        perRenderer.drawCalls = stats.commandsCount;
+        perRenderer.shaderChanges = stats.commandsCount;
+        perRenderer.materialChanges = stats.commandsCount;
+        perRenderer.meshChanges = stats.commandsCount;
+
+        PrintHeader(name);
+        fmt::print("{0:<40}{1:>10}{2:>9}{3:>9}{4:>9}{5:>9}{6:>10}{7:>11}\n", "", "commands", "draws", "shaders",
+                   "mats", "meshes", "gl state", "ms/frame");
+        // The old loop set the blend, depth and cull state without the state cache, its calls were not counted.
+        PrintStats("one renderer at a time", perRenderer, "-", "-");
+        PrintStats("sorted queue", stats, std::to_string(stats.stateCallsIssued),
+                   fmt::format("{0:.2f}", nanoseconds / 1000000.0));
+
+        DestroySprites(environment, sprites, materials);
+    }
+
+    /*
+     * Sprites that all move every frame, against the budget of a frame at 60 FPS. The update moves them and the
+     * render rebuilds the queue and draws them, either instanced or merged in the sprite batch.
+     */
+    void MeasureMovingSprites(const RenderEnvironment& environment, Scene& scene, const std::string& name,
+                              const std::vector<Resource<MaterialAsset>>& materials)
+    {
+        const auto quad = environment.GetService<AssetManager>().Load<MeshAsset>("meshes/quad.obj");
+
+        std::vector<Resource<GameObject>> sprites;
+        CreateSprites(scene, MOVING_SPRITE_COUNT, quad, materials, sprites);
+        for (Resource<GameObject>& sprite : sprites)
+        {
+            sprite->AddComponent<Mover>();
+        }
+
+        auto& eventManager = environment.GetService<EventManager>();
+        RunFrame(eventManager);
+
+        StopWatch updateStopWatch;
+        StopWatch renderStopWatch;
+        for (size_t i = 0; i < FRAME_COUNT; ++i)
+        {
+            updateStopWatch.Start();
+            RunUpdate(eventManager);
+            updateStopWatch.Stop();
+
+            renderStopWatch.Start();
+            RunRender(eventManager);
+            renderStopWatch.Stop();
+        }
+
+        const double updateMilliseconds = updateStopWatch.GetElapsedNanoseconds() / 1000000.0 / FRAME_COUNT;
+        const double renderMilliseconds = renderStopWatch.GetElapsedNanoseconds() / 1000000.0 / FRAME_COUNT;
+        const double frameMilliseconds = updateMilliseconds + renderMilliseconds;
+        const RenderManager::FrameStats stats = environment.GetService<RenderManager>().GetFrameStats();
+
+        PrintHeader(name);
+        fmt::print("{0} draw calls, {1} instanced and {2} batched commands\n", stats.drawCalls,
+                   stats.instancedCommands, stats.batchedCommands);
+        fmt::print("{0:<40}{1:>11.2f} ms/frame\n", "update", updateMilliseconds);
+        fmt::print("{0:<40}{1:>11.2f} ms/frame\n", "render", renderMilliseconds);
+        fmt::print("{0:<40}{1:>11.2f} ms/frame{2:>8.1f} FPS, {3} the {4:.2f} ms of 60 FPS\n", "frame",
+                   frameMilliseconds, 1000.0 / frameMilliseconds,
+                   frameMilliseconds <= TARGET_FRAME_MILLISECONDS ? "within" : "over", TARGET_FRAME_MILLISECONDS);
+
+        DestroySprites(environment, sprites, materials);
+    }
+
+    /*
+     * A flat colored material, its shader has no instanced variant so its sprites are merged in the sprite batch.
+     */
+    Resource<MaterialAsset> CreateColorMaterial(const RenderEnvironment& environment)
+    {
+        auto& assetManager = environment.GetService<AssetManager>();
+        const auto& materialFactory = environment.GetServiceCollection().GetFactory<MaterialAsset>();
+
+        std::unique_ptr<MaterialAsset> material = materialFactory.Create(
+            assetManager.Load<ShaderAsset>("shaders/unlit-color.glsl"));
+        material->SetVector4F("u_mat.color", Vector4F(1, 0.5f, 0, 1));
+        return ResourceUtils::Cast<MaterialAsset>(environment.GetService<MemoryManager>().Add(std::move(material)));
+    }
+}
+
+/*
+ * Takes the data directory with the compiled built-in package, the working directory when none is given.
+ */
+int main(int argc, char* argv[])
+{
+    using namespace pluto;
+    using namespace pluto::test;
+
+    const RenderEnvironment environment(argc > 1 ? argv[1] : ".");
+    ServiceCollection& serviceCollection = environment.GetServiceCollection();
+    serviceCollection.AddFactory<Mover>(std::make_unique<Mover::Factory>(serviceCollection));
+    Scene& scene = CreateScene(environment);
+
+    CompareSprites(environment, scene, fmt::format("{0} sprites, one material", SPRITE_COUNT), 1);
+    CompareSprites(environment, scene, fmt::format("{0} sprites, four materials", SPRITE_COUNT), 4);
+    CompareSprites(environment, scene, fmt::format("{0} sprites, a material each", SPRITE_COUNT), SPRITE_COUNT);
+
+    MeasureMovingSprites(environment, scene, fmt::format("{0} moving sprites, instanced", MOVING_SPRITE_COUNT),
+                         CreateMaterials(environment, 1));
+    MeasureMovingSprites(environment, scene, fmt::format("{0} moving sprites, sprite batch", MOVING_SPRITE_COUNT),
+                         {CreateColorMaterial(environment)});
+
+    serviceCollection.RemoveFactory<Mover>();
+    return EXIT_SUCCESS;
+}
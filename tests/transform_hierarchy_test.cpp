@@ -0,0 +1,75 @@
+#define BOOST_TEST_MODULE transform_hierarchy_test
+#include <boost/test/included/unit_test.hpp>
+
+#include <pluto/scene/transform_hierarchy.h>
+#include <pluto/math/vector3f.h>
+#include <pluto/math/matrix4x4.h>
+#include <pluto/exception.h>
+
+#include <vector>
+
+namespace pluto::test
+{
+    using NodeId = TransformHierarchy::NodeId;
+
+    std::vector<NodeId> CreateChain(TransformHierarchy& hierarchy, const size_t count)
+    {
+        std::vector<NodeId> nodes;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const NodeId node = hierarchy.CreateNode();
+            if (i > 0)
+            {
+                hierarchy.SetParent(node, nodes.back());
+            }
+            hierarchy.SetLocalPosition(node, Vector3F(1, 0, 0));
+            nodes.push_back(node);
+        }
+        return nodes;
+    }
+
+    float GetWorldX(TransformHierarchy& hierarchy, const NodeId node)
+    {
+        return hierarchy.GetWorldMatrix(node).MultiplyPoint(Vector3F::ZERO).x;
+    }
+
+    BOOST_AUTO_TEST_SUITE(transform_hierarchy)
+
+        BOOST_AUTO_TEST_CASE(lazy_world_matrix_follows_changed_ancestors)
+        {
+            TransformHierarchy hierarchy;
+            const std::vector<NodeId> nodes = CreateChain(hierarchy, 1000);
+            hierarchy.UpdateWorldMatrices();
+            BOOST_TEST(GetWorldX(hierarchy, nodes.back()) == 1000.0f);
+
+            hierarchy.SetLocalPosition(nodes[10], Vector3F(11, 0, 0));
+            hierarchy.SetLocalPosition(nodes[500], Vector3F(21, 0, 0));
+            BOOST_TEST(GetWorldX(hierarchy, nodes.back()) == 1030.0f);
+            BOOST_TEST(GetWorldX(hierarchy, nodes[500]) == 531.0f);
+            BOOST_TEST(GetWorldX(hierarchy, nodes[10]) == 21.0f);
+
+            hierarchy.UpdateWorldMatrices();
+            BOOST_TEST(GetWorldX(hierarchy, nodes.back()) == 1030.0f);
+            BOOST_TEST(GetWorldX(hierarchy, nodes[499]) == 510.0f);
+        }
+
+        BOOST_AUTO_TEST_CASE(parenting_a_node_under_its_descendant_throws)
+        {
+            TransformHierarchy hierarchy;
+            const std::vector<NodeId> nodes = CreateChain(hierarchy, 8);
+            BOOST_CHECK_THROW(hierarchy.SetParent(nodes[2], nodes[5]), Exception);
+            BOOST_CHECK_THROW(hierarchy.SetParent(nodes[3], nodes[3]), Exception);
+
+            // A later node moved under an earlier one leaves the order to be sorted, cycles are still caught.
+            const NodeId other = hierarchy.CreateNode();
+            hierarchy.SetParent(nodes[7], other);
+            hierarchy.SetParent(other, nodes[1]);
+            BOOST_CHECK_THROW(hierarchy.SetParent(nodes[1], nodes[7]), Exception);
+
+            hierarchy.UpdateWorldMatrices();
+            BOOST_CHECK_THROW(hierarchy.SetParent(nodes[1], nodes[7]), Exception);
+            BOOST_TEST(hierarchy.GetParent(nodes[7]) == other);
+        }
+
+    BOOST_AUTO_TEST_SUITE_END()
+}
@@ -21,13 +21,14 @@
 
 namespace pluto::compiler
 {
-    FontCompiler::FontCompiler(FontAsset::Factory& fontAssetFactory, MaterialAsset::Factory& materialAssetFactory,
-                               TextureAsset::Factory& textureAssetFactory,
-                               ResourceControl::Factory& resourceControlFactory)
-        : fontAssetFactory(&fontAssetFactory),
+    FontCompiler::FontCompiler(FileManager& fileManager, FontAsset::Factory& fontAssetFactory,
+                               MaterialAsset::Factory& materialAssetFactory,
+                               TextureAsset::Factory& textureAssetFactory, MemoryManager& memoryManager)
+        : fileManager(&fileManager),
+          fontAssetFactory(&fontAssetFactory),
           materialAssetFactory(&materialAssetFactory),
           textureAssetFactory(&textureAssetFactory),
-          resourceControlFactory(&resourceControlFactory)
+          memoryManager(&memoryManager)
     {
     }
 
@@ -40,7 +41,7 @@ namespace pluto::compiler
                                                                    const std::string& outputDir) const
     {
         const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
-        if (!FileManager::Exists(plutoFilePath))
+        if (!fileManager->Exists(plutoFilePath))
         {
             throw std::runtime_error("Pluto file not found at " + plutoFilePath);
         }
@@ -56,7 +57,7 @@ namespace pluto::compiler
         const Guid materialGuid(materialAssetNode["guid"].as<std::string>());
         const Guid shaderGuid(materialAssetNode["shader"].as<std::string>());
 
-        std::vector<uint8_t> bytes = FileManager::OpenRead(input).ReadAllBytes();
+        std::vector<uint8_t> bytes = fileManager->OpenRead(input)->ReadAllBytes();
 
         const char first = 32; // Space;
         const char last = 127; // Del
@@ -89,31 +90,33 @@ namespace pluto::compiler
         const_cast<Guid&>(textureAsset->GetId()) = textureGuid;
 
         textureAsset->SetName(Path::GetFileNameWithoutExtension(input) + "-texture");
-        Resource<TextureAsset> textureAssetResource(resourceControlFactory->Create(textureAsset->GetId()));
+        const auto textureAssetResource = ResourceUtils::Cast<TextureAsset>(
+            memoryManager->GetReference(textureAsset->GetId()));
 
-        Resource<ShaderAsset> shaderAsset(resourceControlFactory->Create(shaderGuid));
+        const auto shaderAsset = ResourceUtils::Cast<ShaderAsset>(memoryManager->GetReference(shaderGuid));
 
         std::unique_ptr<MaterialAsset> materialAsset = materialAssetFactory->Create(shaderAsset);
         const_cast<Guid&>(materialAsset->GetId()) = materialGuid;
 
         materialAsset->SetName(Path::GetFileNameWithoutExtension(input) + "-material");
-        materialAsset->SetTexture("mainTex", textureAssetResource);
+        materialAsset->SetTexture("u_mat.mainTex", textureAssetResource);
 
-        Resource<MaterialAsset> materialAssetResource(resourceControlFactory->Create(materialAsset->GetId()));
+        auto materialAssetResource = ResourceUtils::Cast<MaterialAsset>(
+            memoryManager->GetReference(materialAsset->GetId()));
 
         std::unique_ptr<FontAsset> fontAsset = fontAssetFactory->Create(fontSize, glyphs, materialAssetResource);
 
         fontAsset->SetName(Path::GetFileNameWithoutExtension(input));
         const_cast<Guid&>(fontAsset->GetId()) = guid;
 
-        FileStreamWriter fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, fontAsset->GetId().Str()}));
-        fontAsset->Dump(fileWriter);
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, fontAsset->GetId().Str()}));
+        fontAsset->Dump(*fileWriter);
 
-        fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, materialAsset->GetId().Str()}));
-        materialAsset->Dump(fileWriter);
+        fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, materialAsset->GetId().Str()}));
+        materialAsset->Dump(*fileWriter);
 
-        fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, textureAsset->GetId().Str()}));
-        textureAsset->Dump(fileWriter);
+        fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, textureAsset->GetId().Str()}));
+        textureAsset->Dump(*fileWriter);
 
         std::vector<CompiledAsset> assets;
         assets.push_back({fontAsset->GetId(), input});
@@ -4,7 +4,7 @@
 #include <pluto/asset/font_asset.h>
 #include <pluto/asset/material_asset.h>
 #include <pluto/asset/texture_asset.h>
-#include <pluto/memory/resource_control.h>
+#include <pluto/memory/memory_manager.h>
 
 namespace pluto
 {
@@ -15,14 +15,15 @@ namespace pluto::compiler
 {
     class FontCompiler final : public BaseCompiler
     {
+        FileManager* fileManager;
         FontAsset::Factory* fontAssetFactory;
         MaterialAsset::Factory* materialAssetFactory;
         TextureAsset::Factory* textureAssetFactory;
-        ResourceControl::Factory* resourceControlFactory;
+        MemoryManager* memoryManager;
 
     public:
-        FontCompiler(FontAsset::Factory& fontAssetFactory, MaterialAsset::Factory& materialAssetFactory,
-                     TextureAsset::Factory& textureAssetFactory, ResourceControl::Factory& resourceControlFactory);
+        FontCompiler(FileManager& fileManager, FontAsset::Factory& fontAssetFactory, MaterialAsset::Factory& materialAssetFactory,
+                     TextureAsset::Factory& textureAssetFactory, MemoryManager& memoryManager);
 
         std::vector<std::string> GetExtensions() const override;
         std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
@@ -18,10 +18,11 @@
 
 namespace pluto::compiler
 {
-    MaterialCompiler::MaterialCompiler(MaterialAsset::Factory& materialAssetFactory,
-                                       ResourceControl::Factory& resourceControlFactory)
-        : materialAssetFactory(&materialAssetFactory),
-          resourceControlFactory(&resourceControlFactory)
+    MaterialCompiler::MaterialCompiler(FileManager& fileManager, MaterialAsset::Factory& materialAssetFactory,
+                                       MemoryManager& memoryManager)
+        : fileManager(&fileManager),
+          materialAssetFactory(&materialAssetFactory),
+          memoryManager(&memoryManager)
     {
     }
 
@@ -36,7 +37,7 @@ namespace pluto::compiler
         std::vector<CompiledAsset> assets;
 
         const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
-        if (!FileManager::Exists(plutoFilePath))
+        if (!fileManager->Exists(plutoFilePath))
         {
             throw std::runtime_error("Pluto file not found at " + plutoFilePath);
         }
@@ -48,7 +49,7 @@ namespace pluto::compiler
         YAML::Node materialNode = materialFile["material"];
         const auto shaderGuidStr = materialNode["shader"].as<std::string>();
         Guid shaderGuid(shaderGuidStr);
-        Resource<ShaderAsset> shader(resourceControlFactory->Create(shaderGuid));
+        const auto shader = ResourceUtils::Cast<ShaderAsset>(memoryManager->GetReference(shaderGuid));
         auto materialAsset = materialAssetFactory->Create(shader);
 
         const_cast<Guid&>(materialAsset->GetId()) = guid;
@@ -57,7 +58,7 @@ namespace pluto::compiler
         YAML::Node floatsNode = materialNode["floats"];
         for (YAML::const_iterator it = floatsNode.begin(); it != floatsNode.end(); ++it)
         {
-            materialAsset->SetFloat(it->first.as<std::string>(), it->second.as<float>());
+            materialAsset->SetFloat("u_mat." + it->first.as<std::string>(), it->second.as<float>());
         }
 
         YAML::Node vectorsNode = materialNode["vectors"];
@@ -69,7 +70,7 @@ namespace pluto::compiler
                 it->second["z"].as<float>(),
                 it->second["w"].as<float>()
             };
-            materialAsset->SetVector4F(it->first.as<std::string>(), vector);
+            materialAsset->SetVector4F("u_mat." + it->first.as<std::string>(), vector);
         }
 
         YAML::Node matricesNode = materialNode["matrices"];
@@ -94,19 +95,19 @@ namespace pluto::compiler
                 it->second["w3"].as<float>(),
             };
 
-            materialAsset->SetMatrix4X4(it->first.as<std::string>(), matrix);
+            materialAsset->SetMatrix4X4("u_mat." + it->first.as<std::string>(), matrix);
         }
 
         YAML::Node textureNode = materialNode["textures"];
         for (YAML::const_iterator it = textureNode.begin(); it != textureNode.end(); ++it)
         {
             Guid textureGuid(it->second.as<std::string>());
-            Resource<TextureAsset> texture(resourceControlFactory->Create(textureGuid));
-            materialAsset->SetTexture(it->first.as<std::string>(), texture);
+            const auto texture = ResourceUtils::Cast<TextureAsset>(memoryManager->GetReference(textureGuid));
+            materialAsset->SetTexture("u_mat." + it->first.as<std::string>(), texture);
         }
 
-        FileStreamWriter fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, materialAsset->GetId().Str()}));
-        materialAsset->Dump(fileWriter);
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, materialAsset->GetId().Str()}));
+        materialAsset->Dump(*fileWriter);
 
         assets.push_back({materialAsset->GetId(), input});
         return assets;
@@ -2,7 +2,7 @@
 
 #include "../base_compiler.h"
 #include "pluto/asset/material_asset.h"
-#include "pluto/memory/resource_control.h"
+#include "pluto/memory/memory_manager.h"
 
 namespace pluto
 {
@@ -13,12 +13,13 @@ namespace pluto::compiler
 {
     class MaterialCompiler final : public BaseCompiler
     {
+        FileManager* fileManager;
         MaterialAsset::Factory* materialAssetFactory;
-        ResourceControl::Factory* resourceControlFactory;
+        MemoryManager* memoryManager;
 
     public:
-        MaterialCompiler(MaterialAsset::Factory& materialAssetFactory,
-            ResourceControl::Factory& resourceControlFactory);
+        MaterialCompiler(FileManager& fileManager, MaterialAsset::Factory& materialAssetFactory,
+                         MemoryManager& memoryManager);
 
         std::vector<std::string> GetExtensions() const override;
         std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
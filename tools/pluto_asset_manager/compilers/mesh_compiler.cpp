@@ -22,8 +22,9 @@
 
 namespace pluto::compiler
 {
-    MeshCompiler::MeshCompiler(MeshAsset::Factory& meshAssetFactory)
-        : meshAssetFactory(&meshAssetFactory)
+    MeshCompiler::MeshCompiler(FileManager& fileManager, MeshAsset::Factory& meshAssetFactory)
+        : fileManager(&fileManager),
+          meshAssetFactory(&meshAssetFactory)
     {
     }
 
@@ -36,7 +37,7 @@ namespace pluto::compiler
                                                                    const std::string& outputDir) const
     {
         const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
-        if (!FileManager::Exists(plutoFilePath))
+        if (!fileManager->Exists(plutoFilePath))
         {
             throw std::runtime_error("Pluto file not found at " + plutoFilePath);
         }
@@ -44,7 +45,7 @@ namespace pluto::compiler
         YAML::Node plutoFile = YAML::LoadFile(plutoFilePath);
         const Guid guid(plutoFile["guid"].as<std::string>());
 
-        FileStreamReader fr = FileManager::OpenRead(input);
+        std::istringstream ifs(fileManager->OpenRead(input)->ReadAllText());
 
         std::vector<Vector3F> filePositions;
         std::vector<Vector2F> fileUVs;
@@ -56,7 +57,6 @@ namespace pluto::compiler
 
         std::vector<Face> fileFaces;
         std::string op;
-        std::ifstream& ifs = fr.GetStream();
         while (!ifs.eof())
         {
             ifs >> op;
@@ -122,8 +122,8 @@ namespace pluto::compiler
         meshAsset->SetUVs(std::move(uvs));
         meshAsset->SetTriangles(std::move(triangles));
 
-        FileStreamWriter fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, meshAsset->GetId().Str()}));
-        meshAsset->Dump(fileWriter);
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, meshAsset->GetId().Str()}));
+        meshAsset->Dump(*fileWriter);
 
         std::vector<CompiledAsset> assets;
         assets.push_back({meshAsset->GetId(), input});
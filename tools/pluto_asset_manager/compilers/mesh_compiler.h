@@ -12,10 +12,11 @@ namespace pluto::compiler
 {
     class MeshCompiler final : public BaseCompiler
     {
+        FileManager* fileManager;
         MeshAsset::Factory* meshAssetFactory;
 
     public:
-        explicit MeshCompiler(MeshAsset::Factory& meshAssetFactory);
+        MeshCompiler(FileManager& fileManager, MeshAsset::Factory& meshAssetFactory);
 
         std::vector<std::string> GetExtensions() const override;
         std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
@@ -12,9 +12,11 @@
 
 namespace pluto::compiler
 {
-    PackageCompiler::PackageCompiler(PackageManifestAsset::Factory& packageManifestAssetFactory,
+    PackageCompiler::PackageCompiler(FileManager& fileManager,
+                                     PackageManifestAsset::Factory& packageManifestAssetFactory,
                                      const std::vector<std::reference_wrapper<BaseCompiler>>& compilers)
-        : packageManifestAssetFactory(&packageManifestAssetFactory)
+        : fileManager(&fileManager),
+          packageManifestAssetFactory(&packageManifestAssetFactory)
     {
         for (auto& it : compilers)
         {
@@ -36,15 +38,15 @@ namespace pluto::compiler
     {
         std::vector<CompiledAsset> assets;
 
-        FileManager::SetRootPath(input);
+        fileManager->SetRootPath(input);
 
-        FileManager::Delete(outputDir);
+        fileManager->Delete(outputDir);
 
         const Regex plutoFileFilter("^.*pluto$");
-        std::vector<std::string> plutoFiles = FileManager::GetFiles("", plutoFileFilter,
+        std::vector<std::string> plutoFiles = fileManager->GetFiles(".", plutoFileFilter,
                                                                     FileManager::SearchOptions::AllDirectories);
 
-        FileManager::CreateDirectory(outputDir);
+        fileManager->CreateDirectory(outputDir);
 
         auto packageManifest = packageManifestAssetFactory->Create();
 
@@ -52,7 +54,8 @@ namespace pluto::compiler
 
         for (const std::string& plutoFile : plutoFiles)
         {
-            std::string filePath = Path::RemoveExtension(plutoFile);
+            // Assets are found by their path from the package root.
+            std::string filePath = Path::RemoveExtension(Path::GetRelativePath(plutoFile, "."));
 
             std::string fileExtension = Path::GetExtension(filePath);
             BaseCompiler* compiler = compilers.at(fileExtension);
@@ -64,11 +67,11 @@ namespace pluto::compiler
             }
         }
 
-        FileStreamWriter fileWriter = FileManager::OpenWrite(Path::Combine({
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({
             packageManifest->GetName(), packageManifest->GetName()
         }));
 
-        packageManifest->Dump(fileWriter);
+        packageManifest->Dump(*fileWriter);
 
         return assets;
     }
@@ -13,11 +13,12 @@ namespace pluto::compiler
 {
     class PackageCompiler final : public BaseCompiler
     {
+        FileManager* fileManager;
         PackageManifestAsset::Factory* packageManifestAssetFactory;
         std::unordered_map<std::string, BaseCompiler*> compilers;
 
     public:
-        PackageCompiler(PackageManifestAsset::Factory& packageManifestAssetFactory,
+        PackageCompiler(FileManager& fileManager, PackageManifestAsset::Factory& packageManifestAssetFactory,
                         const std::vector<std::reference_wrapper<BaseCompiler>>& compilers);
 
         std::vector<std::string> GetExtensions() const override;
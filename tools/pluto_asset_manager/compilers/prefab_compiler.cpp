@@ -0,0 +1,106 @@
+#include "prefab_compiler.h"
+
+#include "pluto/guid.h"
+#include "pluto/asset/prefab_asset.h"
+#include "pluto/file/file_stream_writer.h"
+#include "pluto/file/file_manager.h"
+#include "pluto/file/path.h"
+
+#include "pluto/math/vector3f.h"
+#include "pluto/math/quaternion.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace pluto::compiler
+{
+    Vector3F ReadVector3F(const YAML::Node& node, const Vector3F& defaultValue)
+    {
+        if (!node)
+        {
+            return defaultValue;
+        }
+
+        return {
+            node["x"].as<float>(defaultValue.x),
+            node["y"].as<float>(defaultValue.y),
+            node["z"].as<float>(defaultValue.z)
+        };
+    }
+
+    // Nodes are added depth first, so every node comes after its parent.
+    void AddPrefabNode(PrefabAsset& prefabAsset, const YAML::Node& yamlNode, const uint32_t parent)
+    {
+        const uint32_t index = prefabAsset.AddNode(PrefabCompiler::ReadNode(yamlNode, parent));
+
+        const YAML::Node children = yamlNode["children"];
+        for (auto it = children.begin(); it != children.end(); ++it)
+        {
+            AddPrefabNode(prefabAsset, *it, index);
+        }
+    }
+
+    PrefabCompiler::PrefabCompiler(FileManager& fileManager, PrefabAsset::Factory& prefabAssetFactory)
+        : fileManager(&fileManager),
+          prefabAssetFactory(&prefabAssetFactory)
+    {
+    }
+
+    std::vector<std::string> PrefabCompiler::GetExtensions() const
+    {
+        return {".prefab"};
+    }
+
+    PrefabAsset::Node PrefabCompiler::ReadNode(const YAML::Node& yamlNode, const uint32_t parent)
+    {
+        PrefabAsset::Node node;
+        node.name = yamlNode["name"].as<std::string>("New Game Object");
+        node.parent = parent;
+        node.isActive = yamlNode["active"].as<bool>(true);
+        node.tags = yamlNode["tags"].as<uint32_t>(0);
+        node.layer = static_cast<uint8_t>(yamlNode["layer"].as<uint32_t>(0));
+        node.localPosition = ReadVector3F(yamlNode["position"], Vector3F::ZERO);
+        node.localRotation = Quaternion::Euler(ReadVector3F(yamlNode["rotation"], Vector3F::ZERO));
+        node.localScale = ReadVector3F(yamlNode["scale"], Vector3F::ONE);
+
+        const YAML::Node components = yamlNode["components"];
+        for (auto it = components.begin(); it != components.end(); ++it)
+        {
+            node.components.push_back(it->as<std::string>());
+        }
+        return node;
+    }
+
+    std::vector<BaseCompiler::CompiledAsset> PrefabCompiler::Compile(const std::string& input,
+                                                                     const std::string& outputDir) const
+    {
+        const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
+        if (!fileManager->Exists(plutoFilePath))
+        {
+            throw std::runtime_error("Pluto file not found at " + plutoFilePath);
+        }
+
+        YAML::Node plutoFile = YAML::LoadFile(plutoFilePath);
+        const Guid guid(plutoFile["guid"].as<std::string>());
+
+        YAML::Node prefabFile = YAML::LoadFile(input);
+        YAML::Node prefabNode = prefabFile["prefab"];
+        if (!prefabNode)
+        {
+            throw std::runtime_error("Prefab root node not found at " + input);
+        }
+
+        auto prefabAsset = prefabAssetFactory->Create();
+        prefabAsset->SetName(Path::GetFileNameWithoutExtension(input));
+        AddPrefabNode(*prefabAsset, prefabNode, PrefabAsset::NO_PARENT);
+
+        const_cast<Guid&>(prefabAsset->GetId()) = guid;
+
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, prefabAsset->GetId().Str()}));
+        prefabAsset->Dump(*fileWriter);
+
+        std::vector<CompiledAsset> assets;
+        assets.push_back({prefabAsset->GetId(), input});
+
+        return assets;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../base_compiler.h"
+#include <pluto/asset/prefab_asset.h>
+
+namespace YAML
+{
+    class Node;
+}
+
+namespace pluto
+{
+    class FileManager;
+}
+
+namespace pluto::compiler
+{
+    class PrefabCompiler final : public BaseCompiler
+    {
+        FileManager* fileManager;
+        PrefabAsset::Factory* prefabAssetFactory;
+
+    public:
+        PrefabCompiler(FileManager& fileManager, PrefabAsset::Factory& prefabAssetFactory);
+
+        std::vector<std::string> GetExtensions() const override;
+        std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
+
+        /*
+         * Reads a game object node without its children, scenes describe their game objects the same way.
+         */
+        static PrefabAsset::Node ReadNode(const YAML::Node& yamlNode, uint32_t parent);
+    };
+}
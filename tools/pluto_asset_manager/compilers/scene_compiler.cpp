@@ -0,0 +1,70 @@
+#include "scene_compiler.h"
+#include "prefab_compiler.h"
+
+#include "pluto/guid.h"
+#include "pluto/asset/scene_asset.h"
+#include "pluto/file/file_stream_writer.h"
+#include "pluto/file/file_manager.h"
+#include "pluto/file/path.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace pluto::compiler
+{
+    // Game objects are added depth first, so every game object comes after its parent.
+    void AddSceneGameObject(SceneAsset& sceneAsset, const YAML::Node& yamlNode, const uint32_t parent)
+    {
+        const uint32_t index = sceneAsset.AddGameObject(PrefabCompiler::ReadNode(yamlNode, parent));
+
+        const YAML::Node children = yamlNode["children"];
+        for (auto it = children.begin(); it != children.end(); ++it)
+        {
+            AddSceneGameObject(sceneAsset, *it, index);
+        }
+    }
+
+    SceneCompiler::SceneCompiler(FileManager& fileManager, SceneAsset::Factory& sceneAssetFactory)
+        : fileManager(&fileManager),
+          sceneAssetFactory(&sceneAssetFactory)
+    {
+    }
+
+    std::vector<std::string> SceneCompiler::GetExtensions() const
+    {
+        return {".scene"};
+    }
+
+    std::vector<BaseCompiler::CompiledAsset> SceneCompiler::Compile(const std::string& input,
+                                                                    const std::string& outputDir) const
+    {
+        const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
+        if (!fileManager->Exists(plutoFilePath))
+        {
+            throw std::runtime_error("Pluto file not found at " + plutoFilePath);
+        }
+
+        YAML::Node plutoFile = YAML::LoadFile(plutoFilePath);
+        const Guid guid(plutoFile["guid"].as<std::string>());
+
+        auto sceneAsset = sceneAssetFactory->Create();
+        sceneAsset->SetName(Path::GetFileNameWithoutExtension(input));
+
+        // The scene file is a list of the game objects under the root of the scene.
+        YAML::Node sceneFile = YAML::LoadFile(input);
+        const YAML::Node gameObjects = sceneFile["scene"];
+        for (auto it = gameObjects.begin(); it != gameObjects.end(); ++it)
+        {
+            AddSceneGameObject(*sceneAsset, *it, SceneAsset::NO_PARENT);
+        }
+
+        const_cast<Guid&>(sceneAsset->GetId()) = guid;
+
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, sceneAsset->GetId().Str()}));
+        sceneAsset->Dump(*fileWriter);
+
+        std::vector<CompiledAsset> assets;
+        assets.push_back({sceneAsset->GetId(), input});
+
+        return assets;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../base_compiler.h"
+#include <pluto/asset/scene_asset.h>
+
+namespace pluto
+{
+    class FileManager;
+}
+
+namespace pluto::compiler
+{
+    class SceneCompiler final : public BaseCompiler
+    {
+        FileManager* fileManager;
+        SceneAsset::Factory* sceneAssetFactory;
+
+    public:
+        SceneCompiler(FileManager& fileManager, SceneAsset::Factory& sceneAssetFactory);
+
+        std::vector<std::string> GetExtensions() const override;
+        std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
+    };
+}
@@ -87,6 +87,7 @@ namespace pluto::compiler
         std::string blendAlphaEquation;
         std::string depthTest;
         std::string cullFace;
+        bool hasInstancedVariant;
     };
 
     ShaderFileData ParseShader(std::istream& is)
@@ -106,6 +107,11 @@ namespace pluto::compiler
             }
             if (line[0] == '#')
             {
+                if (line.find("PLUTO_INSTANCING") != std::string::npos)
+                {
+                    shaderData.hasInstancedVariant = true;
+                }
+
                 std::vector<std::string> split;
                 boost::split(split, line, boost::is_any_of(" "));
                 if (split[0] == "#version")
@@ -241,6 +247,8 @@ namespace pluto::compiler
 
         glBindAttribLocation(programId, 0, "vertex.pos");
         glBindAttribLocation(programId, 1, "vertex.uv");
+        // A matrix takes the four locations from 2 to 5.
+        glBindAttribLocation(programId, 2, "i_model");
 
         int linkResult;
         glLinkProgram(programId);
@@ -294,6 +302,24 @@ namespace pluto::compiler
         return attributes;
     }
 
+    std::vector<uint8_t> GetProgramBinary(const GLuint programId, GLenum& binFormat)
+    {
+        GLint binLength = -1;
+        glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &binLength);
+        std::vector<uint8_t> programBinary(binLength);
+        GLsizei bytesWritten;
+        glGetProgramBinary(programId, binLength, &bytesWritten, &binFormat, programBinary.data());
+        return programBinary;
+    }
+
+    std::string AddDefine(const std::string& src, const std::string& define)
+    {
+        // Right after the #version line, which has to be the first one.
+        std::string result = src;
+        result.insert(result.find('\n') + 1, "#define " + define + "\n");
+        return result;
+    }
+
     std::vector<ShaderAsset::Property> FetchUniforms(const GLuint programId)
     {
         std::vector<ShaderAsset::Property> uniforms;
@@ -354,8 +380,9 @@ namespace pluto::compiler
         return ShaderAsset::CullFace::Default;
     }
 
-    ShaderCompiler::ShaderCompiler(ShaderAsset::Factory& shaderAssetFactory)
-        : shaderAssetFactory(&shaderAssetFactory)
+    ShaderCompiler::ShaderCompiler(FileManager& fileManager, ShaderAsset::Factory& shaderAssetFactory)
+        : fileManager(&fileManager),
+          shaderAssetFactory(&shaderAssetFactory)
     {
     }
 
@@ -368,7 +395,7 @@ namespace pluto::compiler
                                                                      const std::string& outputDir) const
     {
         const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
-        if (!FileManager::Exists(plutoFilePath))
+        if (!fileManager->Exists(plutoFilePath))
         {
             throw std::runtime_error("Pluto file not found at " + plutoFilePath);
         }
@@ -376,16 +403,26 @@ namespace pluto::compiler
         YAML::Node plutoFile = YAML::LoadFile(plutoFilePath);
         const Guid guid(plutoFile["guid"].as<std::string>());
 
-        FileStreamReader fr = FileManager::OpenRead(input);
-        const ShaderFileData shaderData = ParseShader(fr.GetStream());
+        std::istringstream shaderStream(fileManager->OpenRead(input)->ReadAllText());
+        const ShaderFileData shaderData = ParseShader(shaderStream);
 
         const GLuint programId = CreateShader(shaderData.vertexSrc, shaderData.fragSrc);
-        GLint binLength = -1;
         GLenum binFormat = -1;
-        glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &binLength);
-        std::vector<uint8_t> programBinary(binLength);
-        GLsizei bytesWritten;
-        glGetProgramBinary(programId, binLength, &bytesWritten, &binFormat, programBinary.data());
+        const std::vector<uint8_t> programBinary = GetProgramBinary(programId, binFormat);
+
+        std::vector<uint8_t> instancedProgramBinary;
+        if (shaderData.hasInstancedVariant)
+        {
+            const GLuint instancedProgramId = CreateShader(AddDefine(shaderData.vertexSrc, "PLUTO_INSTANCING"),
+                                                           AddDefine(shaderData.fragSrc, "PLUTO_INSTANCING"));
+            GLenum instancedBinFormat = -1;
+            instancedProgramBinary = GetProgramBinary(instancedProgramId, instancedBinFormat);
+            glDeleteProgram(instancedProgramId);
+            if (instancedBinFormat != binFormat)
+            {
+                throw std::runtime_error("Instanced variant of " + input + " has a different binary format.");
+            }
+        }
 
         const ShaderAsset::BlendEquation blendEquation = ParseBlendFunc(shaderData.blendEquation);
         const ShaderAsset::BlendEquation blendAlphaEquation = ParseBlendFunc(shaderData.blendAlphaEquation);
@@ -406,14 +443,15 @@ namespace pluto::compiler
 
         auto shaderAsset = shaderAssetFactory->Create(blendEquation, blendAlphaEquation, blendSrcFactor, blendDstFactor,
                                                       blendAlphaSrcFactor, blendAlphaDstFactor, depthTest, cullFace,
-                                                      attributes, uniforms, binFormat, programBinary);
+                                                      attributes, uniforms, binFormat, programBinary,
+                                                      instancedProgramBinary);
 
         const_cast<Guid&>(shaderAsset->GetId()) = guid;
 
         shaderAsset->SetName(Path::GetFileNameWithoutExtension(input));
 
-        FileStreamWriter fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, shaderAsset->GetId().Str()}));
-        shaderAsset->Dump(fileWriter);
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, shaderAsset->GetId().Str()}));
+        shaderAsset->Dump(*fileWriter);
 
         std::vector<CompiledAsset> assets;
         assets.push_back({shaderAsset->GetId(), input});
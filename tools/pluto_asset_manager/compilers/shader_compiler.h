@@ -12,10 +12,11 @@ namespace pluto::compiler
 {
     class ShaderCompiler final : public BaseCompiler
     {
+        FileManager* fileManager;
         ShaderAsset::Factory* shaderAssetFactory;
 
     public:
-        explicit ShaderCompiler(ShaderAsset::Factory& shaderAssetFactory);
+        ShaderCompiler(FileManager& fileManager, ShaderAsset::Factory& shaderAssetFactory);
 
         std::vector<std::string> GetExtensions() const override;
         std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
@@ -13,8 +13,9 @@
 
 namespace pluto::compiler
 {
-    TextCompiler::TextCompiler(TextAsset::Factory& textAssetFactory)
-        : textAssetFactory(&textAssetFactory)
+    TextCompiler::TextCompiler(FileManager& fileManager, TextAsset::Factory& textAssetFactory)
+        : fileManager(&fileManager),
+          textAssetFactory(&textAssetFactory)
     {
     }
 
@@ -27,7 +28,7 @@ namespace pluto::compiler
                                                                    const std::string& outputDir) const
     {
         const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
-        if (!FileManager::Exists(plutoFilePath))
+        if (!fileManager->Exists(plutoFilePath))
         {
             throw std::runtime_error("Pluto file not found at " + plutoFilePath);
         }
@@ -35,10 +36,7 @@ namespace pluto::compiler
         YAML::Node plutoFile = YAML::LoadFile(plutoFilePath);
         const Guid guid(plutoFile["guid"].as<std::string>());
 
-        FileStreamReader fr = FileManager::OpenRead(input);
-        const std::string fileContent{
-            std::istreambuf_iterator<char>(fr.GetStream()), std::istreambuf_iterator<char>()
-        };
+        const std::string fileContent = fileManager->OpenRead(input)->ReadAllText();
 
         auto textAsset = textAssetFactory->Create();
         textAsset->SetName(Path::GetFileNameWithoutExtension(input));
@@ -46,8 +44,8 @@ namespace pluto::compiler
 
         const_cast<Guid&>(textAsset->GetId()) = guid;
 
-        FileStreamWriter fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, textAsset->GetId().Str()}));
-        textAsset->Dump(fileWriter);
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, textAsset->GetId().Str()}));
+        textAsset->Dump(*fileWriter);
 
         std::vector<CompiledAsset> assets;
         assets.push_back({textAsset->GetId(), input});
@@ -12,10 +12,11 @@ namespace pluto::compiler
 {
     class TextCompiler final : public BaseCompiler
     {
+        FileManager* fileManager;
         TextAsset::Factory* textAssetFactory;
 
     public:
-        explicit TextCompiler(TextAsset::Factory& textAssetFactory);
+        TextCompiler(FileManager& fileManager, TextAsset::Factory& textAssetFactory);
 
         std::vector<std::string> GetExtensions() const override;
         std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
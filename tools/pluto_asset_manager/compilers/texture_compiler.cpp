@@ -29,8 +29,9 @@ namespace pluto::compiler
         throw std::runtime_error("");
     }
 
-    TextureCompiler::TextureCompiler(TextureAsset::Factory& textureAssetFactory)
-        : textureAssetFactory(&textureAssetFactory)
+    TextureCompiler::TextureCompiler(FileManager& fileManager, TextureAsset::Factory& textureAssetFactory)
+        : fileManager(&fileManager),
+          textureAssetFactory(&textureAssetFactory)
     {
     }
 
@@ -43,7 +44,7 @@ namespace pluto::compiler
                                                                       const std::string& outputDir) const
     {
         const std::string plutoFilePath = Path::ChangeExtension(input, Path::GetExtension(input) + ".pluto");
-        if (!FileManager::Exists(plutoFilePath))
+        if (!fileManager->Exists(plutoFilePath))
         {
             throw std::runtime_error("Pluto file not found at " + plutoFilePath);
         }
@@ -61,8 +62,8 @@ namespace pluto::compiler
 
         const_cast<Guid&>(textureAsset->GetId()) = guid;
 
-        FileStreamWriter fileWriter = FileManager::OpenWrite(Path::Combine({outputDir, textureAsset->GetId().Str()}));
-        textureAsset->Dump(fileWriter);
+        std::unique_ptr<FileStreamWriter> fileWriter = fileManager->OpenWrite(Path::Combine({outputDir, textureAsset->GetId().Str()}));
+        textureAsset->Dump(*fileWriter);
 
         std::vector<CompiledAsset> assets;
         assets.push_back({textureAsset->GetId(), input});
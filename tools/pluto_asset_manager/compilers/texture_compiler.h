@@ -12,10 +12,11 @@ namespace pluto::compiler
 {
     class TextureCompiler final : public BaseCompiler
     {
+        FileManager* fileManager;
         TextureAsset::Factory* textureAssetFactory;
 
     public:
-        explicit TextureCompiler(TextureAsset::Factory& textureAssetFactory);
+        TextureCompiler(FileManager& fileManager, TextureAsset::Factory& textureAssetFactory);
 
         std::vector<std::string> GetExtensions() const override;
         std::vector<CompiledAsset> Compile(const std::string& input, const std::string& outputDir) const override;
@@ -2,6 +2,8 @@
 #include "compilers/material_compiler.h"
 #include "compilers/mesh_compiler.h"
 #include "compilers/package_compiler.h"
+#include "compilers/prefab_compiler.h"
+#include "compilers/scene_compiler.h"
 #include "compilers/shader_compiler.h"
 #include "compilers/text_compiler.h"
 #include "compilers/texture_compiler.h"
@@ -14,12 +16,14 @@
 #include <pluto/asset/texture_asset.h>
 #include <pluto/asset/shader_asset.h>
 
+#include "pluto/file/file_installer.h"
 #include "pluto/log/log_installer.h"
+#include "pluto/config/config_installer.h"
 
-#include "pluto/memory/resource_control.h"
 #include "pluto/memory/memory_manager.h"
 
 #include <pluto/render/gl/gl_mesh_buffer.h>
+#include <pluto/render/gl/gl_state_cache.h>
 
 #include <pluto/service/service_collection.h>
 
@@ -54,7 +58,7 @@ void InitGl()
     const GLenum err = glewInit();
     if (GLEW_OK != err)
     {
-        throw std::runtime_error(fmt::format("Failed to initialize glew. Error: {0}", glewGetErrorString(err)));
+        throw std::runtime_error(fmt::format("Failed to initialize glew. Error: {0}", reinterpret_cast<const char*>(glewGetErrorString(err))));
     }
 }
 
@@ -72,36 +76,50 @@ namespace pluto::compiler
 
         auto& packageManifestAssetFactory = serviceCollection->EmplaceFactory<PackageManifestAsset>();
 
+        auto& prefabAssetFactory = serviceCollection->EmplaceFactory<PrefabAsset>();
+
+        auto& sceneAssetFactory = serviceCollection->EmplaceFactory<SceneAsset>();
+
         auto& shaderAssetFactory = serviceCollection->EmplaceFactory<ShaderAsset>();
 
         auto& textAssetFactory = serviceCollection->EmplaceFactory<TextAsset>();
 
         auto& textureAssetFactory = serviceCollection->EmplaceFactory<TextureAsset>();
 
-        auto& resourceControlFactory = serviceCollection->EmplaceFactory<ResourceControl>();
-
         serviceCollection->EmplaceFactory<MeshBuffer, GlMeshBuffer::Factory>();
 
         serviceCollection->EmplaceFactory<ShaderProgram, DummyShaderProgram::Factory>();
 
         serviceCollection->EmplaceFactory<TextureBuffer, DummyTextureBuffer::Factory>();
 
+        FileInstaller::Install(*serviceCollection);
+
         LogInstaller::Install(nullptr, *serviceCollection);
 
-        serviceCollection->AddService(MemoryManager::Factory(*serviceCollection).Create());
+        ConfigInstaller::Install(nullptr, *serviceCollection);
+
+        serviceCollection->AddService(GlStateCache::Factory(*serviceCollection).Create());
+
+        auto& memoryManager = serviceCollection->AddService(MemoryManager::Factory(*serviceCollection).Create());
+
+        auto& fileManager = serviceCollection->GetService<FileManager>();
+
+        serviceCollection->EmplaceService<FontCompiler>(fileManager, fontAssetFactory, materialAssetFactory,
+                                                        textureAssetFactory, memoryManager);
 
-        serviceCollection->EmplaceService<FontCompiler>(fontAssetFactory, materialAssetFactory, textureAssetFactory,
-                                                        resourceControlFactory);
+        serviceCollection->EmplaceService<MaterialCompiler>(fileManager, materialAssetFactory, memoryManager);
 
-        serviceCollection->EmplaceService<MaterialCompiler>(materialAssetFactory, resourceControlFactory);
+        serviceCollection->EmplaceService<MeshCompiler>(fileManager, meshAssetFactory);
 
-        serviceCollection->EmplaceService<MeshCompiler>(meshAssetFactory);
+        serviceCollection->EmplaceService<PrefabCompiler>(fileManager, prefabAssetFactory);
 
-        serviceCollection->EmplaceService<ShaderCompiler>(shaderAssetFactory);
+        serviceCollection->EmplaceService<SceneCompiler>(fileManager, sceneAssetFactory);
 
-        serviceCollection->EmplaceService<TextCompiler>(textAssetFactory);
+        serviceCollection->EmplaceService<ShaderCompiler>(fileManager, shaderAssetFactory);
 
-        serviceCollection->EmplaceService<TextureCompiler>(textureAssetFactory);
+        serviceCollection->EmplaceService<TextCompiler>(fileManager, textAssetFactory);
+
+        serviceCollection->EmplaceService<TextureCompiler>(fileManager, textureAssetFactory);
 
         std::vector<std::reference_wrapper<BaseService>> services = serviceCollection->FindServices(
             [](const BaseService& service)
@@ -117,12 +135,27 @@ namespace pluto::compiler
         }
 
         const auto& packageCompiler = serviceCollection->EmplaceService<PackageCompiler>(
-            packageManifestAssetFactory, compilers);
+            fileManager, packageManifestAssetFactory, compilers);
+
+        // Services that log when they terminate go before the log manager, also when a compiler throws.
+        const auto removeServices = [&serviceCollection]()
+        {
+            serviceCollection->RemoveService<MemoryManager>();
+            serviceCollection->RemoveService<GlStateCache>();
+        };
 
         std::string outputDir = Path::Combine({input, Path::GetFileName(input)});
-        packageCompiler.Compile(input, outputDir);
+        try
+        {
+            packageCompiler.Compile(input, outputDir);
+        }
+        catch (...)
+        {
+            removeServices();
+            throw;
+        }
 
-        serviceCollection->RemoveService<MemoryManager>();
+        removeServices();
     }
 }
 